@@ -32,12 +32,20 @@
  *
  * The BSP may optionally define ARM_GENERIC_TIMER_USE_VIRTUAL in <bsp.h> to
  * use the virtual timer instead of the physical timer.
+ *
+ * The BSP may optionally define CLOCK_DRIVER_USE_TICKLESS_IDLE in <bsp.h> to
+ * suppress the clock interrupts while a processor is idle.  The application
+ * shall use _Clock_Tickless_idle_body() for CONFIGURE_IDLE_TASK_BODY in this
+ * case.
  */
 
 typedef struct {
   struct timecounter tc;
   uint32_t interval;
   rtems_vector_number irq;
+#ifdef CLOCK_DRIVER_USE_TICKLESS_IDLE
+  uint64_t base;
+#endif
 } arm_gt_clock_context;
 
 static arm_gt_clock_context arm_gt_clock_instance;
@@ -81,6 +89,7 @@ static inline void arm_gt_clock_set_control(uint32_t ctl)
 #endif
 }
 
+#ifndef CLOCK_DRIVER_USE_TICKLESS_IDLE
 static void arm_gt_clock_at_tick(void)
 {
   uint64_t cval;
@@ -94,6 +103,29 @@ static void arm_gt_clock_at_tick(void)
   arm_gt_clock_set_control(0x1);
 #endif /* ARM_GENERIC_TIMER_UNMASK_AT_TICK */
 }
+#else /* CLOCK_DRIVER_USE_TICKLESS_IDLE */
+static void arm_gt_clock_set_next_tick(uint64_t ticks)
+{
+  uint64_t base;
+  uint64_t interval;
+  uint64_t cval;
+
+  /* The tick boundaries are multiples of the interval after the base */
+  base = arm_gt_clock_instance.base;
+  interval = arm_gt_clock_instance.interval;
+  cval = arm_gt_clock_get_count() - base;
+  cval = base + (cval / interval + ticks) * interval;
+  arm_gt_clock_set_compare_value(cval);
+#ifdef ARM_GENERIC_TIMER_UNMASK_AT_TICK
+  arm_gt_clock_set_control(0x1);
+#endif /* ARM_GENERIC_TIMER_UNMASK_AT_TICK */
+}
+
+static void arm_gt_clock_wait_for_interrupt(void)
+{
+  __asm__ volatile ("wfi");
+}
+#endif /* CLOCK_DRIVER_USE_TICKLESS_IDLE */
 
 static void arm_gt_clock_handler_install(void)
 {
@@ -155,6 +187,9 @@ static void arm_gt_clock_initialize(void)
   cval = arm_gt_clock_get_count();
   cval += interval;
   arm_gt_clock_instance.interval = interval;
+#ifdef CLOCK_DRIVER_USE_TICKLESS_IDLE
+  arm_gt_clock_instance.base = cval;
+#endif
 
   arm_gt_clock_gt_init(cval);
   arm_gt_clock_secondary_initialization(cval);
@@ -198,8 +233,16 @@ RTEMS_SYSINIT_ITEM(
   RTEMS_SYSINIT_ORDER_FIRST
 );
 
+#ifdef CLOCK_DRIVER_USE_TICKLESS_IDLE
+#define Clock_driver_support_set_next_tick(ticks) \
+  arm_gt_clock_set_next_tick(ticks)
+
+#define Clock_driver_support_wait_for_interrupt() \
+  arm_gt_clock_wait_for_interrupt()
+#else
 #define Clock_driver_support_at_tick() \
   arm_gt_clock_at_tick()
+#endif
 
 #define Clock_driver_support_initialize_hardware() \
   arm_gt_clock_initialize()
@@ -19,6 +19,7 @@
 
 #include <bsp.h>
 #include <rtems/clockdrv.h>
+#include <rtems/score/isrlevel.h>
 #include <rtems/score/percpu.h>
 #include <rtems/score/smpimpl.h>
 #include <rtems/score/timecounter.h>
@@ -41,6 +42,22 @@
 #error "Fast Idle PLUS n ISRs per tick is not supported"
 #endif
 
+#if defined(CLOCK_DRIVER_USE_TICKLESS_IDLE)
+  #if CLOCK_DRIVER_USE_FAST_IDLE || CLOCK_DRIVER_ISRS_PER_TICK
+    #error "Tickless idle PLUS fast idle or n ISRs per tick is not supported"
+  #endif
+  #if defined(CLOCK_DRIVER_USE_DUMMY_TIMECOUNTER) || \
+    defined(CLOCK_DRIVER_USE_ONLY_BOOT_PROCESSOR)
+    #error "Tickless idle needs a timecounter and a clock interrupt per processor"
+  #endif
+  #ifndef Clock_driver_support_set_next_tick
+    #error "Tickless idle needs Clock_driver_support_set_next_tick()"
+  #endif
+  #ifndef Clock_driver_support_wait_for_interrupt
+    #error "Tickless idle needs Clock_driver_support_wait_for_interrupt()"
+  #endif
+#endif
+
 /**
  * @brief Do nothing by default.
  */
@@ -101,6 +118,161 @@ static void Clock_driver_timecounter_tick( void )
 }
 #endif
 
+#if defined(CLOCK_DRIVER_USE_TICKLESS_IDLE)
+/*
+ * In the tickless idle mode, the clock interrupt of a processor is programmed
+ * to the next watchdog expiration time while the processor executes the idle
+ * thread.  The driver must provide the following operations:
+ *
+ * Clock_driver_support_set_next_tick(ticks) programs the clock interrupt of
+ * the current processor to the ticks-th tick boundary after the current time.
+ * Each clock interrupt programs the next tick boundary with a value of one.
+ * The Clock_driver_support_at_tick() must not reload the timer in this mode.
+ *
+ * Clock_driver_support_wait_for_interrupt() is called with interrupts
+ * disabled and returns once an interrupt is pending, e.g. through a wfi
+ * instruction.
+ *
+ * The elapsed ticks are derived from the timecounter.  The boot processor
+ * must wind up the timecounter before its counter overflows, so the ticks a
+ * processor sleeps are limited to half of the timecounter period.  A driver
+ * may define CLOCK_DRIVER_TICKLESS_MAXIMUM_TICKS to impose a lower limit.
+ *
+ * A watchdog inserted by another processor which expires before the wake up
+ * time of a sleeping processor interrupts this processor, see
+ * _Watchdog_Insert().  Any interrupt lets the idle thread reprogram the clock
+ * interrupt to the next tick boundary and then to the new next watchdog
+ * expiration time.
+ */
+typedef struct {
+  /*
+   * The estimated uptime in nanoseconds of the clock interrupt programmed by
+   * the idle thread.
+   */
+  uint64_t expire;
+
+  /*
+   * Indicates that the clock interrupt was programmed beyond the next tick
+   * boundary.
+   */
+  bool idle;
+} Clock_driver_tickless_control;
+
+static Clock_driver_tickless_control
+Clock_driver_tickless[ CPU_MAXIMUM_PROCESSORS ];
+
+static uint64_t Clock_driver_tickless_uptime( void )
+{
+  struct timespec now;
+
+  _Timecounter_Nanouptime( &now );
+
+  return (uint64_t) now.tv_sec * 1000000000 + (uint64_t) now.tv_nsec;
+}
+
+static uint64_t Clock_driver_tickless_maximum_ticks( void )
+{
+#if defined(CLOCK_DRIVER_TICKLESS_MAXIMUM_TICKS)
+  return CLOCK_DRIVER_TICKLESS_MAXIMUM_TICKS;
+#else
+  struct timecounter *tc;
+  uint64_t            ticks;
+
+  tc = _Timecounter;
+  ticks = ( (uint64_t) tc->tc_counter_mask
+    * rtems_clock_get_ticks_per_second() ) / ( 2 * tc->tc_frequency );
+
+  return ticks > 0 ? ticks : 1;
+#endif
+}
+
+static Clock_driver_tickless_control *Clock_driver_tickless_get( void )
+{
+  return &Clock_driver_tickless[ _Per_CPU_Get_index( _Per_CPU_Get() ) ];
+}
+
+/*
+ * Accounts for the ticks which elapsed since the last announced tick.  This
+ * is called by the clock interrupt right before it announces one tick.
+ */
+static void Clock_driver_tickless_tick( void )
+{
+  _Watchdog_Tickless_tick( _Per_CPU_Get() );
+  Clock_driver_tickless_get()->idle = false;
+  Clock_driver_support_set_next_tick( 1 );
+}
+
+/*
+ * Accounts for all but the last of the tick boundaries which passed while
+ * the processor was idle.  The clock interrupt announces the last tick.  If
+ * some other interrupt woke up the processor, then the clock interrupt is
+ * programmed to the next tick boundary.  This is called with interrupts
+ * disabled, so that the other interrupts observe the current ticks.
+ */
+static void Clock_driver_tickless_wake_up(
+  Clock_driver_tickless_control *ctrl
+)
+{
+  uint64_t now;
+
+  _Watchdog_Tickless_wake_up( _Per_CPU_Get() );
+  now = Clock_driver_tickless_uptime();
+
+  /*
+   * Do not discard a pending or imminent clock interrupt.
+   */
+  if (
+    now + rtems_configuration_get_nanoseconds_per_tick() / 2 < ctrl->expire
+  ) {
+    ctrl->idle = false;
+    Clock_driver_support_set_next_tick( 1 );
+  }
+}
+
+void *_Clock_Tickless_idle_body( uintptr_t ignored )
+{
+  (void) ignored;
+
+#if defined(RTEMS_SMP)
+  _Watchdog_Tickless_idle_enabled = true;
+#endif
+
+  while ( true ) {
+    Clock_driver_tickless_control *ctrl;
+    ISR_Level                      level;
+    uint64_t                       ticks;
+    uint64_t                       maximum_ticks;
+
+    _ISR_Local_disable( level );
+
+    ctrl = Clock_driver_tickless_get();
+    ticks = _Watchdog_Ticks_until_next_expire( _Per_CPU_Get() );
+    maximum_ticks = Clock_driver_tickless_maximum_ticks();
+
+    if ( ticks > maximum_ticks ) {
+      ticks = maximum_ticks;
+    }
+
+    if ( ticks > 1 ) {
+      ctrl->expire = Clock_driver_tickless_uptime()
+        + ticks * rtems_configuration_get_nanoseconds_per_tick();
+      ctrl->idle = true;
+      Clock_driver_support_set_next_tick( ticks );
+    }
+
+    Clock_driver_support_wait_for_interrupt();
+
+    if ( ctrl->idle ) {
+      Clock_driver_tickless_wake_up( ctrl );
+    }
+
+    _ISR_Local_enable( level );
+  }
+
+  return NULL;
+}
+#endif
+
 /**
  * @brief ISRs until next clock tick
  */
@@ -175,6 +347,10 @@ rtems_isr Clock_isr(
      */
     Clock_driver_support_at_tick();
 
+    #if defined(CLOCK_DRIVER_USE_TICKLESS_IDLE)
+      Clock_driver_tickless_tick();
+    #endif
+
     #if CLOCK_DRIVER_ISRS_PER_TICK
       /*
        *  The driver is multiple ISRs per clock tick.
@@ -203,6 +203,62 @@ int mq_getattr(
   struct mq_attr *mqstat
 );
 
+/**
+ * @brief Sends multiple messages to a message queue.
+ *
+ * The messages are sent in order with the priority @a msg_prio.  Message
+ * @a i starts at @a msg_ptr plus @a i times @a msg_len and has the length
+ * @a msg_lens[ @a i ].  Sending stops at the first message which cannot be
+ * sent.  This function does not block if the message queue is full.
+ *
+ * @param mqdes The message queue descriptor.
+ * @param msg_ptr The buffer of the messages.
+ * @param msg_len The distance in bytes between consecutive messages.  It must
+ *   not be less than the mq_msgsize attribute of the message queue.
+ * @param msg_lens The lengths of the messages.
+ * @param count The count of messages to send.
+ * @param msg_prio The priority of the messages.
+ *
+ * @return The count of messages sent, or -1 if no message was sent and
+ *   errno indicates the error.
+ */
+int mq_send_batch_np(
+  mqd_t         mqdes,
+  const char   *msg_ptr,
+  size_t        msg_len,
+  const size_t *msg_lens,
+  unsigned int  count,
+  unsigned int  msg_prio
+);
+
+/**
+ * @brief Receives multiple messages from a message queue.
+ *
+ * Up to @a max_count pending messages are received in one critical section.
+ * If no message is pending and the message queue is in blocking mode, then the
+ * caller blocks until exactly one message arrives.  Message @a i is placed at
+ * @a msg_ptr plus @a i times @a msg_len.
+ *
+ * @param mqdes The message queue descriptor.
+ * @param[out] msg_ptr The buffer for the messages.
+ * @param msg_len The distance in bytes between consecutive messages.  It must
+ *   not be less than the mq_msgsize attribute of the message queue.
+ * @param[out] msg_lens The lengths of the received messages.
+ * @param[out] msg_prios The priorities of the received messages, or @c NULL.
+ * @param max_count The maximum count of messages to receive.
+ *
+ * @return The count of messages received, or -1 and errno indicates the
+ *   error.
+ */
+int mq_receive_batch_np(
+  mqd_t         mqdes,
+  char         *msg_ptr,
+  size_t        msg_len,
+  size_t       *msg_lens,
+  unsigned int *msg_prios,
+  unsigned int  max_count
+);
+
 /** @} */
 
 #ifdef __cplusplus
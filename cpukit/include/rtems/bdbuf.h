@@ -47,7 +47,7 @@ extern "C" {
  *
  * The Block Device Buffer Management implements a cache between the disk
  * devices and file systems.  The code provides read-ahead and write queuing to
- * the drivers and fast cache look-up using an AVL tree.
+ * the drivers and fast cache look-up using a hash table.
  *
  * The block size used by a file system can be set at runtime and must be a
  * multiple of the disk device block size.  The disk device's physical block
@@ -132,11 +132,11 @@ extern "C" {
  * Empty or cached buffers are added to the LRU list and removed from this
  * queue when a caller requests a buffer.  This is referred to as getting a
  * buffer in the code and the event get in the state diagram.  The buffer is
- * assigned to a block and inserted to the AVL based on the block/device key.
- * If the block is to be read by the user and not in the cache it is transfered
- * from the disk into memory.  If no buffers are on the LRU list the modified
- * list is checked.  If buffers are on the modified the swap out task will be
- * woken.  The request blocks until a buffer is available for recycle.
+ * assigned to a block and inserted to the hash table based on the block/device
+ * key.  If the block is to be read by the user and not in the cache it is
+ * transfered from the disk into memory.  If no buffers are on the LRU list the
+ * modified list is checked.  If buffers are on the modified the swap out task
+ * will be woken.  The request blocks until a buffer is available for recycle.
  *
  * A block being accessed is given to the file system layer and not accessible
  * to another requester until released back to the cache.  The same goes to a
@@ -151,6 +151,12 @@ extern "C" {
  * released as modified the user would have to block waiting until it had been
  * written.  This would be a performance problem.
  *
+ * The swap out task writes the modified buffers of one disk at a time in
+ * ascending block order.  Modified blocks are combined into multiple block
+ * write requests.  For disks which need continuous blocks in a multiple block
+ * request, small gaps between modified blocks may be filled with cached
+ * blocks, so that near-contiguous modified blocks are written in one request.
+ *
  * The code performs multiple block reads and writes.  Multiple block reads or
  * read-ahead increases performance with hardware that supports it.  It also
  * helps with a large cache as the disk head movement is reduced.  It however
@@ -160,6 +166,14 @@ extern "C" {
  * most-resent read-ahead transfer.  The read-ahead works per disk, but all
  * transfers are issued by the read-ahead task.
  *
+ * The hash table is divided into stripes with a lock each.  A read or get of a
+ * cached block and the release of such a buffer only lock the stripe of the
+ * block, so that hits of different blocks and disks may proceed in parallel.
+ * Such a buffer stays on the LRU list while it is accessed and is marked as
+ * referenced.  A referenced buffer gets a second chance and is moved to the
+ * end of its list before it is recycled.  All other operations lock the cache
+ * and all stripes.
+ *
  * The cache has the following lists of buffers:
  *  - LRU: Accessed or transfered buffers released in least recently used
  *  order.  Empty buffers will be placed to the front.
@@ -302,20 +316,15 @@ typedef struct rtems_bdbuf_group rtems_bdbuf_group;
 /**
  * To manage buffers we using buffer descriptors (BD). A BD holds a buffer plus
  * a range of other information related to managing the buffer in the cache. To
- * speed-up buffer lookup descriptors are organized in AVL-Tree. The fields
+ * speed-up buffer lookup descriptors are organized in a hash table. The fields
  * 'dd' and 'block' are search keys.
  */
 typedef struct rtems_bdbuf_buffer
 {
   rtems_chain_node link;       /**< Link the BD onto a number of lists. */
 
-  struct rtems_bdbuf_avl_node
-  {
-    struct rtems_bdbuf_buffer* left;   /**< Left Child */
-    struct rtems_bdbuf_buffer* right;  /**< Right Child */
-    signed char                cache;  /**< Cache */
-    signed char                bal;    /**< The balance of the sub-tree */
-  } avl;
+  struct rtems_bdbuf_buffer* hash_next; /**< Next BD in the hash table
+                                        * bucket. */
 
   rtems_disk_device *dd;        /**< disk device */
 
@@ -332,6 +341,21 @@ typedef struct rtems_bdbuf_buffer
   uint32_t hold_timer;           /**< Timer to indicate how long a buffer
                                   * has been held in the cache modified. */
 
+  bool frequent;                 /**< The buffer was hit since it was
+                                  * assigned to its block and belongs to the
+                                  * frequent queue of the 2Q replacement
+                                  * policy. */
+  uint32_t recent_sequence;      /**< The value of the recent queue sequence
+                                  * counter of the cache at the time the
+                                  * buffer was assigned to its block. */
+  bool lru_access;               /**< The buffer was obtained by a hit
+                                  * without the cache lock and is still on
+                                  * the LRU list or the frequent queue. */
+  bool referenced;               /**< The buffer was hit since it was put on
+                                  * the LRU list or the frequent queue and
+                                  * gets a second chance before it is
+                                  * recycled. */
+
   int   references;              /**< Allow reference counting by owner. */
   void* user;                    /**< User data. */
 } rtems_bdbuf_buffer;
@@ -354,6 +378,32 @@ struct rtems_bdbuf_group
   rtems_bdbuf_buffer* bdbuf;         /**< First BD this block covers. */
 };
 
+/**
+ * @brief Replacement policy of the buffer cache.
+ */
+typedef enum {
+  /**
+   * @brief Recycle the least recently used buffer.
+   */
+  RTEMS_BDBUF_REPLACEMENT_POLICY_LRU,
+
+  /**
+   * @brief Scan resistant 2Q replacement policy.
+   *
+   * New blocks enter the recent queue.  A buffer which is hit while it is in
+   * the cache is promoted to the frequent queue, unless the hit is within the
+   * correlated reference window.  This window covers the blocks which most
+   * recently entered the recent queue, a quarter of the buffer memory.  So a
+   * read followed by a write of the same block does not promote the block.
+   * Buffers are recycled from the recent queue first, so that blocks read once
+   * by a sequential scan do not evict blocks which are used repeatedly, for
+   * example file system metadata.  The frequent queue may use up to three
+   * quarters of the buffer memory.  Its least recently used buffers are
+   * demoted to the recent queue if it exceeds this limit.
+   */
+  RTEMS_BDBUF_REPLACEMENT_POLICY_2Q
+} rtems_bdbuf_replacement_policy;
+
 /**
  * Buffering configuration definition. See confdefs.h for support on using this
  * structure.
@@ -383,6 +433,13 @@ typedef struct rtems_bdbuf_config {
                                                 * allocation size. */
   rtems_task_priority read_ahead_priority;     /**< Priority of the read-ahead
                                                 * task. */
+  rtems_bdbuf_replacement_policy
+                      replacement_policy;      /**< Buffer replacement
+                                                * policy. */
+  uint32_t            max_write_gap_blocks;    /**< Maximum number of cached
+                                                * blocks written to fill a
+                                                * gap between modified
+                                                * blocks. */
 } rtems_bdbuf_config;
 
 /**
@@ -455,6 +512,18 @@ extern const rtems_bdbuf_config rtems_bdbuf_configuration;
  */
 #define RTEMS_BDBUF_BUFFER_MAX_SIZE_DEFAULT (4096)
 
+/**
+ * Default buffer replacement policy.
+ */
+#define RTEMS_BDBUF_REPLACEMENT_POLICY_DEFAULT \
+  RTEMS_BDBUF_REPLACEMENT_POLICY_LRU
+
+/**
+ * The default value for the maximum write gap blocks disables the write gap
+ * filling.
+ */
+#define RTEMS_BDBUF_MAX_WRITE_GAP_BLOCKS_DEFAULT 0
+
 /**
  * Prepare buffering layer to work - initialize buffer descritors and (if it is
  * neccessary) buffers. After initialization all blocks is placed into the
@@ -539,6 +608,36 @@ rtems_bdbuf_read (
   rtems_bdbuf_buffer** bd
 );
 
+/**
+ * Read consecutive blocks into a buffer provided by the user.  Blocks which are
+ * not in the cache are transferred from the disk directly into the user buffer
+ * with multiple block requests and are not added to the cache.  Blocks which
+ * are in the cache are copied from the cache since the cached data may be
+ * newer than the data on the disk.  This avoids the copy through the cache
+ * and the eviction of other blocks for large sequential reads.
+ *
+ * Before you can use this function, the rtems_bdbuf_init() routine must be
+ * called at least once to initialize the cache, otherwise a fatal error will
+ * occur.
+ *
+ * @param dd [in] The disk device.
+ * @param block [in] Linear media block number of the first block.
+ * @param block_count [in] The count of blocks to read.
+ * @param buffer [out] The user buffer.  It must have a size of at least the
+ * block count times the block size of the disk device.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ID Invalid block number or count.
+ * @retval RTEMS_IO_ERROR IO error.
+ */
+rtems_status_code
+rtems_bdbuf_read_direct (
+  rtems_disk_device *dd,
+  rtems_blkdev_bnum block,
+  uint32_t block_count,
+  void *buffer
+);
+
 /**
  * Release the buffer obtained by a read call back to the cache. If the buffer
  * was obtained by a get call and was not already in the cache the release
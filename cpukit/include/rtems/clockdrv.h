@@ -48,6 +48,20 @@ extern volatile uint32_t Clock_driver_ticks;
  */
 void _Clock_Initialize( void );
 
+/**
+ * @brief Idle thread body of clock drivers with tickless idle support.
+ *
+ * While the idle thread executes, the clock interrupt is programmed to the
+ * next watchdog expiration time of the processor.  A BSP with a clock driver
+ * which defines CLOCK_DRIVER_USE_TICKLESS_IDLE may use this function for
+ * CONFIGURE_IDLE_TASK_BODY.
+ *
+ * @param ignored This parameter is ignored.
+ *
+ * @return This function does not return.
+ */
+void *_Clock_Tickless_idle_body( uintptr_t ignored );
+
 /** @} */
 
 #ifdef __cplusplus
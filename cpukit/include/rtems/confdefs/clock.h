@@ -61,6 +61,12 @@
   #include <rtems/sysinit.h>
 #endif
 
+#ifdef CONFIGURE_WATCHDOG_TIMING_WHEEL
+  #include <rtems/confdefs/percpu.h>
+  #include <rtems/score/watchdogimpl.h>
+  #include <rtems/sysinit.h>
+#endif
+
 #ifndef CONFIGURE_MICROSECONDS_PER_TICK
   #define CONFIGURE_MICROSECONDS_PER_TICK 10000
 #endif
@@ -100,6 +106,16 @@ const uint32_t _Watchdog_Ticks_per_second =
     CONFIGURE_TICKS_PER_TIMESLICE;
 #endif
 
+#ifdef CONFIGURE_WATCHDOG_TIMING_WHEEL
+  Watchdog_Wheel _Watchdog_Wheels[ _CONFIGURE_MAXIMUM_PROCESSORS ];
+
+  RTEMS_SYSINIT_ITEM(
+    _Watchdog_Wheel_initialize,
+    RTEMS_SYSINIT_PER_CPU_DATA,
+    RTEMS_SYSINIT_ORDER_FIRST
+  );
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -172,6 +172,29 @@ extern "C" {
 
 const int imfs_memfile_bytes_per_block = CONFIGURE_IMFS_MEMFILE_BYTES_PER_BLOCK;
 
+#ifndef CONFIGURE_IMFS_DIRECTORY_INDEX_THRESHOLD
+  #define CONFIGURE_IMFS_DIRECTORY_INDEX_THRESHOLD 0
+#endif
+
+const size_t imfs_directory_index_threshold =
+  CONFIGURE_IMFS_DIRECTORY_INDEX_THRESHOLD;
+
+#ifdef CONFIGURE_FILESYSTEM_NAME_CACHE_ENTRIES
+  #if CONFIGURE_FILESYSTEM_NAME_CACHE_ENTRIES <= 0 || \
+    CONFIGURE_FILESYSTEM_NAME_CACHE_ENTRIES % RTEMS_FILESYSTEM_NAME_CACHE_WAYS != 0
+    #error "CONFIGURE_FILESYSTEM_NAME_CACHE_ENTRIES must be a positive multiple of RTEMS_FILESYSTEM_NAME_CACHE_WAYS"
+  #endif
+
+static rtems_filesystem_name_cache_entry
+  _Filesystem_Name_cache_entries[ CONFIGURE_FILESYSTEM_NAME_CACHE_ENTRIES ];
+
+const rtems_filesystem_name_cache_configuration
+  rtems_filesystem_name_cache = {
+    _Filesystem_Name_cache_entries,
+    CONFIGURE_FILESYSTEM_NAME_CACHE_ENTRIES / RTEMS_FILESYSTEM_NAME_CACHE_WAYS
+  };
+#endif
+
 static IMFS_fs_info_t IMFS_root_fs_info;
 
 static const rtems_filesystem_operations_table IMFS_root_ops = {
@@ -257,6 +280,8 @@ static const IMFS_mknod_controls IMFS_root_mknod_controls = {
   #endif
   #ifdef CONFIGURE_IMFS_DISABLE_MKNOD_FILE
     &IMFS_mknod_control_enosys,
+  #elif defined(CONFIGURE_IMFS_ENABLE_EXTENT_FILES)
+    &IMFS_mknod_control_extfile,
   #else
     &IMFS_mknod_control_memfile,
   #endif
@@ -45,7 +45,9 @@
 #include <rtems/confdefs/bsp.h>
 
 #if defined(CONFIGURE_MALLOC_BSP_SUPPORTS_SBRK) \
-  || defined(CONFIGURE_MALLOC_DIRTY)
+  || defined(CONFIGURE_MALLOC_DIRTY) \
+  || defined(CONFIGURE_MALLOC_PER_CPU_CACHE) \
+  || defined(CONFIGURE_MALLOC_SEGREGATED_FIT)
 #include <rtems/malloc.h>
 #endif
 
@@ -63,6 +65,18 @@ rtems_malloc_dirtier_t rtems_malloc_dirty_helper =
   rtems_malloc_dirty_memory;
 #endif
 
+#ifdef CONFIGURE_MALLOC_PER_CPU_CACHE
+const rtems_malloc_cache_handlers * const rtems_malloc_cache =
+  &rtems_malloc_per_cpu_cache;
+#endif
+
+#ifdef CONFIGURE_MALLOC_SEGREGATED_FIT
+static Heap_Free_index _Configure_Malloc_free_index;
+
+Heap_Free_index * const rtems_malloc_free_index =
+  &_Configure_Malloc_free_index;
+#endif
+
 #ifdef __cplusplus
 }
 #endif
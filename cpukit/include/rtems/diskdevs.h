@@ -59,7 +59,15 @@ typedef int (*rtems_block_device_ioctl)(
 #define RTEMS_DISK_READ_AHEAD_NO_TRIGGER ((rtems_blkdev_bnum) -1)
 
 /**
- * @brief Block device read-ahead control.
+ * @brief Count of read-ahead streams per block device.
+ */
+#define RTEMS_DISK_READ_AHEAD_STREAM_COUNT 4
+
+/**
+ * @brief Block device read-ahead stream.
+ *
+ * A stream tracks one sequential access pattern of a block device.  Several
+ * interleaved sequential readers of one block device use distinct streams.
  */
 typedef struct {
   /**
@@ -67,11 +75,17 @@ typedef struct {
    */
   rtems_chain_node node;
 
+  /**
+   * @brief The disk device of this stream.
+   */
+  rtems_disk_device *dd;
+
   /**
    * @brief Block value to trigger the read-ahead request.
    *
    * A value of @ref RTEMS_DISK_READ_AHEAD_NO_TRIGGER will disable further
-   * read-ahead requests since no valid block can have this value.
+   * read-ahead requests since no valid block can have this value.  A stream
+   * with this trigger value is free.
    */
   rtems_blkdev_bnum trigger;
 
@@ -82,6 +96,47 @@ typedef struct {
    * be arbitrary.
    */
   rtems_blkdev_bnum next;
+
+  /**
+   * @brief Start block of the last read-ahead request.
+   *
+   * The blocks from this block up to the next block were read ahead by this
+   * stream.  This value equals the next block in case no read-ahead request
+   * was issued since the stream started.
+   */
+  rtems_blkdev_bnum begin;
+
+  /**
+   * @brief Block count of the next read-ahead request.
+   *
+   * The window is doubled in case a read hits the trigger block of this
+   * stream and halved in case a read misses a block which should have been
+   * read ahead by this stream.  It is limited by the maximum read-ahead blocks
+   * of the block device buffer configuration.
+   */
+  uint32_t window;
+
+  /**
+   * @brief Value of the read-ahead clock at the last use of this stream.
+   *
+   * The least recently used stream is replaced by a new stream.
+   */
+  uint32_t age;
+} rtems_blkdev_read_ahead_stream;
+
+/**
+ * @brief Block device read-ahead control.
+ */
+typedef struct {
+  /**
+   * @brief The read-ahead streams.
+   */
+  rtems_blkdev_read_ahead_stream streams[RTEMS_DISK_READ_AHEAD_STREAM_COUNT];
+
+  /**
+   * @brief Clock to determine the least recently used stream.
+   */
+  uint32_t clock;
 } rtems_blkdev_read_ahead;
 
 /**
@@ -114,6 +169,40 @@ typedef struct {
    */
   uint32_t read_ahead_transfers;
 
+  /**
+   * @brief Read-ahead stream count.
+   *
+   * Count of sequential access patterns detected by the rtems_bdbuf_read()
+   * function.  Each detected pattern starts a new read-ahead stream.
+   */
+  uint32_t read_ahead_streams;
+
+  /**
+   * @brief Read-ahead hit count.
+   *
+   * A read-ahead hit occurs in the rtems_bdbuf_read() function in case the
+   * trigger block of a read-ahead stream is in the cached or modified state.
+   * The read-ahead window of the stream grows.
+   */
+  uint32_t read_ahead_hits;
+
+  /**
+   * @brief Read-ahead miss count.
+   *
+   * A read-ahead miss occurs in the rtems_bdbuf_read() function in case a
+   * block which should have been read ahead by a read-ahead stream is in the
+   * empty state.  The read-ahead window of the stream shrinks.
+   */
+  uint32_t read_ahead_misses;
+
+  /**
+   * @brief Direct read transfer count.
+   *
+   * Each direct read transfer issued by the rtems_bdbuf_read_direct() function
+   * may read multiple blocks into a user buffer.
+   */
+  uint32_t read_direct_transfers;
+
   /**
    * @brief Count of blocks transfered from the device.
    */
@@ -144,6 +233,54 @@ typedef struct {
    * Error count of transfers issued by write requests.
    */
   uint32_t write_errors;
+
+  /**
+   * @brief Write gap block count.
+   *
+   * Count of cached blocks which were written together with modified blocks
+   * to fill a gap between them.  This allows devices which need continuous
+   * blocks in a multiple block request to write near-contiguous modified
+   * blocks in one transfer.
+   */
+  uint32_t write_gap_blocks;
+
+  /**
+   * @brief Recent queue hit count.
+   *
+   * A recent queue hit occurs in the rtems_bdbuf_read() or rtems_bdbuf_get()
+   * functions in case the 2Q replacement policy is active and the block is in
+   * the cached or modified state and was not hit before.  The buffer is
+   * promoted to the frequent queue.
+   */
+  uint32_t recent_hits;
+
+  /**
+   * @brief Frequent queue hit count.
+   *
+   * A frequent queue hit occurs in the rtems_bdbuf_read() or rtems_bdbuf_get()
+   * functions in case the 2Q replacement policy is active and the block is in
+   * the cached or modified state and belongs to the frequent queue.
+   */
+  uint32_t frequent_hits;
+
+  /**
+   * @brief Recent queue miss count.
+   *
+   * A recent queue miss occurs in case the 2Q replacement policy is active and
+   * a block which is not in the cache gets a free buffer or a buffer recycled
+   * from the recent queue.  This includes the blocks of read-ahead requests.
+   */
+  uint32_t recent_misses;
+
+  /**
+   * @brief Frequent queue miss count.
+   *
+   * A frequent queue miss occurs in case the 2Q replacement policy is active
+   * and a block which is not in the cache gets a buffer recycled from the
+   * frequent queue, since no buffer of the recent queue can be used.  A high
+   * count indicates that most buffers of the recent queue are in use.
+   */
+  uint32_t frequent_misses;
 } rtems_blkdev_stats;
 
 /**
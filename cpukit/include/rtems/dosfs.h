@@ -287,6 +287,35 @@ typedef struct {
    * rtems_dosfs_create_utf8_converter().
    */
   rtems_dosfs_convert_control *converter;
+
+  /**
+   * @brief Enables the free cluster bitmap.
+   *
+   * The file system keeps one bit per data cluster in memory to indicate if
+   * the cluster is in use.  The bitmap is built by a single pass over the FAT
+   * in a task with the lowest priority of the scheduler, which is started by
+   * the mount.  Once the bitmap is complete, cluster allocations and
+   * statvfs() no longer read the FAT through the block device buffer cache to
+   * find free clusters.  The bitmap needs the count of data clusters divided
+   * by eight bytes of memory and the task needs one task object.  In case
+   * this memory is not available, then the file system works without the
+   * bitmap.  In case the task cannot be created, then the bitmap is built
+   * during the mount.
+   */
+  bool free_cluster_bitmap;
+
+  /**
+   * @brief Enables the directory name cache.
+   *
+   * The file system keeps a hash table of the names of recently used
+   * directories in memory.  The hash table of a directory is built by a single
+   * pass over the directory upon the first name lookup in it.  Afterwards a
+   * lookup reads only the directory cluster which contains the name, and a
+   * lookup of a name which does not exist reads no directory cluster at all.
+   * Creating a node adds the name to the hash table; removing or renaming a
+   * node drops the hash table of the directory.
+   */
+  bool name_cache;
 } rtems_dosfs_mount_options;
 
 /**
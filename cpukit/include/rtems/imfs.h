@@ -95,6 +95,11 @@ typedef block_p *block_ptr;
 #define IMFS_MEMFILE_MAXIMUM_SIZE \
   (LAST_TRIPLY_INDIRECT * IMFS_MEMFILE_BYTES_PER_BLOCK)
 
+/**
+ *  The default extent granule of extent files in bytes.
+ */
+#define IMFS_EXTFILE_DEFAULT_GRANULE 1024
+
 /** @} */
 
 /**
@@ -263,12 +268,16 @@ struct IMFS_jnode_tt {
   time_t              stat_mtime;            /* Time of last modification */
   time_t              stat_ctime;            /* Time of last status change */
   const IMFS_node_control *control;
+  IMFS_jnode_t       *Index_next;            /* Next node in index bucket */
 };
 
 typedef struct {
   IMFS_jnode_t                          Node;
   rtems_chain_control                   Entries;
   rtems_filesystem_mount_table_entry_t *mt_fs;
+  IMFS_jnode_t                        **Index;       /* Hash index or NULL */
+  size_t                                index_size;  /* Count of buckets */
+  size_t                                entry_count; /* Count of entries */
 } IMFS_directory_t;
 
 typedef struct {
@@ -302,14 +311,42 @@ typedef struct {
 typedef struct {
   IMFS_filebase_t File;
   block_p         direct;           /* pointer to file image */
+  size_t          map_count;        /* count of mappings of file image */
 } IMFS_linearfile_t;
 
+typedef struct {
+  uint8_t *data;                    /* contiguous extent data */
+  size_t   size;                    /* size of extent in bytes */
+} IMFS_extent_t;
+
+/**
+ *  IMFS "extfile" information
+ *
+ *  The data of an extent file is stored in a small array of contiguous
+ *  extents.  Each new extent is at least as large as all previous extents
+ *  together, so the extent count grows logarithmically with the file size.
+ *  The extent sizes are multiples of the extent granule of the file system
+ *  instance.  A granule which is at least the final file size yields a file
+ *  stored in one contiguous area.
+ *
+ *  A range of an extent file contained in one extent can be mapped with
+ *  mmap() and MAP_SHARED without a copy.
+ */
+typedef struct {
+  IMFS_filebase_t File;
+  IMFS_extent_t  *extents;          /* array of extents in file order */
+  size_t          extent_count;     /* count of extents */
+  size_t          capacity;         /* sum of extent sizes in bytes */
+  size_t          map_count;        /* count of mappings of extents */
+} IMFS_extfile_t;
+
 /* Support copy on write for linear files */
 typedef union {
   IMFS_jnode_t      Node;
   IMFS_filebase_t   File;
   IMFS_memfile_t    Memfile;
   IMFS_linearfile_t Linearfile;
+  IMFS_extfile_t    Extfile;
 } IMFS_file_t;
 
 typedef struct {
@@ -354,6 +391,11 @@ static inline IMFS_memfile_t *IMFS_iop_to_memfile( const rtems_libio_t *iop )
   return (IMFS_memfile_t *) iop->pathinfo.node_access;
 }
 
+static inline IMFS_extfile_t *IMFS_iop_to_extfile( const rtems_libio_t *iop )
+{
+  return (IMFS_extfile_t *) iop->pathinfo.node_access;
+}
+
 static inline time_t _IMFS_get_time( void )
 {
   struct bintime now;
@@ -399,6 +441,7 @@ typedef struct {
 typedef struct {
   IMFS_directory_t Root_directory;
   const IMFS_mknod_controls *mknod_controls;
+  size_t extent_granule;
 } IMFS_fs_info_t;
 
 typedef struct {
@@ -415,6 +458,7 @@ extern const IMFS_mknod_control IMFS_mknod_control_dir_default;
 extern const IMFS_mknod_control IMFS_mknod_control_dir_minimal;
 extern const IMFS_mknod_control IMFS_mknod_control_device;
 extern const IMFS_mknod_control IMFS_mknod_control_memfile;
+extern const IMFS_mknod_control IMFS_mknod_control_extfile;
 extern const IMFS_node_control IMFS_node_control_linfile;
 extern const IMFS_mknod_control IMFS_mknod_control_fifo;
 extern const IMFS_mknod_control IMFS_mknod_control_enosys;
@@ -425,6 +469,18 @@ extern const rtems_filesystem_limits_and_options_t  IMFS_LIMITS_AND_OPTIONS;
  *  Routines
  */
 
+/**
+ * @brief Initializes an IMFS instance.
+ *
+ * The data argument of mount() is NULL or a string of comma separated
+ * options:
+ * - "extent-files" selects extent files for regular files instead of block
+ *   based memfiles,
+ * - "extent-granule=N" sets the extent granule in bytes, see
+ *   IMFS_EXTFILE_DEFAULT_GRANULE.
+ *
+ * Unknown options are rejected with EINVAL.
+ */
 extern int IMFS_initialize(
    rtems_filesystem_mount_table_entry_t *mt_entry,
    const void                           *data
@@ -1037,6 +1093,54 @@ static inline void IMFS_Set_handlers( rtems_filesystem_location_info_t *loc )
   loc->handlers = node->control->handlers;
 }
 
+/**
+ * @brief Count of entries at which a directory gets a hash index.
+ *
+ * Directories with at least this count of entries use a hash index for name
+ * lookups.  The chain of entries is kept for the directory read order.  A
+ * value of zero disables the directory index.  Use
+ * CONFIGURE_IMFS_DIRECTORY_INDEX_THRESHOLD to set this value.
+ */
+extern const size_t imfs_directory_index_threshold;
+
+/**
+ * @brief Adds the node to the hash index of the directory.
+ *
+ * The hash index is created if it does not exist and grown if necessary.  In
+ * case no memory is available, the node is only added to the chain of
+ * entries and the hash index is removed.
+ *
+ * @param[in] dir The directory.
+ * @param[in] node The node already appended to the chain of entries.
+ */
+void IMFS_directory_index_add( IMFS_directory_t *dir, IMFS_jnode_t *node );
+
+/**
+ * @brief Removes the node from the hash index of the directory.
+ *
+ * The hash index is freed if the directory has no entries.
+ *
+ * @param[in] dir The directory.
+ * @param[in] node The node.
+ */
+void IMFS_directory_index_remove( IMFS_directory_t *dir, IMFS_jnode_t *node );
+
+/**
+ * @brief Searches the directory for an entry with the specified name.
+ *
+ * @param[in] dir The directory.
+ * @param[in] name The name.
+ * @param[in] namelen The name length in characters.
+ *
+ * @retval NULL No such entry exists.
+ * @retval other The entry.
+ */
+IMFS_jnode_t *IMFS_find_in_directory(
+  IMFS_directory_t *dir,
+  const char       *name,
+  size_t            namelen
+);
+
 static inline void IMFS_add_to_directory(
   IMFS_jnode_t *dir_node,
   IMFS_jnode_t *entry_node
@@ -1046,11 +1150,29 @@ static inline void IMFS_add_to_directory(
 
   entry_node->Parent = dir_node;
   rtems_chain_append_unprotected( &dir->Entries, &entry_node->Node );
+  ++dir->entry_count;
+
+  if (
+    dir->Index != NULL
+      || ( imfs_directory_index_threshold != 0
+        && dir->entry_count >= imfs_directory_index_threshold )
+  ) {
+    IMFS_directory_index_add( dir, entry_node );
+  }
 }
 
 static inline void IMFS_remove_from_directory( IMFS_jnode_t *node )
 {
+  IMFS_directory_t *dir;
+
   IMFS_assert( node->Parent != NULL );
+  dir = (IMFS_directory_t *) node->Parent;
+  --dir->entry_count;
+
+  if ( dir->Index != NULL ) {
+    IMFS_directory_index_remove( dir, node );
+  }
+
   node->Parent = NULL;
   rtems_chain_extract_unprotected( &node->Node );
 }
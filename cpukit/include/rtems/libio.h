@@ -999,6 +999,28 @@ typedef int (*rtems_filesystem_mmap_t)(
   off_t off
 );
 
+/**
+ * @brief Unmaps a shared mapping of a file.
+ *
+ * This handler is called by munmap() for each shared mapping of a regular
+ * file which was successfully established by the mmap handler.  It is called
+ * with the file system instance lock held and before the file location of
+ * the mapping is released.  A handler table without this handler, for example
+ * one initialized before the handler was added, behaves like
+ * rtems_filesystem_default_munmap().
+ *
+ * @param[in] loc The location of the mapped file.
+ * @param[in] addr The address of the mapping returned by the mmap handler.
+ * @param[in] len The length of the mapping.
+ *
+ * @see rtems_filesystem_default_munmap().
+ */
+typedef void (*rtems_filesystem_munmap_t)(
+  const rtems_filesystem_location_info_t *loc,
+  void *addr,
+  size_t len
+);
+
 /**
  * @brief File system node operations table.
  */
@@ -1019,6 +1041,7 @@ struct _rtems_filesystem_file_handlers_r {
   rtems_filesystem_readv_t readv_h;
   rtems_filesystem_writev_t writev_h;
   rtems_filesystem_mmap_t mmap_h;
+  rtems_filesystem_munmap_t munmap_h;
 };
 
 /**
@@ -1255,6 +1278,19 @@ int rtems_filesystem_default_mmap(
   off_t off
 );
 
+/**
+ * @brief Default MUNMAP handler.
+ *
+ * Does nothing.
+ *
+ * @see rtems_filesystem_munmap_t.
+ */
+void rtems_filesystem_default_munmap(
+  const rtems_filesystem_location_info_t *loc,
+  void *addr,
+  size_t len
+);
+
 /** @} */
 
 /**
@@ -1369,6 +1405,7 @@ typedef struct {
 #define LIBIO_FLAGS_WRITE         0x0004U  /* writing */
 #define LIBIO_FLAGS_OPEN          0x0100U  /* device is open */
 #define LIBIO_FLAGS_APPEND        0x0200U  /* all writes append */
+#define LIBIO_FLAGS_FREE          0x0400U  /* iop is on the free list */
 #define LIBIO_FLAGS_CLOSE_ON_EXEC 0x0800U  /* close on process exec() */
 #define LIBIO_FLAGS_READ_WRITE    (LIBIO_FLAGS_READ | LIBIO_FLAGS_WRITE)
 #define LIBIO_FLAGS_REFERENCE_INC 0x1000U
@@ -1863,6 +1900,91 @@ typedef struct {
 extern const rtems_filesystem_mount_configuration
   rtems_filesystem_root_configuration;
 
+/**
+ * @brief Count of entries of a name cache set.
+ *
+ * The count of name cache entries must be an integral multiple of this value.
+ */
+#define RTEMS_FILESYSTEM_NAME_CACHE_WAYS 4
+
+/**
+ * @brief Maximum length of a name held by the name cache.
+ *
+ * Longer names are not cached.
+ */
+#define RTEMS_FILESYSTEM_NAME_CACHE_NAME_MAX 30
+
+/**
+ * @brief Name cache entry.
+ *
+ * An entry maps the name of a directory entry to the node it refers to.  A
+ * negative entry records that the directory has no entry of this name.
+ */
+typedef struct {
+  /**
+   * @brief The file system instance of the entry or @c NULL for unused
+   * entries.
+   */
+  const rtems_filesystem_mount_table_entry_t *mt_entry;
+
+  /**
+   * @brief The node access of the directory.
+   */
+  const void *parent;
+
+  /**
+   * @brief The node access of the node referred to by the name.
+   */
+  void *node;
+
+  /**
+   * @brief The hash value of the instance, the directory and the name.
+   */
+  uint32_t hash;
+
+  /**
+   * @brief The name length in characters.
+   */
+  uint8_t namelen;
+
+  /**
+   * @brief Indicates a negative entry.
+   */
+  bool no_entry;
+
+  /**
+   * @brief The name.
+   */
+  char name[ RTEMS_FILESYSTEM_NAME_CACHE_NAME_MAX ];
+} rtems_filesystem_name_cache_entry;
+
+/**
+ * @brief Name cache configuration.
+ */
+typedef struct {
+  /**
+   * @brief The name cache entries.
+   */
+  rtems_filesystem_name_cache_entry *entries;
+
+  /**
+   * @brief The count of name cache sets.
+   *
+   * Each set has RTEMS_FILESYSTEM_NAME_CACHE_WAYS entries.  A set count of
+   * zero disables the name cache.
+   */
+  size_t set_count;
+} rtems_filesystem_name_cache_configuration;
+
+/**
+ * @brief The name cache configuration of the application.
+ *
+ * The name cache is disabled by default.  Use
+ * CONFIGURE_FILESYSTEM_NAME_CACHE_ENTRIES to provide name cache entries.
+ */
+extern const rtems_filesystem_name_cache_configuration
+  rtems_filesystem_name_cache;
+
 /** @} */
 
 /**
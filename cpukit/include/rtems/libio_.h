@@ -60,8 +60,33 @@ extern "C" {
 
 extern const uint32_t rtems_libio_number_iops;
 extern rtems_libio_t rtems_libio_iops[];
-extern void *rtems_libio_iop_free_head;
-extern void **rtems_libio_iop_free_tail;
+
+/**
+ * @brief The head of the lock-free free iop list.
+ *
+ * The lower bits selected by rtems_libio_iop_free_index_mask() contain the
+ * index plus one of the first free iop or zero if the list is empty.  The
+ * upper bits contain a generation count which changes with each list update
+ * to avoid the ABA problem.  The data1 member of a free iop references the
+ * next free iop.
+ */
+extern Atomic_Uint rtems_libio_iop_free_head;
+
+/**
+ * @brief Returns the mask of the iop index bits of the free iop list head.
+ */
+static inline unsigned int rtems_libio_iop_free_index_mask( void )
+{
+  unsigned int bits;
+
+  if ( rtems_libio_number_iops == 0 ) {
+    return 0;
+  }
+
+  bits = 32 - (unsigned int) __builtin_clz( rtems_libio_number_iops );
+
+  return ( 1U << bits ) - 1;
+}
 
 extern const rtems_filesystem_file_handlers_r rtems_filesystem_null_handlers;
 
@@ -385,6 +410,13 @@ void rtems_libio_free(
   rtems_libio_t *iop
 );
 
+/**
+ * @brief Returns the count of iops which are not on the free list.
+ *
+ * The count is only exact if no iops are allocated or freed concurrently.
+ */
+uint32_t rtems_libio_count_used_iops( void );
+
 /*
  *  File System Routine Prototypes
  */
@@ -505,6 +537,108 @@ void rtems_filesystem_eval_path_generic(
   const rtems_filesystem_eval_path_generic_config *config
 );
 
+typedef enum {
+  RTEMS_FILESYSTEM_NAME_CACHE_MISS,
+  RTEMS_FILESYSTEM_NAME_CACHE_HIT,
+  RTEMS_FILESYSTEM_NAME_CACHE_NO_ENTRY
+} rtems_filesystem_name_cache_status;
+
+/**
+ * @brief Looks up a name in the name cache.
+ *
+ * The name cache maps a directory and a name to the node access of the
+ * referred node.  File systems may use it in their eval token handler if the
+ * node access uniquely identifies a node of the file system instance while
+ * the node exists.  The file system instance must be locked.  The entries are
+ * invalidated by the corresponding file system operations, for example
+ * rename(), unlink() and unmount().
+ *
+ * The current and parent directory names are not cached.
+ *
+ * @param[in] parentloc The directory location.
+ * @param[in] name The name.
+ * @param[in] namelen The name length in characters.
+ * @param[out] node The node access of the node referred to by the name in
+ *   case of a cache hit.
+ *
+ * @retval RTEMS_FILESYSTEM_NAME_CACHE_MISS The name is not cached.
+ * @retval RTEMS_FILESYSTEM_NAME_CACHE_HIT The name is cached.
+ * @retval RTEMS_FILESYSTEM_NAME_CACHE_NO_ENTRY The directory has no entry of
+ *   this name.
+ */
+rtems_filesystem_name_cache_status rtems_filesystem_name_cache_lookup(
+  const rtems_filesystem_location_info_t *parentloc,
+  const char *name,
+  size_t namelen,
+  void **node
+);
+
+/**
+ * @brief Enters a name into the name cache.
+ *
+ * @param[in] parentloc The directory location.
+ * @param[in] name The name.
+ * @param[in] namelen The name length in characters.
+ * @param[in] node The node access of the node referred to by the name.
+ *
+ * @see rtems_filesystem_name_cache_lookup().
+ */
+void rtems_filesystem_name_cache_enter(
+  const rtems_filesystem_location_info_t *parentloc,
+  const char *name,
+  size_t namelen,
+  void *node
+);
+
+/**
+ * @brief Enters a negative entry into the name cache.
+ *
+ * @param[in] parentloc The directory location.
+ * @param[in] name The name.
+ * @param[in] namelen The name length in characters.
+ *
+ * @see rtems_filesystem_name_cache_lookup().
+ */
+void rtems_filesystem_name_cache_enter_no_entry(
+  const rtems_filesystem_location_info_t *parentloc,
+  const char *name,
+  size_t namelen
+);
+
+/**
+ * @brief Removes the entry of a name from the name cache.
+ *
+ * @param[in] parentloc The directory location.
+ * @param[in] name The name.
+ * @param[in] namelen The name length in characters.
+ */
+void rtems_filesystem_name_cache_remove(
+  const rtems_filesystem_location_info_t *parentloc,
+  const char *name,
+  size_t namelen
+);
+
+/**
+ * @brief Removes all entries of a node from the name cache.
+ *
+ * This removes the entries which refer to the node and the entries of the
+ * node if it is a directory.
+ *
+ * @param[in] loc The node location.
+ */
+void rtems_filesystem_name_cache_purge_node(
+  const rtems_filesystem_location_info_t *loc
+);
+
+/**
+ * @brief Removes all entries of a file system instance from the name cache.
+ *
+ * @param[in] mt_entry The file system instance.
+ */
+void rtems_filesystem_name_cache_purge_instance(
+  const rtems_filesystem_mount_table_entry_t *mt_entry
+);
+
 void rtems_filesystem_initialize(void);
 
 /**
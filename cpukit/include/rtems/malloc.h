@@ -75,6 +75,17 @@ void *rtems_heap_null_extend(
 
 extern const rtems_heap_extend_handler rtems_malloc_extend_handler;
 
+/**
+ * @brief The free block index of the C program heap.
+ *
+ * This pointer is @c NULL by default and the C program heap uses a first fit
+ * search.  Use CONFIGURE_MALLOC_SEGREGATED_FIT to provide a free block index
+ * which bounds the search time of allocations without alignment constraints.
+ *
+ * @see _Heap_Initialize_free_index().
+ */
+extern Heap_Free_index * const rtems_malloc_free_index;
+
 /*
  * Malloc Plugin to Dirty Memory at Allocation Time
  */
@@ -228,6 +239,127 @@ void *rtems_heap_greedy_allocate_all_except_largest(
  */
 void rtems_heap_greedy_free( void *opaque );
 
+/**
+ * @brief Statistics of the per-processor small object cache of the C program
+ * heap.
+ *
+ * @see rtems_malloc_cache_get_statistics().
+ */
+typedef struct {
+  /**
+   * @brief Count of allocations satisfied by the cache without acquiring the
+   * allocator mutex.
+   */
+  uint64_t hits;
+
+  /**
+   * @brief Count of allocations which found an empty magazine and had to
+   * refill it from the heap.
+   */
+  uint64_t misses;
+
+  /**
+   * @brief Count of frees absorbed by the cache without acquiring the
+   * allocator mutex.
+   */
+  uint64_t frees;
+
+  /**
+   * @brief Count of batch refills from the heap.
+   */
+  uint64_t refills;
+
+  /**
+   * @brief Count of batch drains to the heap.
+   */
+  uint64_t drains;
+
+  /**
+   * @brief Count of blocks currently held by the cache.
+   */
+  uintptr_t cached_blocks;
+
+  /**
+   * @brief Total allocatable bytes of the blocks currently held by the cache.
+   */
+  uintptr_t cached_bytes;
+} rtems_malloc_cache_statistics;
+
+/**
+ * @brief Handlers of a malloc() front-end cache.
+ *
+ * The cache is used by malloc(), free() and the related functions to satisfy
+ * small allocations without acquiring the allocator mutex.  The blocks held
+ * by the cache are ordinary allocated blocks of the C program heap.
+ */
+typedef struct {
+  /**
+   * @brief Allocates a block of at least the specified size from the cache.
+   *
+   * This handler is only called in a context which may obtain the allocator
+   * mutex.
+   *
+   * @return The begin address of the allocated memory area, or @c NULL if the
+   *   cache cannot satisfy the request.
+   */
+  void *( *allocate )( size_t size );
+
+  /**
+   * @brief Returns a block to the cache.
+   *
+   * This handler is only called in a context which may obtain the allocator
+   * mutex.
+   *
+   * @retval true The block is now owned by the cache.
+   * @retval false Otherwise, the block must be returned to the heap.
+   */
+  bool ( *free )( void *ptr );
+
+  /**
+   * @brief Returns the blocks held by the cache of all processors to the
+   * heap.
+   *
+   * This handler is called by the owner of the allocator mutex if an
+   * allocation from the heap failed.
+   */
+  void ( *drain )( void );
+
+  /**
+   * @brief Sums up the statistics of all processors.
+   */
+  void ( *get_statistics )( rtems_malloc_cache_statistics *statistics );
+} rtems_malloc_cache_handlers;
+
+/**
+ * @brief The malloc() front-end cache handlers of the application.
+ *
+ * This pointer is @c NULL by default.  Use CONFIGURE_MALLOC_PER_CPU_CACHE to
+ * enable the per-processor small object cache.
+ */
+extern const rtems_malloc_cache_handlers * const rtems_malloc_cache;
+
+/**
+ * @brief Per-processor small object cache.
+ *
+ * Each processor has a magazine of cached blocks for a set of size classes.
+ * Allocations and frees of small blocks only disable thread dispatching on the
+ * current processor.  Empty magazines are refilled and full magazines are
+ * drained in batches under the protection of the allocator mutex.
+ */
+extern const rtems_malloc_cache_handlers rtems_malloc_per_cpu_cache;
+
+/**
+ * @brief Gets the statistics of the malloc() front-end cache.
+ *
+ * @param[out] statistics The statistics.
+ *
+ * @retval true Successful operation.
+ * @retval false No malloc() front-end cache is configured.
+ */
+bool rtems_malloc_cache_get_statistics(
+  rtems_malloc_cache_statistics *statistics
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -270,7 +270,8 @@ int rtems_rfs_bitmap_map_clear_all (rtems_rfs_bitmap_control* control);
  * is performing by moving up from the seed for the window distance then to
  * search down from the seed for the window distance. This is repeated out
  * from the seed for each window until a free bit is found. The search is
- * performed by checking the search map to see if the map has a free bit.
+ * performed by checking the search map to see if the map has a free bit. The
+ * search map and the map are scanned an element at a time.
  *
  * @param[in] control is the map control.
  * @param[in] seed is the bit to search out from.
@@ -285,6 +286,29 @@ int rtems_rfs_bitmap_map_alloc (rtems_rfs_bitmap_control* control,
                                 bool*                     allocate,
                                 rtems_rfs_bitmap_bit*     bit);
 
+/**
+ * Allocate a run of contiguous free bits. The first free bit is found the
+ * same way as rtems_rfs_bitmap_map_alloc() and the run extends up from that
+ * bit until a set bit is found, the end of the map is reached or the number
+ * of bits wanted have been allocated.
+ *
+ * @param[in] control is the map control.
+ * @param[in] seed is the bit to search out from.
+ * @param[in] wanted is the maximum number of bits to allocate.
+ * @param[out] count will contain the number of bits allocated. It is 0 if no
+ *             free bit is found.
+ * @param[out] bit will contain the first bit of the run if the count is not
+ *             0.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_bitmap_map_alloc_run (rtems_rfs_bitmap_control* control,
+                                    rtems_rfs_bitmap_bit      seed,
+                                    size_t                    wanted,
+                                    size_t*                   count,
+                                    rtems_rfs_bitmap_bit*     bit);
+
 /**
  * Create a search bit map from the actual bit map.
  *
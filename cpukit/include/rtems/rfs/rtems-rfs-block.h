@@ -128,6 +128,19 @@ typedef struct rtems_rfs_block_map_s
    */
   rtems_rfs_block_no last_data_block;
 
+  /**
+   * The first block of the run of data blocks reserved for the map. The
+   * reserved blocks are allocated in the block bitmaps and are added to the
+   * map as it grows. The blocks still reserved are freed when the map is
+   * closed or shrinks.
+   */
+  rtems_rfs_block_no reserved_block;
+
+  /**
+   * The number of data blocks reserved for the map.
+   */
+  size_t reserved_count;
+
   /**
    * The block map.
    */
@@ -298,7 +311,8 @@ int rtems_rfs_block_map_next_block (rtems_rfs_file_system*  fs,
                                     rtems_rfs_buffer_block* block);
 
 /**
- * Grow the block map by the specified number of blocks.
+ * Grow the block map by the specified number of blocks. The blocks reserved
+ * for the map are used first.
  *
  * @param[in] fs is the file system data.
  * @param[in] map is a pointer to the open map to grow.
@@ -314,6 +328,35 @@ int rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
                               size_t                 blocks,
                               rtems_rfs_block_no*    new_block);
 
+/**
+ * Reserve a contiguous run of data blocks for the map to grow into. Nothing
+ * is reserved if the map already holds reserved blocks. The run can be shorter
+ * than the number of blocks wanted and nothing is reserved if the file system
+ * is full.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] map is a pointer to the open map.
+ * @param[in] blocks is the number of blocks wanted.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_block_map_reserve (rtems_rfs_file_system* fs,
+                                 rtems_rfs_block_map*   map,
+                                 size_t                 blocks);
+
+/**
+ * Free the data blocks reserved for the map.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] map is a pointer to the open map.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_block_map_unreserve (rtems_rfs_file_system* fs,
+                                   rtems_rfs_block_map*   map);
+
 /**
  * Grow the block map by the specified number of blocks.
  *
@@ -52,6 +52,23 @@
  */
 #define RTEMS_RFS_DIR_ENTRY_EMPTY (0xffff)
 
+/**
+ * Define the offsets of the fields of a directory index block. A directory
+ * with the RTEMS_RFS_INODE_FLAG_DIR_INDEX inode flag holds the index in its
+ * first block. The table maps the low depth bits of a name's hash to the
+ * directory block holding the entry. The other blocks are in the directory
+ * entry format.
+ */
+#define RTEMS_RFS_DIR_INDEX_MAGIC        (0x52464449) /**< The index magic. */
+#define RTEMS_RFS_DIR_INDEX_OFFSET_MAGIC (0)          /**< The magic offset. */
+#define RTEMS_RFS_DIR_INDEX_OFFSET_DEPTH (4)          /**< The depth offset. */
+#define RTEMS_RFS_DIR_INDEX_OFFSET_TABLE (8)          /**< The table offset. A
+                                                       * table entry is a
+                                                       * 16bit directory
+                                                       * block number. */
+#define RTEMS_RFS_DIR_INDEX_SLOT_SIZE    (2)          /**< The table entry
+                                                       * size. */
+
 /**
  * Return the hash of the entry.
  *
@@ -49,6 +49,21 @@
  */
 #define RTEMS_RFS_VERSION_MASK INT32_C(0x00000000)
 
+/**
+ * RFS Feature Flags. The features are held in the version number of the
+ * superblock. They are outside the version number mask so file systems with
+ * features can be opened by older code. A directory which uses a feature is
+ * marked in its inode flags and older code that does not check the flags may
+ * not handle it.
+ */
+#define RTEMS_RFS_VERSION_DIR_INDEX (1 << 0) /**< Directories are created with
+                                              * a hashed index. */
+
+/**
+ * RFS Feature Flags supported by this implementation.
+ */
+#define RTEMS_RFS_VERSION_FEATURES (RTEMS_RFS_VERSION_DIR_INDEX)
+
 /**
  * The root inode number. Do not use 0 as this has special meaning in some
  * Unix operating systems.
@@ -109,6 +124,44 @@ typedef int64_t rtems_rfs_pos_rel;
 #define RTEMS_RFS_FS_READ_ONLY         (1 << 3) /**< Make the mount
                                                  * read-only. Currently not
                                                  * supported. */
+#define RTEMS_RFS_FS_DIR_INDEX         (1 << 4) /**< Create directories with a
+                                                 * hashed index. Set from the
+                                                 * superblock features. */
+/**
+ * RFS Inode Cache. The cache holds copies of the inodes keyed by the ino. An
+ * inode is cached while a handle has it loaded and the most recently used
+ * unreferenced inodes are kept for later loads.
+ */
+typedef struct _rtems_rfs_inode_cache
+{
+  /**
+   * The hash table of cached inodes. The table is NULL if the cache is
+   * disabled.
+   */
+  rtems_chain_control* buckets;
+
+  /**
+   * The number of hash table buckets.
+   */
+  uint32_t bucket_count;
+
+  /**
+   * List of unreferenced cached inodes. The most recently used inode is at
+   * the head.
+   */
+  rtems_chain_control lru;
+
+  /**
+   * Number of inodes on the list of unreferenced cached inodes.
+   */
+  uint32_t lru_count;
+
+  /**
+   * Maximum number of unreferenced cached inodes.
+   */
+  uint32_t size;
+} rtems_rfs_inode_cache;
+
 /**
  * RFS File System data.
  */
@@ -215,6 +268,29 @@ struct _rtems_rfs_file_system
    */
   uint32_t max_held_buffers;
 
+  /**
+   * Number of data blocks a write that grows a file reserves past the blocks
+   * the write needs. The reserved blocks are held by the open file so
+   * streaming writes get contiguous blocks and are freed when the file is
+   * closed.
+   */
+  uint32_t file_reserve_blocks;
+
+  /**
+   * The lock of the buffer lists and the buffer reference counts.
+   */
+  rtems_rfs_mutex buffers_lock;
+
+  /**
+   * List of blocks requested from the I/O layer without the buffers lock.
+   */
+  rtems_chain_control buffers_pending;
+
+  /**
+   * Broadcast when a request of a pending block is complete.
+   */
+  rtems_rfs_condition buffers_pending_done;
+
   /**
    * List of buffers attached to buffer handles. Allows sharing.
    */
@@ -253,6 +329,11 @@ struct _rtems_rfs_file_system
    */
   rtems_chain_control file_shares;
 
+  /**
+   * The inode cache.
+   */
+  rtems_rfs_inode_cache inode_cache;
+
   /**
    * Pointer to user data supplied when opening.
    */
@@ -279,6 +360,13 @@ struct _rtems_rfs_file_system
  */
 #define rtems_rfs_fs_no_local_cache(_f) ((_f)->flags & RTEMS_RFS_FS_NO_LOCAL_CACHE)
 
+/**
+ * Are new directories created with a hashed index ?
+ *
+ * @param[in] _fs is a pointer to the file system.
+ */
+#define rtems_rfs_fs_dir_index(_f) ((_f)->flags & RTEMS_RFS_FS_DIR_INDEX)
+
 /**
  * The disk device number.
  *
@@ -27,6 +27,7 @@
 #include <rtems/rfs/rtems-rfs-data.h>
 #include <rtems/rfs/rtems-rfs-file-system.h>
 #include <rtems/rfs/rtems-rfs-inode.h>
+#include <rtems/rfs/rtems-rfs-mutex.h>
 
 /**
  * File data that is shared by various file handles accessing the same file. We
@@ -46,6 +47,13 @@ typedef struct _rtems_rfs_file_shared
    */
   int references;
 
+  /**
+   * The lock of the shared data and the block map. Held by the read, write,
+   * seek and truncate handlers in place of the file system lock so I/O to
+   * different files proceeds concurrently.
+   */
+  rtems_rfs_mutex lock;
+
   /**
    * The inode for the file.
    */
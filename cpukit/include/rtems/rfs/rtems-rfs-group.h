@@ -32,6 +32,7 @@
 #include <rtems/rfs/rtems-rfs-trace.h>
 #include <rtems/rfs/rtems-rfs-bitmaps.h>
 #include <rtems/rfs/rtems-rfs-buffer.h>
+#include <rtems/rfs/rtems-rfs-mutex.h>
 
 /**
  * Block allocations for a group on disk.
@@ -80,6 +81,12 @@ typedef struct _rtems_rfs_group
    */
   rtems_rfs_buffer_handle inode_bitmap_buffer;
 
+  /**
+   * The lock of the bitmaps. Allocations in different groups proceed
+   * concurrently.
+   */
+  rtems_rfs_mutex lock;
+
 } rtems_rfs_group;
 
 /**
@@ -139,6 +146,26 @@ int rtems_rfs_group_bitmap_alloc (rtems_rfs_file_system* fs,
                                   bool                   inode,
                                   rtems_rfs_bitmap_bit*  result);
 
+/**
+ * @brief Allocate a run of contiguous blocks.
+ *
+ * The groups are searched the same way as rtems_rfs_group_bitmap_alloc() and
+ * the run is taken from the group with the first available block. The run can
+ * be shorter than the number of blocks wanted.
+ *
+ * @param fs The file system data.
+ * @param goal The goal to seed the bitmap search.
+ * @param wanted The maximum number of blocks to allocate.
+ * @param result The first block of the run.
+ * @param count The number of blocks in the run.
+ * @retval int The error number (errno). No error if 0.
+ */
+int rtems_rfs_group_bitmap_alloc_run (rtems_rfs_file_system* fs,
+                                      rtems_rfs_bitmap_bit   goal,
+                                      size_t                 wanted,
+                                      rtems_rfs_bitmap_bit*  result,
+                                      size_t*                count);
+
 /**
  * @brief Free the group allocated bit.
  *
@@ -72,6 +72,12 @@
 #define RTEMS_RFS_S_SYMLINK \
   RTEMS_RFS_S_IFLNK | RTEMS_RFS_S_IRWXU | RTEMS_RFS_S_IRWXG | RTEMS_RFS_S_IRWXO
 
+/**
+ * Inode flags.
+ */
+#define RTEMS_RFS_INODE_FLAG_DIR_INDEX (1 << 0) /**< The directory has a hashed
+                                                 * index in its first block. */
+
 /**
  * The inode number or ino.
  */
@@ -115,7 +121,7 @@ typedef struct _rtems_rfs_inode
   uint32_t owner;
 
   /**
-   * Reserved.
+   * The flags of the node.
    */
   uint16_t flags;
 
@@ -175,6 +181,37 @@ typedef struct _rtems_rfs_inode
  */
 #define RTEMS_RFS_INODE_SIZE (sizeof (rtems_rfs_inode))
 
+/**
+ * RFS Inode Cache Entry.
+ */
+typedef struct _rtems_rfs_inode_cache_entry
+{
+  /**
+   * The node on the hash table chain.
+   */
+  rtems_chain_node hash_link;
+
+  /**
+   * The node on the list of unreferenced inodes.
+   */
+  rtems_chain_node lru_link;
+
+  /**
+   * The ino of the cached inode.
+   */
+  rtems_rfs_ino ino;
+
+  /**
+   * Number of handles with the inode loaded.
+   */
+  uint32_t references;
+
+  /**
+   * The copy of the inode.
+   */
+  rtems_rfs_inode node;
+} rtems_rfs_inode_cache_entry;
+
 /**
  * RFS Inode Handle.
  */
@@ -215,6 +252,11 @@ typedef struct _rtems_rfs_inode_handle
    */
   int loads;
 
+  /**
+   * The inode cache entry if the inode is loaded from the cache else NULL.
+   */
+  rtems_rfs_inode_cache_entry* cached;
+
 } rtems_rfs_inode_handle;
 
 /**
@@ -646,6 +688,27 @@ int rtems_rfs_inode_unload (rtems_rfs_file_system*  fs,
                             rtems_rfs_inode_handle* handle,
                             bool                    update_ctime);
 
+/**
+ * Open the inode cache. Loaded inodes are copied into the cache and written
+ * back to the media when the last load of a modified inode is released.
+ *
+ * @param[in] fs is the file system.
+ * @param[in] size is the number of unreferenced inodes held by the cache. A
+ *                 size of 0 disables the cache.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_inode_cache_open (rtems_rfs_file_system* fs,
+                                uint32_t               size);
+
+/**
+ * Close the inode cache and free the cached inodes. No inode can be loaded.
+ *
+ * @param[in] fs is the file system.
+ */
+void rtems_rfs_inode_cache_close (rtems_rfs_file_system* fs);
+
 /**
  * Create an inode allocating, initialising and adding an entry to the parent
  * directory.
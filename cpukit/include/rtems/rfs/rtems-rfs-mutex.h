@@ -96,4 +96,61 @@ rtems_rfs_mutex_unlock (rtems_rfs_mutex* mutex)
   return 0;
 }
 
+/**
+ * RFS Condition type.
+ */
+#if __rtems__
+typedef rtems_condition_variable rtems_rfs_condition;
+#else
+typedef uint32_t rtems_rfs_condition; /* place holder */
+#endif
+
+/**
+ * @brief Create the condition.
+ *
+ * @param[in] cond is a pointer to the condition to create.
+ *
+ * @retval 0 Successful operation.
+ */
+int rtems_rfs_condition_create (rtems_rfs_condition* cond);
+
+/**
+ * @brief Destroy the condition.
+ *
+ * @param[in] cond is a pointer to the condition to destroy.
+ *
+ * @retval 0 Successful operation.
+ */
+int rtems_rfs_condition_destroy (rtems_rfs_condition* cond);
+
+/**
+ * @brief Wait for the condition.
+ *
+ * The mutex must be locked by the caller. It is unlocked while the caller
+ * waits and locked again before the function returns.
+ *
+ * @param[in] cond is a pointer to the condition to wait for.
+ * @param[in] mutex is a pointer to the mutex which protects the condition.
+ */
+static inline void
+rtems_rfs_condition_wait (rtems_rfs_condition* cond, rtems_rfs_mutex* mutex)
+{
+#if __rtems__
+  _Condition_Wait_recursive(cond, mutex);
+#endif
+}
+
+/**
+ * @brief Wake up all waiters of the condition.
+ *
+ * @param[in] cond is a pointer to the condition to signal.
+ */
+static inline void
+rtems_rfs_condition_broadcast (rtems_rfs_condition* cond)
+{
+#if __rtems__
+  rtems_condition_variable_broadcast(cond);
+#endif
+}
+
 #endif
@@ -65,6 +65,12 @@ typedef struct _rtems_rfs_format_config
    */
   bool initialise_inodes;
 
+  /**
+   * Create directories with a hashed index. The lookup and creation of an
+   * entry reads a fixed number of blocks independent of the directory size.
+   */
+  bool dir_index;
+
   /**
    * Is the format verbose.
    */
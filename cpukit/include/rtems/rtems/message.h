@@ -207,6 +207,180 @@ rtems_status_code rtems_message_queue_receive(
   rtems_interval  timeout
 );
 
+/**
+ * @brief Sends multiple messages to the message queue.
+ *
+ * The messages are sent in order with one critical section for all messages
+ * which are not received by a waiting task.  Message @a i of @a count
+ * messages starts at @a buffer plus @a i times the maximum message size of
+ * the message queue and has the size @a sizes[ @a i ].  Sending stops at the
+ * first message which cannot be sent.
+ *
+ * @param id The message queue ID.
+ * @param buffer The buffer of the messages.
+ * @param sizes The sizes of the messages.
+ * @param count The count of messages to send.
+ * @param[out] sent The count of messages sent.
+ *
+ * @retval RTEMS_SUCCESSFUL All messages were sent.
+ * @retval RTEMS_INVALID_ID Invalid message queue ID.
+ * @retval RTEMS_INVALID_ADDRESS The buffer, sizes or sent pointer is @c NULL.
+ * @retval RTEMS_INVALID_SIZE A message size is greater than the maximum
+ *   message size of the message queue.
+ * @retval RTEMS_TOO_MANY The message queue is full.
+ * @retval RTEMS_ILLEGAL_ON_REMOTE_OBJECT The message queue is a remote object.
+ */
+rtems_status_code rtems_message_queue_send_batch(
+  rtems_id      id,
+  const void   *buffer,
+  const size_t *sizes,
+  uint32_t      count,
+  uint32_t     *sent
+);
+
+/**
+ * @brief Receives multiple messages from the message queue.
+ *
+ * This directive receives up to @a maximum_count pending messages in one
+ * critical section.  If no messages are outstanding and the option set
+ * indicates that the task is willing to block, then the task will be blocked
+ * until a message arrives or until, optionally, timeout clock ticks have
+ * passed.  A blocked task receives exactly one message.  Message @a i is
+ * placed at @a buffer plus @a i times the maximum message size of the message
+ * queue and its size is stored in @a sizes[ @a i ].
+ *
+ * @param id The message queue ID.
+ * @param[out] buffer The buffer for the message contents.  The buffer must be
+ *   large enough to store @a maximum_count maximum size messages of this
+ *   message queue.
+ * @param[out] sizes The sizes of the messages.  The array must have
+ *   @a maximum_count elements.
+ * @param maximum_count The maximum count of messages to receive.
+ * @param[out] count The count of messages received.
+ * @param option_set The option set, e.g. RTEMS_NO_WAIT or RTEMS_WAIT.
+ * @param timeout The number of ticks to wait if the RTEMS_WAIT is set.  Use
+ *   RTEMS_NO_TIMEOUT to wait indefinitely.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ID Invalid message queue ID.
+ * @retval RTEMS_INVALID_ADDRESS The buffer, sizes or count pointer is
+ *   @c NULL.
+ * @retval RTEMS_INVALID_NUMBER The maximum count is zero.
+ * @retval RTEMS_UNSATISFIED No message is available and RTEMS_NO_WAIT is set.
+ * @retval RTEMS_TIMEOUT A timeout occurred and no message was received.
+ * @retval RTEMS_ILLEGAL_ON_REMOTE_OBJECT The message queue is a remote object.
+ */
+rtems_status_code rtems_message_queue_receive_batch(
+  rtems_id        id,
+  void           *buffer,
+  size_t         *sizes,
+  uint32_t        maximum_count,
+  uint32_t       *count,
+  rtems_option    option_set,
+  rtems_interval  timeout
+);
+
+/**
+ * @brief Gets a message buffer from the message queue.
+ *
+ * The message buffer is loaned to the caller, so that a message can be
+ * composed in place and sent without a copy of the message content by
+ * rtems_message_queue_send_buffer().  The message buffer is large enough to
+ * store maximum size messages of this message queue.  A loaned message buffer
+ * which is not sent must be returned by rtems_message_queue_release_buffer().
+ * All loaned message buffers must be returned before the message queue is
+ * deleted.
+ *
+ * @param id The message queue ID.
+ * @param[out] buffer The begin address of the loaned message buffer.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ID Invalid message queue ID.
+ * @retval RTEMS_INVALID_ADDRESS The buffer pointer is @c NULL.
+ * @retval RTEMS_TOO_MANY No message buffer is available.
+ * @retval RTEMS_ILLEGAL_ON_REMOTE_OBJECT The message queue is a remote object.
+ */
+rtems_status_code rtems_message_queue_get_buffer(
+  rtems_id   id,
+  void     **buffer
+);
+
+/**
+ * @brief Sends a loaned message buffer to the message queue.
+ *
+ * The message buffer must be loaned from this message queue by
+ * rtems_message_queue_get_buffer() or rtems_message_queue_receive_buffer().
+ * The message content is not copied unless a task waits in
+ * rtems_message_queue_receive().  In case of success, the ownership of the
+ * message buffer returns to the message queue.
+ *
+ * @param id The message queue ID.
+ * @param buffer The begin address of the loaned message buffer.
+ * @param size The size of the message.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ID Invalid message queue ID.
+ * @retval RTEMS_INVALID_ADDRESS The buffer is not a message buffer loaned
+ *   from this message queue.
+ * @retval RTEMS_INVALID_SIZE The message size is greater than the maximum
+ *   message size of the message queue.  The message buffer is still loaned.
+ * @retval RTEMS_ILLEGAL_ON_REMOTE_OBJECT The message queue is a remote object.
+ */
+rtems_status_code rtems_message_queue_send_buffer(
+  rtems_id  id,
+  void     *buffer,
+  size_t    size
+);
+
+/**
+ * @brief Receives a message from the message queue without a copy.
+ *
+ * This directive works like rtems_message_queue_receive(), however, the
+ * message buffer containing the message is loaned to the calling task instead
+ * of a copy of the message content.  The loaned message buffer must be
+ * returned by rtems_message_queue_release_buffer() or
+ * rtems_message_queue_send_buffer().
+ *
+ * @param id The message queue ID.
+ * @param[out] buffer The begin address of the loaned message buffer.
+ * @param[out] size The size of the message.
+ * @param option_set The option set, e.g. RTEMS_NO_WAIT or RTEMS_WAIT.
+ * @param timeout The number of ticks to wait if the RTEMS_WAIT is set.  Use
+ *   RTEMS_NO_TIMEOUT to wait indefinitely.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ID Invalid message queue ID.
+ * @retval RTEMS_INVALID_ADDRESS The buffer pointer or the message size
+ *   pointer is @c NULL.
+ * @retval RTEMS_UNSATISFIED No message is available and RTEMS_NO_WAIT is set.
+ * @retval RTEMS_TIMEOUT A timeout occurred and no message was received.
+ * @retval RTEMS_ILLEGAL_ON_REMOTE_OBJECT The message queue is a remote object.
+ */
+rtems_status_code rtems_message_queue_receive_buffer(
+  rtems_id         id,
+  void           **buffer,
+  size_t          *size,
+  rtems_option     option_set,
+  rtems_interval   timeout
+);
+
+/**
+ * @brief Returns a loaned message buffer to the message queue.
+ *
+ * @param id The message queue ID.
+ * @param buffer The begin address of the loaned message buffer.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ID Invalid message queue ID.
+ * @retval RTEMS_INVALID_ADDRESS The buffer is not a message buffer loaned
+ *   from this message queue.
+ * @retval RTEMS_ILLEGAL_ON_REMOTE_OBJECT The message queue is a remote object.
+ */
+rtems_status_code rtems_message_queue_release_buffer(
+  rtems_id  id,
+  void     *buffer
+);
+
 /**
  *  @brief rtems_message_queue_flush
  *
@@ -68,6 +68,17 @@ extern "C" {
  */
 typedef int CORE_message_queue_Submit_types;
 
+/**
+ * @brief Thread wait option of a thread which waits to receive a loaned
+ * message buffer.
+ *
+ * A thread blocked in _CORE_message_queue_Seize_buffer() gets the message
+ * buffer itself instead of a copy of the message content.
+ *
+ * @see _CORE_message_queue_Dequeue_receiver().
+ */
+#define CORE_MESSAGE_QUEUE_RECEIVE_LOANED UINT32_MAX
+
 /**
  * @brief Initializes a message queue.
  *
@@ -260,11 +271,153 @@ Status_Control _CORE_message_queue_Seize(
   Thread_queue_Context       *queue_context
 );
 
+/**
+ * @brief Submits multiple messages to the message queue.
+ *
+ * The messages are submitted in one critical section as long as no waiting
+ * receiver is satisfied.  The caller does not block if the message queue is
+ * full.  Submission stops at the first message which cannot be submitted.
+ * A notification handler is invoked at most once.
+ *
+ * @param[in, out] the_message_queue The message queue to operate upon.
+ * @param buffer The starting address of the first message to send.
+ * @param stride The distance in bytes between the starting addresses of
+ *        consecutive messages.
+ * @param sizes The sizes of the messages.
+ * @param count The count of messages to send.
+ * @param[out] sent The count of messages successfully submitted.
+ * @param submit_type Determines whether the messages are prepended,
+ *        appended, or enqueued in priority order.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL All messages were successfully submitted to the message queue.
+ * @retval STATUS_MESSAGE_INVALID_SIZE A message size was too big.
+ * @retval STATUS_TOO_MANY No message buffers were available.
+ */
+Status_Control _CORE_message_queue_Submit_multiple(
+  CORE_message_queue_Control       *the_message_queue,
+  const void                       *buffer,
+  size_t                            stride,
+  const size_t                     *sizes,
+  uint32_t                          count,
+  uint32_t                         *sent,
+  CORE_message_queue_Submit_types   submit_type,
+  Thread_queue_Context             *queue_context
+);
+
+/**
+ * @brief Seizes multiple messages from the message queue.
+ *
+ * Up to @a maximum_count pending messages are dequeued in one critical
+ * section.  The thread will be blocked if no message is pending and wait is
+ * true.  A blocked thread receives exactly one message.
+ *
+ * @param[in, out] the_message_queue The message queue to seize messages from.
+ * @param executing The executing thread.
+ * @param[out] buffer The starting address of the buffer for the first
+ *        message.
+ * @param stride The distance in bytes between the starting addresses of
+ *        consecutive message buffers.  It must not be less than the maximum
+ *        message size of the message queue.
+ * @param[out] sizes The sizes of the received messages.
+ * @param[out] priorities The priorities of the received messages, or
+ *        @c NULL.
+ * @param maximum_count The maximum count of messages to receive.  It must
+ *        not be zero.
+ * @param[out] count The count of received messages.
+ * @param wait Indicates whether the calling thread is willing to block
+ *        if the message queue is empty.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL At least one message was successfully seized from the message queue.
+ * @retval STATUS_UNSATISFIED Wait was set to false and there is currently no pending message.
+ * @retval STATUS_TIMEOUT A timeout occured.
+ */
+Status_Control _CORE_message_queue_Seize_multiple(
+  CORE_message_queue_Control      *the_message_queue,
+  Thread_Control                  *executing,
+  void                            *buffer,
+  size_t                           stride,
+  size_t                          *sizes,
+  CORE_message_queue_Submit_types *priorities,
+  uint32_t                         maximum_count,
+  uint32_t                        *count,
+  bool                             wait,
+  Thread_queue_Context            *queue_context
+);
+
+/**
+ * @brief Submits a loaned message buffer to the message queue.
+ *
+ * The message buffer must be obtained by _CORE_message_queue_Loan_message_buffer()
+ * or _CORE_message_queue_Seize_buffer() from this message queue.  The message
+ * content is not copied if the message is pending or if the receiver waits
+ * for a loaned message buffer.  In any case, the ownership of the message
+ * buffer returns to the message queue.
+ *
+ * This function must not be used for message queues with blocking senders.
+ *
+ * @param[in, out] the_message_queue The message queue to operate upon.
+ * @param[in, out] the_message The loaned message buffer to submit.
+ * @param size The size of the message.
+ * @param submit_type Determines whether the message is prepended,
+ *        appended, or enqueued in priority order.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL The message was successfully submitted to the message queue.
+ * @retval STATUS_MESSAGE_INVALID_SIZE The message size was too big.
+ */
+Status_Control _CORE_message_queue_Submit_buffer(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  size_t                             size,
+  CORE_message_queue_Submit_types    submit_type,
+  Thread_queue_Context              *queue_context
+);
+
+/**
+ * @brief Seizes a message from the message queue without a copy.
+ *
+ * This function dequeues a message and loans its message buffer to the
+ * executing thread.  The thread will be blocked if wait is true, otherwise an
+ * error will be given to the thread if no messages are available.  The loaned
+ * message buffer must be returned by _CORE_message_queue_Submit_buffer() or
+ * _CORE_message_queue_Free_message_buffer().
+ *
+ * This function must not be used for message queues with blocking senders.
+ *
+ * @param[in, out] the_message_queue The message queue to seize a message from.
+ * @param executing The executing thread.
+ * @param[out] buffer_p The begin address of the loaned message content.
+ * @param[out] size_p The size of the message.
+ * @param wait Indicates whether the calling thread is willing to block
+ *        if the message queue is empty.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL The message was successfully seized from the message queue.
+ * @retval STATUS_UNSATISFIED Wait was set to false and there is currently no pending message.
+ * @retval STATUS_TIMEOUT A timeout occured.
+ */
+Status_Control _CORE_message_queue_Seize_buffer(
+  CORE_message_queue_Control  *the_message_queue,
+  Thread_Control              *executing,
+  void                       **buffer_p,
+  size_t                      *size_p,
+  bool                         wait,
+  Thread_queue_Context        *queue_context
+);
+
 /**
  * @brief Inserts a message into the message queue.
  *
  * Copies the specified content into the message storage space and then
  * inserts the message into the message queue according to the submit type.
+ * The content is not copied if the content source is the message storage
+ * space itself.
  *
  * @param[in, out] the_message_queue The message queue to insert a message in.
  * @param[in, out] the_message The message to insert in the message queue.
@@ -451,6 +604,78 @@ RTEMS_INLINE_ROUTINE void _CORE_message_queue_Free_message_buffer (
   _Chain_Append_unprotected( &the_message_queue->Inactive_messages, &the_message->Node );
 }
 
+/**
+ * @brief Loans a message buffer from the inactive message buffer chain.
+ *
+ * The loaned message buffer is set off chain to distinguish it from inactive
+ * and pending message buffers.
+ *
+ * @param the_message_queue The message queue to operate upon.
+ *
+ * @retval pointer The loaned message buffer.
+ * @retval NULL The inactive message buffer chain is empty.
+ */
+RTEMS_INLINE_ROUTINE CORE_message_queue_Buffer_control *
+_CORE_message_queue_Loan_message_buffer(
+  CORE_message_queue_Control *the_message_queue
+)
+{
+  CORE_message_queue_Buffer_control *the_message;
+
+  the_message =
+    _CORE_message_queue_Allocate_message_buffer( the_message_queue );
+
+  if ( the_message != NULL ) {
+    _Chain_Set_off_chain( &the_message->Node );
+  }
+
+  return the_message;
+}
+
+/**
+ * @brief Gets the loaned message buffer of the message content.
+ *
+ * @param the_message_queue The message queue to operate upon.
+ * @param buffer The begin address of the message content.
+ *
+ * @retval pointer The loaned message buffer.
+ * @retval NULL The address is not the message content of a message buffer
+ *   currently loaned from this message queue.
+ */
+RTEMS_INLINE_ROUTINE CORE_message_queue_Buffer_control *
+_CORE_message_queue_Get_loaned_buffer(
+  const CORE_message_queue_Control *the_message_queue,
+  const void                       *buffer
+)
+{
+  CORE_message_queue_Buffer_control *the_message;
+  size_t                             align_mask;
+  size_t                             buffer_size;
+  uintptr_t                          offset;
+
+  align_mask = sizeof( uintptr_t ) - 1;
+  buffer_size = ( ( the_message_queue->maximum_message_size + align_mask )
+    & ~align_mask ) + sizeof( CORE_message_queue_Buffer_control );
+  the_message = RTEMS_CONTAINER_OF(
+    buffer,
+    CORE_message_queue_Buffer_control,
+    Contents.buffer
+  );
+  offset = (uintptr_t) the_message
+    - (uintptr_t) the_message_queue->message_buffers;
+
+  if (
+    (uintptr_t) the_message < (uintptr_t) the_message_queue->message_buffers
+      || offset / buffer_size >= the_message_queue->maximum_pending_messages
+      || offset % buffer_size != 0
+      || !_Chain_Is_node_off_chain( &the_message->Node )
+  ) {
+    return NULL;
+  }
+
+  return the_message;
+}
+
 /**
  * @brief Gets message priority.
  *
@@ -544,21 +769,30 @@ RTEMS_INLINE_ROUTINE
  * This method dequeues the first locked thread waiting to receive a message,
  *      dequeues it and returns the corresponding Thread_Control.
  *
+ * A thread waiting for a loaned message buffer gets the message buffer
+ * @a the_message, or if it is @c NULL, a message buffer allocated from the
+ * inactive message buffer chain.  Otherwise, the message is copied to the
+ * buffer of the thread and @a the_message is freed, if it is not @c NULL.
+ *
  * @param[in, out] the_message_queue The message queue to operate upon.
+ * @param[in, out] the_message The loaned message buffer containing the
+ *   message, or @c NULL.
  * @param buffer The buffer that is copied to the threads mutable_object.
  * @param size The size of the buffer.
  * @param submit_type Indicates whether the thread should be willing to block in the future.
  * @param queue_context The thread queue context.
  *
  * @retval thread The Thread_Control for the first locked thread, if there is a locked thread.
- * @retval NULL There are pending messages or no thread waiting to receive.
+ * @retval NULL There are pending messages, no thread waiting to receive, or
+ *   no message buffer for a thread waiting for a loaned message buffer.
  */
 RTEMS_INLINE_ROUTINE Thread_Control *_CORE_message_queue_Dequeue_receiver(
-  CORE_message_queue_Control      *the_message_queue,
-  const void                      *buffer,
-  size_t                           size,
-  CORE_message_queue_Submit_types  submit_type,
-  Thread_queue_Context            *queue_context
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  const void                        *buffer,
+  size_t                             size,
+  CORE_message_queue_Submit_types    submit_type,
+  Thread_queue_Context              *queue_context
 )
 {
   Thread_Control *the_thread;
@@ -587,15 +821,40 @@ RTEMS_INLINE_ROUTINE Thread_Control *_CORE_message_queue_Dequeue_receiver(
     return NULL;
   }
 
+  if ( the_thread->Wait.option == CORE_MESSAGE_QUEUE_RECEIVE_LOANED ) {
+    if ( the_message == NULL ) {
+      the_message =
+        _CORE_message_queue_Loan_message_buffer( the_message_queue );
+
+      if ( the_message == NULL ) {
+        return NULL;
+      }
+
+      _CORE_message_queue_Copy_buffer(
+        buffer,
+        the_message->Contents.buffer,
+        size
+      );
+    }
+
+    the_message->Contents.size = size;
+    *(void **) the_thread->Wait.return_argument_second.mutable_object =
+      the_message->Contents.buffer;
+  } else {
+    _CORE_message_queue_Copy_buffer(
+      buffer,
+      the_thread->Wait.return_argument_second.mutable_object,
+      size
+    );
+
+    if ( the_message != NULL ) {
+      _CORE_message_queue_Free_message_buffer( the_message_queue, the_message );
+    }
+  }
+
    *(size_t *) the_thread->Wait.return_argument = size;
    the_thread->Wait.count = (uint32_t) submit_type;
 
-  _CORE_message_queue_Copy_buffer(
-    buffer,
-    the_thread->Wait.return_argument_second.mutable_object,
-    size
-  );
-
   _Thread_queue_Extract_critical(
     &the_message_queue->Wait_queue.Queue,
     the_message_queue->operations,
@@ -312,6 +312,63 @@ struct Heap_Block {
   Heap_Block *prev;
 };
 
+/**
+ * @brief Shift value to get the count of second level size classes of the
+ * free block index.
+ */
+#define HEAP_FREE_INDEX_SECOND_LEVEL_SHIFT 3
+
+/**
+ * @brief Count of second level size classes of the free block index.
+ *
+ * Each power of two range of block sizes is divided into this count of size
+ * classes.
+ */
+#define HEAP_FREE_INDEX_SECOND_LEVEL_COUNT \
+  (1U << HEAP_FREE_INDEX_SECOND_LEVEL_SHIFT)
+
+/**
+ * @brief Count of first level size classes of the free block index.
+ *
+ * Blocks larger than the largest first level size class share the last size
+ * class.
+ */
+#define HEAP_FREE_INDEX_FIRST_LEVEL_COUNT 32
+
+/**
+ * @brief Segregated fit free block index.
+ *
+ * The free block index is an optional extension of a heap.  It provides an
+ * O(1) search for a free block of a requested size (two-level segregated fit).
+ * The free blocks are still maintained in the free list of the heap, however,
+ * the free list is ordered by ascending size classes.  The index contains the
+ * first free block of each size class and bitmaps of the non-empty size
+ * classes.
+ *
+ * @see _Heap_Initialize_free_index().
+ */
+typedef struct {
+  /**
+   * @brief Bitmap of first level size classes with at least one non-empty
+   * second level size class.
+   */
+  uint32_t first_level_bitmap;
+
+  /**
+   * @brief Bitmaps of the non-empty second level size classes for each first
+   * level size class.
+   */
+  uint32_t second_level_bitmap[ HEAP_FREE_INDEX_FIRST_LEVEL_COUNT ];
+
+  /**
+   * @brief The first free block in the free list of each size class.
+   *
+   * This is @c NULL for empty size classes.
+   */
+  Heap_Block *first[ HEAP_FREE_INDEX_FIRST_LEVEL_COUNT ]
+    [ HEAP_FREE_INDEX_SECOND_LEVEL_COUNT ];
+} Heap_Free_index;
+
 /**
  * @brief Control block used to manage a heap.
  */
@@ -324,6 +381,14 @@ struct Heap_Control {
   Heap_Block *first_block;
   Heap_Block *last_block;
   Heap_Statistics stats;
+
+  /**
+   * @brief The optional free block index.
+   *
+   * In case this pointer is @c NULL, then the free list is searched first fit.
+   */
+  Heap_Free_index *free_index;
+
   #ifdef HEAP_PROTECTION
     Heap_Protection Protection;
   #endif
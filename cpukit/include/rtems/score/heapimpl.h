@@ -98,6 +98,63 @@ uintptr_t _Heap_Initialize(
   uintptr_t page_size
 );
 
+/**
+ * @brief Initializes the segregated fit free block index of the heap.
+ *
+ * Afterwards the heap uses the free block index to search for free blocks
+ * with a bounded worst-case time for requests without alignment and boundary
+ * constraints.  The free blocks currently present in the heap are added to
+ * the index.  This function must be called after _Heap_Initialize() since
+ * the heap initialization clears the free block index reference.
+ *
+ * @param[in, out] heap The heap control block.
+ * @param[out] index The free block index storage.  It must be valid during the
+ *   lifetime of the heap.
+ */
+void _Heap_Initialize_free_index( Heap_Control *heap, Heap_Free_index *index );
+
+/**
+ * @brief Inserts the free block into the free list ordered by the size
+ * classes of the free block index.
+ *
+ * The block size must be valid.
+ *
+ * @param[in, out] heap The heap control block.
+ * @param[in, out] block The free block to insert.
+ */
+void _Heap_Free_index_insert( Heap_Control *heap, Heap_Block *block );
+
+/**
+ * @brief Removes the free block from the free list and the free block index.
+ *
+ * The block size must be equal to the block size at insertion time.
+ *
+ * @param[in, out] heap The heap control block.
+ * @param[in, out] block The free block to remove.
+ */
+void _Heap_Free_index_remove( Heap_Control *heap, Heap_Block *block );
+
+/**
+ * @brief Returns the first free block which should be considered to satisfy
+ * a request of the specified block size.
+ *
+ * This is the first block of the first non-empty size class which contains
+ * only blocks of at least the specified size.  In case no such size class
+ * exists, then it is the first block of the size class of the specified size
+ * (this size class may contain large enough blocks).  Since the free list is
+ * ordered by ascending size classes, a search may continue with the next
+ * blocks in the free list.
+ *
+ * @param[in] heap The heap control block.
+ * @param block_size The requested block size.
+ *
+ * @return The first block to consider or the free list tail.
+ */
+Heap_Block *_Heap_Free_index_search(
+  Heap_Control *heap,
+  uintptr_t block_size
+);
+
 /**
  * @brief Allocates an aligned memory area with boundary constraint.
  *
@@ -562,6 +619,134 @@ RTEMS_INLINE_ROUTINE void _Heap_Free_list_insert_before(
   block_next->prev = new_block;
 }
 
+/**
+ * @brief Maps the block size to the size class of the free block index.
+ *
+ * @param size The block size.
+ * @param[out] first_level The first level size class.
+ * @param[out] second_level The second level size class.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_index_mapping(
+  uintptr_t size,
+  uint32_t *first_level,
+  uint32_t *second_level
+)
+{
+  if ( size < HEAP_FREE_INDEX_SECOND_LEVEL_COUNT ) {
+    *first_level = 0;
+    *second_level = (uint32_t) size;
+  } else {
+    uint32_t msb;
+    uint32_t shift;
+    uint32_t fl;
+
+    msb = (uint32_t) ( sizeof( unsigned long ) * 8 - 1 )
+      - (uint32_t) __builtin_clzl( (unsigned long) size );
+    shift = msb - HEAP_FREE_INDEX_SECOND_LEVEL_SHIFT;
+    fl = shift + 1;
+
+    if ( fl < HEAP_FREE_INDEX_FIRST_LEVEL_COUNT ) {
+      *first_level = fl;
+      *second_level = (uint32_t) ( size >> shift )
+        - HEAP_FREE_INDEX_SECOND_LEVEL_COUNT;
+    } else {
+      *first_level = HEAP_FREE_INDEX_FIRST_LEVEL_COUNT - 1;
+      *second_level = HEAP_FREE_INDEX_SECOND_LEVEL_COUNT - 1;
+    }
+  }
+}
+
+/**
+ * @brief Inserts a free block into the free list of the heap.
+ *
+ * The block size must be valid.
+ *
+ * @param[in, out] heap The heap control block.
+ * @param[in, out] block_before The anchor in the free list which is used if
+ *   the heap has no free block index.
+ * @param[in, out] new_block The free block to insert.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_insert(
+  Heap_Control *heap,
+  Heap_Block *block_before,
+  Heap_Block *new_block
+)
+{
+  if ( heap->free_index == NULL ) {
+    _Heap_Free_list_insert_after( block_before, new_block );
+  } else {
+    _Heap_Free_index_insert( heap, new_block );
+  }
+}
+
+/**
+ * @brief Removes a free block from the free list of the heap.
+ *
+ * The block size must be unchanged since the insertion.
+ *
+ * @param[in, out] heap The heap control block.
+ * @param[in, out] block The free block to remove.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_remove(
+  Heap_Control *heap,
+  Heap_Block *block
+)
+{
+  if ( heap->free_index == NULL ) {
+    _Heap_Free_list_remove( block );
+  } else {
+    _Heap_Free_index_remove( heap, block );
+  }
+}
+
+/**
+ * @brief Replaces a free block in the free list of the heap by another.
+ *
+ * The block size of the new block must be valid.
+ *
+ * @param[in, out] heap The heap control block.
+ * @param[in, out] old_block The free block to replace.
+ * @param[in, out] new_block The new free block.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_replace(
+  Heap_Control *heap,
+  Heap_Block *old_block,
+  Heap_Block *new_block
+)
+{
+  if ( heap->free_index == NULL ) {
+    _Heap_Free_list_replace( old_block, new_block );
+  } else {
+    _Heap_Free_index_remove( heap, old_block );
+    _Heap_Free_index_insert( heap, new_block );
+  }
+}
+
+/**
+ * @brief Changes the size of a free block which is in the free list of the
+ * heap.
+ *
+ * The previous block is marked as used.
+ *
+ * @param[in, out] heap The heap control block.
+ * @param[in, out] block The free block.
+ * @param size The new block size.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_resize(
+  Heap_Control *heap,
+  Heap_Block *block,
+  uintptr_t size
+)
+{
+  if ( heap->free_index == NULL ) {
+    block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+  } else {
+    _Heap_Free_index_remove( heap, block );
+    block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+    _Heap_Free_index_insert( heap, block );
+  }
+}
+
 /**
  * @brief Checks if the value is aligned to the given alignment.
  *
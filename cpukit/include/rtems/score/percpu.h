@@ -472,6 +472,29 @@ typedef struct Per_CPU_Control {
      * @see Per_CPU_Watchdog_index.
      */
     Watchdog_Header Header[ PER_CPU_WATCHDOG_COUNT ];
+
+    /**
+     * @brief The uptime in nanoseconds of the last tick accounted in the
+     * tickless idle mode, or zero if this mode is not used.
+     *
+     * @see _Watchdog_Tickless_tick().
+     */
+    uint64_t tickless_last;
+
+    #if defined( RTEMS_SMP )
+      /**
+       * @brief The watchdog ticks up to which this processor sleeps in the
+       * tickless idle mode, or zero if it does not sleep.
+       *
+       * The watchdog ticks of this processor stand still while it sleeps.
+       * Other processors which insert a watchdog account for the elapsed
+       * ticks first.  If the watchdog expires earlier, then they interrupt
+       * this processor, so that it reprograms its clock interrupt.
+       *
+       * @see _Watchdog_Ticks_until_next_expire() and _Watchdog_Insert().
+       */
+      uint64_t sleep_until;
+    #endif
   } Watchdog;
 
   #if defined( RTEMS_SMP )
@@ -65,6 +65,52 @@ typedef void Watchdog_Service_routine;
 typedef Watchdog_Service_routine
   ( *Watchdog_Service_routine_entry )( Watchdog_Control * );
 
+/**
+ * @brief Count of bits of the slot index of one timing wheel level.
+ */
+#define WATCHDOG_WHEEL_LEVEL_BITS 6
+
+/**
+ * @brief Count of slots of one timing wheel level.
+ */
+#define WATCHDOG_WHEEL_SLOT_COUNT ( 1U << WATCHDOG_WHEEL_LEVEL_BITS )
+
+/**
+ * @brief Count of timing wheel levels.
+ *
+ * Watchdogs which expire more than 2**24 ticks in the future are kept on a
+ * far future chain.
+ */
+#define WATCHDOG_WHEEL_LEVEL_COUNT 4
+
+/**
+ * @brief Hierarchical timing wheel to manage scheduled watchdogs.
+ *
+ * The slots of level N cover a range of 2**(6 * N) ticks each.  Watchdogs are
+ * appended to the slot of the lowest level which covers their expiration time,
+ * so the insert and remove operations have a constant execution time.  The
+ * slots of the higher levels are cascaded to the lower levels once their
+ * range begins.
+ *
+ * @see CONFIGURE_WATCHDOG_TIMING_WHEEL.
+ */
+typedef struct Watchdog_Wheel {
+  /**
+   * @brief The next tick to process.
+   */
+  uint64_t next;
+
+  /**
+   * @brief Slots of the timing wheel levels.
+   */
+  Chain_Control Slots[ WATCHDOG_WHEEL_LEVEL_COUNT ][ WATCHDOG_WHEEL_SLOT_COUNT ];
+
+  /**
+   * @brief Watchdogs which expire beyond the range of the highest level.
+   */
+  Chain_Control Far_future;
+} Watchdog_Wheel;
+
 /**
  * @brief The watchdog header to manage scheduled watchdogs.
  */
@@ -79,6 +125,14 @@ typedef struct {
    * case no watchdog is scheduled.
    */
   RBTree_Node *first;
+
+  /**
+   * @brief The timing wheel used instead of the red-black tree or NULL.
+   *
+   * If this member is not NULL, then the members Watchdogs and first are
+   * unused.
+   */
+  Watchdog_Wheel *wheel;
 } Watchdog_Header;
 
 /**
@@ -100,7 +154,8 @@ struct Watchdog_Control {
 
     /**
      * @brief this field is a chain node structure and allows this to be placed
-     * on a chain used to manage pending watchdogs by the timer server.
+     * on a chain used to manage pending watchdogs by the timer server or on a
+     * slot of a timing wheel.
      */
     Chain_Node Chain;
   } Node;
@@ -24,6 +24,7 @@
 #include <rtems/score/watchdog.h>
 #include <rtems/score/watchdogticks.h>
 #include <rtems/score/assert.h>
+#include <rtems/score/chainimpl.h>
 #include <rtems/score/isrlock.h>
 #include <rtems/score/percpu.h>
 #include <rtems/score/rbtreeimpl.h>
@@ -103,6 +104,35 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Header_initialize(
 {
   _RBTree_Initialize_empty( &header->Watchdogs );
   header->first = NULL;
+  header->wheel = NULL;
+}
+
+/**
+ * @brief Initializes the watchdog header to use the timing wheel.
+ *
+ * @param[out] header The header to initialize.
+ * @param[out] wheel The timing wheel to initialize.
+ * @param now The current time of the timing wheel.
+ */
+RTEMS_INLINE_ROUTINE void _Watchdog_Header_initialize_wheel(
+  Watchdog_Header *header,
+  Watchdog_Wheel  *wheel,
+  uint64_t         now
+)
+{
+  uint32_t level;
+  uint32_t slot;
+
+  for ( level = 0; level < WATCHDOG_WHEEL_LEVEL_COUNT; ++level ) {
+    for ( slot = 0; slot < WATCHDOG_WHEEL_SLOT_COUNT; ++slot ) {
+      _Chain_Initialize_empty( &wheel->Slots[ level ][ slot ] );
+    }
+  }
+
+  _Chain_Initialize_empty( &wheel->Far_future );
+  wheel->next = now + 1;
+  _Watchdog_Header_initialize( header );
+  header->wheel = wheel;
 }
 
 /**
@@ -139,6 +169,84 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Header_destroy(
  */
 void _Watchdog_Tick( struct Per_CPU_Control *cpu );
 
+/**
+ * @brief Accounts for the ticks which elapsed since the last tick of the
+ * processor in the tickless idle mode.
+ *
+ * This function is used by the tickless idle support of clock drivers right
+ * before the clock interrupt announces one tick through _Watchdog_Tick().  The
+ * elapsed ticks are derived from the uptime and the uptime of the last tick.
+ * The ticks which elapsed while the clock interrupt was suppressed are
+ * skipped.  Watchdogs which expired in the skipped ticks are processed by the
+ * next _Watchdog_Tick().
+ *
+ * @param cpu The processor of the watchdog ticks.  It shall be the current
+ *   processor.
+ */
+void _Watchdog_Tickless_tick( struct Per_CPU_Control *cpu );
+
+/**
+ * @brief Accounts for all but the last of the tick boundaries which passed
+ * since the last tick of the processor in the tickless idle mode.
+ *
+ * The watchdog lock of the processor shall be held by the caller.  The last
+ * tick boundary is accounted by the next _Watchdog_Tickless_tick().
+ *
+ * @param cpu The processor of the watchdog ticks.
+ *
+ * @return The count of tick boundaries which passed since the last tick of the
+ *   processor, or zero if the processor did not account a tick yet.
+ */
+uint64_t _Watchdog_Tickless_forward( struct Per_CPU_Control *cpu );
+
+/**
+ * @brief Accounts for the ticks which elapsed while the processor was
+ * idle in the tickless idle mode.
+ *
+ * This function is used by the tickless idle support of clock drivers once an
+ * interrupt woke up the processor.  It acquires the watchdog lock and calls
+ * _Watchdog_Tickless_forward().
+ *
+ * @param cpu The processor of the watchdog ticks.  It shall be the current
+ *   processor.
+ */
+void _Watchdog_Tickless_wake_up( struct Per_CPU_Control *cpu );
+
+#if defined(RTEMS_SMP)
+/**
+ * @brief Indicates that a processor may sleep in the tickless idle mode.
+ *
+ * The tickless idle support of clock drivers shall set this indicator before
+ * the first call to _Watchdog_Ticks_until_next_expire().  Otherwise,
+ * _Watchdog_Insert() does not check if the processor of the watchdog sleeps.
+ */
+extern bool _Watchdog_Tickless_idle_enabled;
+#endif
+
+/**
+ * @brief Gets the count of ticks until the next watchdog of the processor
+ * expires.
+ *
+ * All watchdog headers of the processor are considered.  The result may be
+ * less than the actual count of ticks, but never greater.
+ *
+ * In SMP configurations, the processor is considered to sleep up to the
+ * returned ticks until its next _Watchdog_Tick(), see
+ * _Watchdog_Tickless_idle_enabled.  In this time,
+ * _Watchdog_Insert() on another processor interrupts it if the new watchdog
+ * expires earlier.  So, the caller should be the idle thread of the processor
+ * right before it waits for an interrupt with interrupts disabled.
+ *
+ * @param cpu The processor of the watchdogs.
+ *
+ * @retval 1 The processor did not account a tick with
+ *   _Watchdog_Tickless_tick() yet.
+ * @retval WATCHDOG_MAXIMUM_TICKS No watchdog is scheduled.
+ * @retval other The count of ticks relative to the current watchdog ticks of
+ *   the processor.  This is at least one.
+ */
+uint64_t _Watchdog_Ticks_until_next_expire( struct Per_CPU_Control *cpu );
+
 /**
  * @brief Gets the state of the watchdog.
  *
@@ -275,7 +383,12 @@ void _Watchdog_Do_tickle(
  * @brief Inserts a watchdog into the set of scheduled watchdogs according to
  * the specified expiration time.
  *
- * The watchdog must be inactive.
+ * The watchdog must be inactive.  In case the header uses a timing wheel, then
+ * the watchdog is inserted into the timing wheel.
+ *
+ * In SMP configurations, the processor of the watchdog is interrupted if it
+ * sleeps in the tickless idle mode beyond the expiration time of the watchdog,
+ * see _Watchdog_Ticks_until_next_expire().
  *
  * @param[in, out] header The set of scheduler watchdogs to insert into.
  * @param[in, out] the_watchdog The watchdog to insert.
@@ -291,7 +404,8 @@ void _Watchdog_Insert(
  * @brief In the case the watchdog is scheduled, then it is removed from the set of
  * scheduled watchdogs.
  *
- * The watchdog must be initialized before this call.
+ * The watchdog must be initialized before this call.  In case the header uses
+ * a timing wheel, then the watchdog is removed from the timing wheel.
  *
  * @param[in, out] header The scheduled watchdogs.
  * @param[in, out] the_watchdog The watchdog to remove.
@@ -301,6 +415,89 @@ void _Watchdog_Remove(
   Watchdog_Control *the_watchdog
 );
 
+/**
+ * @brief Initializes the timing wheels of the processors.
+ *
+ * The timing wheels are provided by the application configuration via
+ * CONFIGURE_WATCHDOG_TIMING_WHEEL.  Each processor uses its timing wheel for
+ * the watchdogs of the PER_CPU_WATCHDOG_TICKS header.
+ */
+void _Watchdog_Wheel_initialize( void );
+
+/**
+ * @brief The timing wheels of the processors.
+ *
+ * This array is defined by the application configuration.  It has one
+ * element for each configured processor.
+ */
+extern Watchdog_Wheel _Watchdog_Wheels[];
+
+/**
+ * @brief Inserts a watchdog into the timing wheel according to the specified
+ * expiration time.
+ *
+ * The watchdog must be inactive.
+ *
+ * @param[in, out] wheel The timing wheel to insert into.
+ * @param[in, out] the_watchdog The watchdog to insert.
+ * @param expire The expiration time for the watchdog.
+ */
+void _Watchdog_Wheel_insert(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog,
+  uint64_t          expire
+);
+
+/**
+ * @brief In the case the watchdog is scheduled, then it is removed from the
+ * timing wheel.
+ *
+ * @param[in, out] the_watchdog The watchdog to remove.
+ */
+void _Watchdog_Wheel_remove( Watchdog_Control *the_watchdog );
+
+/**
+ * @brief Gets the tick at which the next watchdog of the timing wheel expires.
+ *
+ * For watchdogs on the slots of the higher levels this is the tick at which
+ * their slot is cascaded to the lower levels.
+ *
+ * @param wheel The timing wheel.
+ *
+ * @retval WATCHDOG_MAXIMUM_TICKS The timing wheel is empty.
+ * @retval other The tick at which the next watchdog expires at the earliest.
+ */
+uint64_t _Watchdog_Wheel_next_expire( const Watchdog_Wheel *wheel );
+
+/**
+ * @brief Calls the routine of each expired watchdog of the timing wheel.
+ *
+ * All ticks up to and including the current time are processed.
+ *
+ * @param[in, out] wheel The timing wheel.
+ * @param now The current time to check the expiration time against.
+ * @param lock The lock that is released before calling the routine and then
+ *      acquired after the call.
+ * @param lock_context The lock context for the release before calling the
+ *      routine and for the acquire after.
+ */
+void _Watchdog_Wheel_do_tickle(
+  Watchdog_Wheel   *wheel,
+  uint64_t          now,
+#if defined(RTEMS_SMP)
+  ISR_lock_Control *lock,
+#endif
+  ISR_lock_Context *lock_context
+);
+
+#if defined(RTEMS_SMP)
+  #define _Watchdog_Wheel_tickle( wheel, now, lock, lock_context ) \
+    _Watchdog_Wheel_do_tickle( wheel, now, lock, lock_context )
+#else
+  #define _Watchdog_Wheel_tickle( wheel, now, lock, lock_context ) \
+    _Watchdog_Wheel_do_tickle( wheel, now, lock_context )
+#endif
+
 /**
  * @brief In the case the watchdog is scheduled, then it is removed from the set of
  * scheduled watchdogs.
@@ -607,6 +804,7 @@ RTEMS_INLINE_ROUTINE uint64_t _Watchdog_Per_CPU_insert_ticks(
   _Watchdog_Per_CPU_acquire_critical( cpu, &lock_context );
   expire = ticks + cpu->Watchdog.ticks;
   _Watchdog_Insert(header, the_watchdog, expire);
+  expire = the_watchdog->expire;
   _Watchdog_Per_CPU_release_critical( cpu, &lock_context );
   return expire;
 }
@@ -635,6 +833,7 @@ RTEMS_INLINE_ROUTINE uint64_t _Watchdog_Per_CPU_insert(
 
   _Watchdog_Per_CPU_acquire_critical( cpu, &lock_context );
   _Watchdog_Insert( header, the_watchdog, expire );
+  expire = the_watchdog->expire;
   _Watchdog_Per_CPU_release_critical( cpu, &lock_context );
   return expire;
 }
@@ -0,0 +1,263 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPISPSC
+ *
+ * @brief Single-Producer/Single-Consumer Channel API
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SPSC_H
+#define _RTEMS_SPSC_H
+
+#include <rtems/rtems/options.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/types.h>
+#include <rtems/score/atomic.h>
+#include <rtems/score/cpu.h>
+#include <rtems/score/threadq.h>
+
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RTEMSAPISPSC Single-Producer/Single-Consumer Channel
+ *
+ * @ingroup RTEMSAPI
+ *
+ * @brief A wait-free ring buffer of fixed size messages for exactly one
+ * producer and exactly one consumer.
+ *
+ * The producer may be an interrupt handler or a thread on another processor.
+ * Sending a message never blocks and uses no locks unless the consumer waits
+ * for a message.  The consumer may block on a thread queue until a message
+ * arrives.  The producer and consumer indices are located in distinct cache
+ * lines.
+ *
+ * @{
+ */
+
+/**
+ * @brief Single-producer/single-consumer channel control.
+ *
+ * The members of this structure are private.  Use
+ * rtems_spsc_channel_initialize() to initialize a channel.
+ */
+typedef struct {
+  Thread_queue_Control Wait_queue;
+  char                *storage;
+  size_t               message_size;
+  unsigned int         mask;
+  Atomic_Uint          waiting;
+
+  RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES ) struct {
+    Atomic_Uint  tail;
+    unsigned int head;
+  } Producer;
+
+  RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES ) struct {
+    Atomic_Uint  head;
+    unsigned int tail;
+  } Consumer;
+} rtems_spsc_channel;
+
+/**
+ * @brief Initializes a single-producer/single-consumer channel.
+ *
+ * @param[out] channel The channel to initialize.
+ * @param storage The storage area for the messages.  It must be at least
+ *   @a message_count times @a message_size bytes large.
+ * @param message_count The maximum count of pending messages.  It must be a
+ *   power of two.
+ * @param message_size The size of each message in bytes.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The channel or storage pointer is @c NULL.
+ * @retval RTEMS_INVALID_NUMBER The message count is not a power of two.
+ * @retval RTEMS_INVALID_SIZE The message size is zero.
+ */
+rtems_status_code rtems_spsc_channel_initialize(
+  rtems_spsc_channel *channel,
+  void               *storage,
+  unsigned int        message_count,
+  size_t              message_size
+);
+
+/**
+ * @brief Destroys a single-producer/single-consumer channel.
+ *
+ * No thread may wait on the channel.
+ *
+ * @param[in, out] channel The channel to destroy.
+ */
+void rtems_spsc_channel_destroy( rtems_spsc_channel *channel );
+
+/**
+ * @brief Wakes up the consumer waiting for a message.
+ *
+ * This function is used by rtems_spsc_channel_send().  Do not call it
+ * directly.
+ *
+ * @param[in, out] channel The channel.
+ */
+void _RTEMS_spsc_channel_Wake( rtems_spsc_channel *channel );
+
+/**
+ * @brief Sends a message to the channel.
+ *
+ * This function must only be called by the producer of the channel.  It may
+ * be called from interrupt context.  It does not block.
+ *
+ * @param[in, out] channel The channel.
+ * @param message The message to send.  The message size of the channel is
+ *   copied.
+ *
+ * @retval true The message was sent.
+ * @retval false The channel is full.
+ */
+static inline bool rtems_spsc_channel_send(
+  rtems_spsc_channel *channel,
+  const void         *message
+)
+{
+  unsigned int tail;
+
+  tail = _Atomic_Load_uint( &channel->Producer.tail, ATOMIC_ORDER_RELAXED );
+
+  if ( tail - channel->Producer.head > channel->mask ) {
+    channel->Producer.head =
+      _Atomic_Load_uint( &channel->Consumer.head, ATOMIC_ORDER_ACQUIRE );
+
+    if ( tail - channel->Producer.head > channel->mask ) {
+      return false;
+    }
+  }
+
+  memcpy(
+    &channel->storage[ ( tail & channel->mask ) * channel->message_size ],
+    message,
+    channel->message_size
+  );
+  _Atomic_Store_uint( &channel->Producer.tail, tail + 1, ATOMIC_ORDER_RELEASE );
+
+  /*
+   * This fence pairs with the fence in the consumer which announces that it
+   * is about to wait.  Either the consumer sees the new tail or the producer
+   * sees the waiting consumer.
+   */
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+  if (
+    RTEMS_PREDICT_FALSE(
+      _Atomic_Load_uint( &channel->waiting, ATOMIC_ORDER_RELAXED ) != 0
+    )
+  ) {
+    _RTEMS_spsc_channel_Wake( channel );
+  }
+
+  return true;
+}
+
+/**
+ * @brief Tries to receive a message from the channel.
+ *
+ * This function must only be called by the consumer of the channel.  It does
+ * not block.
+ *
+ * @param[in, out] channel The channel.
+ * @param[out] message The buffer for the message.  The message size of the
+ *   channel is copied.
+ *
+ * @retval true A message was received.
+ * @retval false The channel is empty.
+ */
+static inline bool rtems_spsc_channel_try_receive(
+  rtems_spsc_channel *channel,
+  void               *message
+)
+{
+  unsigned int head;
+
+  head = _Atomic_Load_uint( &channel->Consumer.head, ATOMIC_ORDER_RELAXED );
+
+  if ( head == channel->Consumer.tail ) {
+    channel->Consumer.tail =
+      _Atomic_Load_uint( &channel->Producer.tail, ATOMIC_ORDER_ACQUIRE );
+
+    if ( head == channel->Consumer.tail ) {
+      return false;
+    }
+  }
+
+  memcpy(
+    message,
+    &channel->storage[ ( head & channel->mask ) * channel->message_size ],
+    channel->message_size
+  );
+  _Atomic_Store_uint( &channel->Consumer.head, head + 1, ATOMIC_ORDER_RELEASE );
+
+  return true;
+}
+
+/**
+ * @brief Receives a message from the channel.
+ *
+ * This function must only be called by the consumer of the channel.  If the
+ * channel is empty and the option set indicates that the caller is willing to
+ * block, then the caller blocks until a message arrives or until, optionally,
+ * timeout clock ticks have passed.
+ *
+ * @param[in, out] channel The channel.
+ * @param[out] message The buffer for the message.  The message size of the
+ *   channel is copied.
+ * @param option_set The option set, e.g. RTEMS_NO_WAIT or RTEMS_WAIT.
+ * @param timeout The number of ticks to wait if the RTEMS_WAIT is set.  Use
+ *   RTEMS_NO_TIMEOUT to wait indefinitely.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_UNSATISFIED The channel is empty and RTEMS_NO_WAIT is set.
+ * @retval RTEMS_TIMEOUT A timeout occurred and no message was received.
+ */
+rtems_status_code rtems_spsc_channel_receive(
+  rtems_spsc_channel *channel,
+  void               *message,
+  rtems_option        option_set,
+  rtems_interval      timeout
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SPSC_H */
@@ -52,6 +52,12 @@
  */
 #define bdbuf_config rtems_bdbuf_configuration
 
+/**
+ * Maximum number of hash table stripes with an own lock. Must be a power of
+ * two.
+ */
+#define RTEMS_BDBUF_STRIPE_COUNT_MAX 16
+
 /**
  * A swapout transfer transaction data. This data is passed to a worked thread
  * to handle the write phase of the transfer.
@@ -109,7 +115,15 @@ typedef struct rtems_bdbuf_cache
   uint32_t            flags;             /**< Configuration flags. */
 
   rtems_mutex         lock;              /**< The cache lock. It locks all
-                                          * cache data, BD and lists. */
+                                          * cache data, BD and lists together
+                                          * with all stripe locks. */
+  rtems_mutex         stripe_locks[RTEMS_BDBUF_STRIPE_COUNT_MAX]; /**< Locks
+                                          * for the hash table stripes. A
+                                          * stripe lock is enough to get and
+                                          * release a cached BD of the
+                                          * stripe. */
+  size_t              stripe_mask;       /**< The stripe count minus one. The
+                                          * stripe count is a power of two. */
   rtems_mutex         sync_lock;         /**< Sync calls block writes. */
   bool                sync_active;       /**< True if a sync is active. */
   rtems_id            sync_requester;    /**< The sync requester. */
@@ -117,9 +131,29 @@ typedef struct rtems_bdbuf_cache
                                           * BDBUF_INVALID_DEV not a device
                                           * sync. */
 
-  rtems_bdbuf_buffer* tree;              /**< Buffer descriptor lookup AVL tree
-                                          * root. There is only one. */
-  rtems_chain_control lru;               /**< Least recently used list */
+  rtems_bdbuf_buffer** hash_table;       /**< Buffer descriptor lookup hash
+                                          * table. It is keyed by the device
+                                          * and block number. */
+  size_t              hash_mask;         /**< The hash table bucket count
+                                          * minus one. The bucket count is a
+                                          * power of two. */
+  rtems_chain_control lru;               /**< Least recently used list. With
+                                          * the 2Q replacement policy this is
+                                          * the recent queue. */
+  rtems_chain_control lru_frequent;      /**< Frequent queue of the 2Q
+                                          * replacement policy. */
+  size_t              frequent_count;    /**< Buffer memory of the frequent
+                                          * queue in minimum size buffers. */
+  size_t              frequent_max;      /**< Maximum buffer memory of the
+                                          * frequent queue in minimum size
+                                          * buffers. */
+  bool                policy_2q;         /**< True if the 2Q replacement
+                                          * policy is active. */
+  uint32_t            recent_sequence;   /**< Count of blocks which entered
+                                          * the recent queue. */
+  uint32_t            recent_window;     /**< Correlated reference window of
+                                          * the 2Q replacement policy in
+                                          * blocks. */
   rtems_chain_control modified;          /**< Modified buffers list */
   rtems_chain_control sync;              /**< Buffers to sync list */
 
@@ -177,6 +211,23 @@ typedef enum {
 #define RTEMS_BDBUF_SWAPOUT_SYNC   RTEMS_EVENT_2
 #define RTEMS_BDBUF_READ_AHEAD_WAKE_UP RTEMS_EVENT_1
 
+/**
+ * Maximum number of blocks of a direct read request.
+ */
+#define RTEMS_BDBUF_DIRECT_READ_MAX_BLOCKS 32
+
+/**
+ * The maximum share of the buffer memory in percent which may be used by the
+ * frequent queue of the 2Q replacement policy.
+ */
+#define RTEMS_BDBUF_2Q_FREQUENT_PERCENT 75
+
+/**
+ * The share of the buffer memory in percent which defines the correlated
+ * reference window of the 2Q replacement policy.
+ */
+#define RTEMS_BDBUF_2Q_WINDOW_PERCENT 25
+
 static rtems_task rtems_bdbuf_swapout_task(rtems_task_argument arg);
 
 static rtems_task rtems_bdbuf_read_ahead_task(rtems_task_argument arg);
@@ -271,15 +322,6 @@ rtems_bdbuf_show_users (const char* where, rtems_bdbuf_buffer* bd)
 #define rtems_bdbuf_show_users(_w, _b) ((void) 0)
 #endif
 
-/**
- * The default maximum height of 32 allows for AVL trees having between
- * 5,704,880 and 4,294,967,295 nodes, depending on order of insertion.  You may
- * change this compile-time constant as you wish.
- */
-#ifndef RTEMS_BDBUF_AVL_MAX_HEIGHT
-#define RTEMS_BDBUF_AVL_MAX_HEIGHT (32)
-#endif
-
 static void
 rtems_bdbuf_fatal (rtems_fatal_code error)
 {
@@ -294,492 +336,105 @@ rtems_bdbuf_fatal_with_state (rtems_bdbuf_buf_state state,
 }
 
 /**
- * Searches for the node with specified dd/block.
+ * Returns the hash table bucket of the specified dd/block.
+ *
+ * @param dd disk device key
+ * @param block block key
+ * @return the bucket index
+ */
+static size_t
+rtems_bdbuf_hash_bucket (const rtems_disk_device *dd,
+                         rtems_blkdev_bnum        block)
+{
+  uint32_t hash;
+
+  hash = (uint32_t) block * 0x9e3779b1U;
+  hash ^= (uint32_t) ((uintptr_t) dd >> 3) * 0x85ebca6bU;
+  hash ^= hash >> 16;
+
+  return hash & bdbuf_cache.hash_mask;
+}
+
+/**
+ * Searches for the BD with specified dd/block.
  *
- * @param root pointer to the root node of the AVL-Tree
  * @param dd disk device search key
  * @param block block search key
- * @retval NULL node with the specified dd/block is not found
- * @return pointer to the node with specified dd/block
+ * @retval NULL BD with the specified dd/block is not found
+ * @return pointer to the BD with specified dd/block
  */
 static rtems_bdbuf_buffer *
-rtems_bdbuf_avl_search (rtems_bdbuf_buffer** root,
-                        const rtems_disk_device *dd,
-                        rtems_blkdev_bnum    block)
+rtems_bdbuf_hash_search (const rtems_disk_device *dd,
+                         rtems_blkdev_bnum        block)
 {
-  rtems_bdbuf_buffer* p = *root;
+  rtems_bdbuf_buffer* p;
+
+  p = bdbuf_cache.hash_table[rtems_bdbuf_hash_bucket (dd, block)];
 
   while ((p != NULL) && ((p->dd != dd) || (p->block != block)))
   {
-    if (((uintptr_t) p->dd < (uintptr_t) dd)
-        || ((p->dd == dd) && (p->block < block)))
-    {
-      p = p->avl.right;
-    }
-    else
-    {
-      p = p->avl.left;
-    }
+    p = p->hash_next;
   }
 
   return p;
 }
 
 /**
- * Inserts the specified node to the AVl-Tree.
+ * Inserts the specified BD to the hash table.
  *
- * @param root pointer to the root node of the AVL-Tree
- * @param node Pointer to the node to add.
- * @retval 0 The node added successfully
- * @retval -1 An error occured
+ * @param node Pointer to the BD to add.
+ * @retval 0 The BD added successfully
+ * @retval -1 A BD with the same dd/block is already present
  */
 static int
-rtems_bdbuf_avl_insert(rtems_bdbuf_buffer** root,
-                       rtems_bdbuf_buffer*  node)
+rtems_bdbuf_hash_insert (rtems_bdbuf_buffer* node)
 {
-  const rtems_disk_device *dd = node->dd;
-  rtems_blkdev_bnum block = node->block;
-
-  rtems_bdbuf_buffer*  p = *root;
-  rtems_bdbuf_buffer*  q;
-  rtems_bdbuf_buffer*  p1;
-  rtems_bdbuf_buffer*  p2;
-  rtems_bdbuf_buffer*  buf_stack[RTEMS_BDBUF_AVL_MAX_HEIGHT];
-  rtems_bdbuf_buffer** buf_prev = buf_stack;
-
-  bool modified = false;
+  rtems_bdbuf_buffer** bucket;
+  rtems_bdbuf_buffer*  p;
 
-  if (p == NULL)
-  {
-    *root = node;
-    node->avl.left = NULL;
-    node->avl.right = NULL;
-    node->avl.bal = 0;
-    return 0;
-  }
+  bucket = &bdbuf_cache.hash_table[rtems_bdbuf_hash_bucket (node->dd,
+                                                            node->block)];
 
-  while (p != NULL)
+  for (p = *bucket; p != NULL; p = p->hash_next)
   {
-    *buf_prev++ = p;
-
-    if (((uintptr_t) p->dd < (uintptr_t) dd)
-        || ((p->dd == dd) && (p->block < block)))
-    {
-      p->avl.cache = 1;
-      q = p->avl.right;
-      if (q == NULL)
-      {
-        q = node;
-        p->avl.right = q = node;
-        break;
-      }
-    }
-    else if ((p->dd != dd) || (p->block != block))
-    {
-      p->avl.cache = -1;
-      q = p->avl.left;
-      if (q == NULL)
-      {
-        q = node;
-        p->avl.left = q;
-        break;
-      }
-    }
-    else
-    {
+    if ((p->dd == node->dd) && (p->block == node->block))
       return -1;
-    }
-
-    p = q;
   }
 
-  q->avl.left = q->avl.right = NULL;
-  q->avl.bal = 0;
-  modified = true;
-  buf_prev--;
-
-  while (modified)
-  {
-    if (p->avl.cache == -1)
-    {
-      switch (p->avl.bal)
-      {
-        case 1:
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        case 0:
-          p->avl.bal = -1;
-          break;
-
-        case -1:
-          p1 = p->avl.left;
-          if (p1->avl.bal == -1) /* simple LL-turn */
-          {
-            p->avl.left = p1->avl.right;
-            p1->avl.right = p;
-            p->avl.bal = 0;
-            p = p1;
-          }
-          else /* double LR-turn */
-          {
-            p2 = p1->avl.right;
-            p1->avl.right = p2->avl.left;
-            p2->avl.left = p1;
-            p->avl.left = p2->avl.right;
-            p2->avl.right = p;
-            if (p2->avl.bal == -1) p->avl.bal = +1; else p->avl.bal = 0;
-            if (p2->avl.bal == +1) p1->avl.bal = -1; else p1->avl.bal = 0;
-            p = p2;
-          }
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        default:
-          break;
-      }
-    }
-    else
-    {
-      switch (p->avl.bal)
-      {
-        case -1:
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        case 0:
-          p->avl.bal = 1;
-          break;
-
-        case 1:
-          p1 = p->avl.right;
-          if (p1->avl.bal == 1) /* simple RR-turn */
-          {
-            p->avl.right = p1->avl.left;
-            p1->avl.left = p;
-            p->avl.bal = 0;
-            p = p1;
-          }
-          else /* double RL-turn */
-          {
-            p2 = p1->avl.left;
-            p1->avl.left = p2->avl.right;
-            p2->avl.right = p1;
-            p->avl.right = p2->avl.left;
-            p2->avl.left = p;
-            if (p2->avl.bal == +1) p->avl.bal = -1; else p->avl.bal = 0;
-            if (p2->avl.bal == -1) p1->avl.bal = +1; else p1->avl.bal = 0;
-            p = p2;
-          }
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        default:
-          break;
-      }
-    }
-    q = p;
-    if (buf_prev > buf_stack)
-    {
-      p = *--buf_prev;
-
-      if (p->avl.cache == -1)
-      {
-        p->avl.left = q;
-      }
-      else
-      {
-        p->avl.right = q;
-      }
-    }
-    else
-    {
-      *root = p;
-      break;
-    }
-  };
+  node->hash_next = *bucket;
+  *bucket = node;
 
   return 0;
 }
 
-
 /**
- * Removes the node from the tree.
+ * Removes the specified BD from the hash table.
  *
- * @param root Pointer to pointer to the root node
- * @param node Pointer to the node to remove
- * @retval 0 Item removed
- * @retval -1 No such item found
+ * @param node Pointer to the BD to remove.
+ * @retval 0 The BD removed successfully
+ * @retval -1 The BD is not in the hash table
  */
 static int
-rtems_bdbuf_avl_remove(rtems_bdbuf_buffer**      root,
-                       const rtems_bdbuf_buffer* node)
+rtems_bdbuf_hash_remove (rtems_bdbuf_buffer* node)
 {
-  const rtems_disk_device *dd = node->dd;
-  rtems_blkdev_bnum block = node->block;
-
-  rtems_bdbuf_buffer*  p = *root;
-  rtems_bdbuf_buffer*  q;
-  rtems_bdbuf_buffer*  r;
-  rtems_bdbuf_buffer*  s;
-  rtems_bdbuf_buffer*  p1;
-  rtems_bdbuf_buffer*  p2;
-  rtems_bdbuf_buffer*  buf_stack[RTEMS_BDBUF_AVL_MAX_HEIGHT];
-  rtems_bdbuf_buffer** buf_prev = buf_stack;
-
-  bool modified = false;
-
-  memset (buf_stack, 0, sizeof(buf_stack));
-
-  while (p != NULL)
-  {
-    *buf_prev++ = p;
-
-    if (((uintptr_t) p->dd < (uintptr_t) dd)
-        || ((p->dd == dd) && (p->block < block)))
-    {
-      p->avl.cache = 1;
-      p = p->avl.right;
-    }
-    else if ((p->dd != dd) || (p->block != block))
-    {
-      p->avl.cache = -1;
-      p = p->avl.left;
-    }
-    else
-    {
-      /* node found */
-      break;
-    }
-  }
+  rtems_bdbuf_buffer** link;
 
-  if (p == NULL)
-  {
-    /* there is no such node */
-    return -1;
-  }
-
-  q = p;
-
-  buf_prev--;
-  if (buf_prev > buf_stack)
-  {
-    p = *(buf_prev - 1);
-  }
-  else
-  {
-    p = NULL;
-  }
+  link = &bdbuf_cache.hash_table[rtems_bdbuf_hash_bucket (node->dd,
+                                                          node->block)];
 
-  /* at this moment q - is a node to delete, p is q's parent */
-  if (q->avl.right == NULL)
-  {
-    r = q->avl.left;
-    if (r != NULL)
-    {
-      r->avl.bal = 0;
-    }
-    q = r;
-  }
-  else
+  while (*link != NULL)
   {
-    rtems_bdbuf_buffer **t;
-
-    r = q->avl.right;
-
-    if (r->avl.left == NULL)
-    {
-      r->avl.left = q->avl.left;
-      r->avl.bal = q->avl.bal;
-      r->avl.cache = 1;
-      *buf_prev++ = q = r;
-    }
-    else
-    {
-      t = buf_prev++;
-      s = r;
-
-      while (s->avl.left != NULL)
-      {
-        *buf_prev++ = r = s;
-        s = r->avl.left;
-        r->avl.cache = -1;
-      }
-
-      s->avl.left = q->avl.left;
-      r->avl.left = s->avl.right;
-      s->avl.right = q->avl.right;
-      s->avl.bal = q->avl.bal;
-      s->avl.cache = 1;
-
-      *t = q = s;
-    }
-  }
-
-  if (p != NULL)
-  {
-    if (p->avl.cache == -1)
-    {
-      p->avl.left = q;
-    }
-    else
-    {
-      p->avl.right = q;
-    }
-  }
-  else
-  {
-    *root = q;
-  }
-
-  modified = true;
-
-  while (modified)
-  {
-    if (buf_prev > buf_stack)
-    {
-      p = *--buf_prev;
-    }
-    else
-    {
-      break;
-    }
-
-    if (p->avl.cache == -1)
-    {
-      /* rebalance left branch */
-      switch (p->avl.bal)
-      {
-        case -1:
-          p->avl.bal = 0;
-          break;
-        case  0:
-          p->avl.bal = 1;
-          modified = false;
-          break;
-
-        case +1:
-          p1 = p->avl.right;
-
-          if (p1->avl.bal >= 0) /* simple RR-turn */
-          {
-            p->avl.right = p1->avl.left;
-            p1->avl.left = p;
-
-            if (p1->avl.bal == 0)
-            {
-              p1->avl.bal = -1;
-              modified = false;
-            }
-            else
-            {
-              p->avl.bal = 0;
-              p1->avl.bal = 0;
-            }
-            p = p1;
-          }
-          else /* double RL-turn */
-          {
-            p2 = p1->avl.left;
-
-            p1->avl.left = p2->avl.right;
-            p2->avl.right = p1;
-            p->avl.right = p2->avl.left;
-            p2->avl.left = p;
-
-            if (p2->avl.bal == +1) p->avl.bal = -1; else p->avl.bal = 0;
-            if (p2->avl.bal == -1) p1->avl.bal = 1; else p1->avl.bal = 0;
-
-            p = p2;
-            p2->avl.bal = 0;
-          }
-          break;
-
-        default:
-          break;
-      }
-    }
-    else
-    {
-      /* rebalance right branch */
-      switch (p->avl.bal)
-      {
-        case +1:
-          p->avl.bal = 0;
-          break;
-
-        case  0:
-          p->avl.bal = -1;
-          modified = false;
-          break;
-
-        case -1:
-          p1 = p->avl.left;
-
-          if (p1->avl.bal <= 0) /* simple LL-turn */
-          {
-            p->avl.left = p1->avl.right;
-            p1->avl.right = p;
-            if (p1->avl.bal == 0)
-            {
-              p1->avl.bal = 1;
-              modified = false;
-            }
-            else
-            {
-              p->avl.bal = 0;
-              p1->avl.bal = 0;
-            }
-            p = p1;
-          }
-          else /* double LR-turn */
-          {
-            p2 = p1->avl.right;
-
-            p1->avl.right = p2->avl.left;
-            p2->avl.left = p1;
-            p->avl.left = p2->avl.right;
-            p2->avl.right = p;
-
-            if (p2->avl.bal == -1) p->avl.bal = 1; else p->avl.bal = 0;
-            if (p2->avl.bal == +1) p1->avl.bal = -1; else p1->avl.bal = 0;
-
-            p = p2;
-            p2->avl.bal = 0;
-          }
-          break;
-
-        default:
-          break;
-      }
-    }
-
-    if (buf_prev > buf_stack)
-    {
-      q = *(buf_prev - 1);
-
-      if (q->avl.cache == -1)
-      {
-        q->avl.left = p;
-      }
-      else
-      {
-        q->avl.right = p;
-      }
-    }
-    else
+    if (*link == node)
     {
-      *root = p;
-      break;
+      *link = node->hash_next;
+      node->hash_next = NULL;
+      return 0;
     }
 
+    link = &(*link)->hash_next;
   }
 
-  return 0;
+  return -1;
 }
 
 static void
@@ -825,12 +480,56 @@ rtems_bdbuf_unlock (rtems_mutex *lock)
 }
 
 /**
- * Lock the cache. A single task can nest calls.
+ * Returns the lock of the hash table stripe of the specified dd/block.
+ *
+ * @param dd disk device key
+ * @param block block key
+ * @return the stripe lock
+ */
+static rtems_mutex *
+rtems_bdbuf_stripe_lock (const rtems_disk_device *dd,
+                         rtems_blkdev_bnum        block)
+{
+  size_t stripe;
+
+  stripe = rtems_bdbuf_hash_bucket (dd, block) & bdbuf_cache.stripe_mask;
+
+  return &bdbuf_cache.stripe_locks[stripe];
+}
+
+/**
+ * Lock all stripes in ascending order.
+ */
+static void
+rtems_bdbuf_lock_stripes (void)
+{
+  size_t stripe;
+
+  for (stripe = 0; stripe <= bdbuf_cache.stripe_mask; ++stripe)
+    rtems_bdbuf_lock (&bdbuf_cache.stripe_locks[stripe]);
+}
+
+/**
+ * Unlock all stripes.
+ */
+static void
+rtems_bdbuf_unlock_stripes (void)
+{
+  size_t stripe = bdbuf_cache.stripe_mask + 1;
+
+  while (stripe > 0)
+    rtems_bdbuf_unlock (&bdbuf_cache.stripe_locks[--stripe]);
+}
+
+/**
+ * Lock the cache. This locks all stripes as well, so that the owner of the
+ * cache lock may change every BD.
  */
 static void
 rtems_bdbuf_lock_cache (void)
 {
   rtems_bdbuf_lock (&bdbuf_cache.lock);
+  rtems_bdbuf_lock_stripes ();
 }
 
 /**
@@ -839,6 +538,7 @@ rtems_bdbuf_lock_cache (void)
 static void
 rtems_bdbuf_unlock_cache (void)
 {
+  rtems_bdbuf_unlock_stripes ();
   rtems_bdbuf_unlock (&bdbuf_cache.lock);
 }
 
@@ -895,7 +595,13 @@ rtems_bdbuf_anonymous_wait (rtems_bdbuf_waiters *waiters)
    */
   ++waiters->count;
 
+  /*
+   * The stripe locks are obtained after the cache lock, so give them up while
+   * we wait.  The waiter counts are only changed with all stripes locked.
+   */
+  rtems_bdbuf_unlock_stripes ();
   rtems_condition_variable_wait (&waiters->cond_var, &bdbuf_cache.lock);
+  rtems_bdbuf_lock_stripes ();
 
   --waiters->count;
 }
@@ -939,33 +645,147 @@ rtems_bdbuf_has_buffer_waiters (void)
 }
 
 static void
-rtems_bdbuf_remove_from_tree (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_remove_from_hash (rtems_bdbuf_buffer *bd)
 {
-  if (rtems_bdbuf_avl_remove (&bdbuf_cache.tree, bd) != 0)
+  if (rtems_bdbuf_hash_remove (bd) != 0)
     rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_TREE_RM);
 }
 
+/**
+ * Returns the buffer memory of the BD in minimum size buffers.
+ */
+static size_t
+rtems_bdbuf_min_buffers (const rtems_bdbuf_buffer *bd)
+{
+  return bdbuf_cache.max_bds_per_group / bd->group->bds_per_group;
+}
+
+/**
+ * Extracts a free or cached BD or a BD accessed after a hit without the cache
+ * lock from the LRU list or the frequent queue.
+ */
+static void
+rtems_bdbuf_extract_from_lru_list (rtems_bdbuf_buffer *bd)
+{
+  if (bd->frequent
+      && (bd->state == RTEMS_BDBUF_STATE_CACHED || bd->lru_access))
+    bdbuf_cache.frequent_count -= rtems_bdbuf_min_buffers (bd);
+
+  rtems_chain_extract_unprotected (&bd->link);
+}
+
+/**
+ * Takes a BD accessed after a hit without the cache lock off the LRU list or
+ * the frequent queue. Afterwards the BD is in use like a BD obtained with the
+ * cache locked.
+ */
 static void
-rtems_bdbuf_remove_from_tree_and_lru_list (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_end_lru_access (rtems_bdbuf_buffer *bd)
+{
+  if (bd->lru_access)
+  {
+    rtems_bdbuf_extract_from_lru_list (bd);
+    bd->lru_access = false;
+    rtems_bdbuf_group_obtain (bd);
+  }
+}
+
+/**
+ * Returns true if a BD of the group is accessed after a hit without the cache
+ * lock. Such BDs do not count as users of the group.
+ */
+static bool
+rtems_bdbuf_group_has_lru_access (const rtems_bdbuf_group *group)
+{
+  size_t              bufs_per_bd;
+  size_t              b;
+  rtems_bdbuf_buffer* bd;
+
+  bufs_per_bd = bdbuf_cache.max_bds_per_group / group->bds_per_group;
+
+  for (b = 0, bd = group->bdbuf;
+       b < group->bds_per_group;
+       b++, bd += bufs_per_bd)
+  {
+    if (bd->lru_access)
+      return true;
+  }
+
+  return false;
+}
+
+/**
+ * Increments a hit counter of the device statistics. Hits on different
+ * stripes may increment the counters of a device at the same time.
+ */
+static void
+rtems_bdbuf_count_hit (uint32_t *counter)
+{
+  __atomic_fetch_add (counter, 1, __ATOMIC_RELAXED);
+}
+
+/**
+ * Returns true if a hit on the BD promotes it to the frequent queue of the 2Q
+ * replacement policy. Hits within the correlated reference window do not
+ * promote the buffer, since they are usually part of one access, for example
+ * a read followed by a write of the block.
+ */
+static bool
+rtems_bdbuf_policy_promotes (const rtems_bdbuf_buffer *bd)
+{
+  return bdbuf_cache.policy_2q
+    && !bd->frequent
+    && bdbuf_cache.recent_sequence - bd->recent_sequence
+      >= bdbuf_cache.recent_window;
+}
+
+/**
+ * Records a cache hit for the replacement policy. With the 2Q policy a hit on
+ * a buffer of the recent queue may promote the buffer to the frequent queue.
+ * A BD which is promoted must not be on the LRU list or the frequent queue.
+ */
+static void
+rtems_bdbuf_policy_hit (rtems_bdbuf_buffer *bd)
+{
+  if (bdbuf_cache.policy_2q)
+  {
+    if (bd->frequent)
+    {
+      rtems_bdbuf_count_hit (&bd->dd->stats.frequent_hits);
+    }
+    else
+    {
+      rtems_bdbuf_count_hit (&bd->dd->stats.recent_hits);
+
+      if (rtems_bdbuf_policy_promotes (bd))
+        bd->frequent = true;
+    }
+  }
+}
+
+static void
+rtems_bdbuf_remove_from_hash_and_lru_list (rtems_bdbuf_buffer *bd)
 {
   switch (bd->state)
   {
     case RTEMS_BDBUF_STATE_FREE:
       break;
     case RTEMS_BDBUF_STATE_CACHED:
-      rtems_bdbuf_remove_from_tree (bd);
+      rtems_bdbuf_remove_from_hash (bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_10);
   }
 
-  rtems_chain_extract_unprotected (&bd->link);
+  rtems_bdbuf_extract_from_lru_list (bd);
 }
 
 static void
 rtems_bdbuf_make_free_and_add_to_lru_list (rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_FREE);
+  bd->frequent = false;
+  bd->referenced = false;
   rtems_chain_prepend_unprotected (&bdbuf_cache.lru, &bd->link);
 }
 
@@ -979,17 +799,41 @@ static void
 rtems_bdbuf_make_cached_and_add_to_lru_list (rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_CACHED);
-  rtems_chain_append_unprotected (&bdbuf_cache.lru, &bd->link);
+  bd->referenced = false;
+
+  if (bd->frequent)
+  {
+    rtems_chain_append_unprotected (&bdbuf_cache.lru_frequent, &bd->link);
+    bdbuf_cache.frequent_count += rtems_bdbuf_min_buffers (bd);
+
+    /*
+     * Demote the least recently used buffers of the frequent queue to the
+     * most recently used end of the recent queue. This keeps room for new
+     * blocks in the recent queue.
+     */
+    while (bdbuf_cache.frequent_count > bdbuf_cache.frequent_max)
+    {
+      rtems_bdbuf_buffer *lru_bd =
+        (rtems_bdbuf_buffer *) rtems_chain_first (&bdbuf_cache.lru_frequent);
+
+      rtems_bdbuf_extract_from_lru_list (lru_bd);
+      lru_bd->frequent = false;
+      rtems_chain_append_unprotected (&bdbuf_cache.lru, &lru_bd->link);
+    }
+  }
+  else
+    rtems_chain_append_unprotected (&bdbuf_cache.lru, &bd->link);
 }
 
 static void
 rtems_bdbuf_discard_buffer (rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_make_empty (bd);
+  bd->frequent = false;
 
   if (bd->waiters == 0)
   {
-    rtems_bdbuf_remove_from_tree (bd);
+    rtems_bdbuf_remove_from_hash (bd);
     rtems_bdbuf_make_free_and_add_to_lru_list (bd);
   }
 }
@@ -1084,7 +928,7 @@ rtems_bdbuf_discard_buffer_after_access (rtems_bdbuf_buffer *bd)
 
 /**
  * Reallocate a group. The BDs currently allocated in the group are removed
- * from the ALV tree and any lists then the new BD's are prepended to the ready
+ * from the hash table and any lists then the new BD's are prepended to the ready
  * list of the cache.
  *
  * @param group The group to reallocate.
@@ -1108,7 +952,7 @@ rtems_bdbuf_group_realloc (rtems_bdbuf_group* group, size_t new_bds_per_group)
   for (b = 0, bd = group->bdbuf;
        b < group->bds_per_group;
        b++, bd += bufs_per_bd)
-    rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+    rtems_bdbuf_remove_from_hash_and_lru_list (bd);
 
   group->bds_per_group = new_bds_per_group;
   bufs_per_bd = bdbuf_cache.max_bds_per_group / new_bds_per_group;
@@ -1131,26 +975,29 @@ rtems_bdbuf_setup_empty_buffer (rtems_bdbuf_buffer *bd,
 {
   bd->dd        = dd ;
   bd->block     = block;
-  bd->avl.left  = NULL;
-  bd->avl.right = NULL;
   bd->waiters   = 0;
+  bd->frequent  = false;
+  bd->referenced = false;
+  bd->recent_sequence = ++bdbuf_cache.recent_sequence;
 
-  if (rtems_bdbuf_avl_insert (&bdbuf_cache.tree, bd) != 0)
+  if (rtems_bdbuf_hash_insert (bd) != 0)
     rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RECYCLE);
 
   rtems_bdbuf_make_empty (bd);
 }
 
 static rtems_bdbuf_buffer *
-rtems_bdbuf_get_buffer_from_lru_list (rtems_disk_device *dd,
-                                      rtems_blkdev_bnum  block)
+rtems_bdbuf_get_buffer_from_list (rtems_chain_control *list,
+                                  rtems_disk_device   *dd,
+                                  rtems_blkdev_bnum    block)
 {
-  rtems_chain_node *node = rtems_chain_first (&bdbuf_cache.lru);
+  rtems_chain_node *node = rtems_chain_first (list);
 
-  while (!rtems_chain_is_tail (&bdbuf_cache.lru, node))
+  while (!rtems_chain_is_tail (list, node))
   {
     rtems_bdbuf_buffer *bd = (rtems_bdbuf_buffer *) node;
     rtems_bdbuf_buffer *empty_bd = NULL;
+    rtems_chain_node   *next = rtems_chain_next (node);
 
     if (rtems_bdbuf_tracer)
       printf ("bdbuf:next-bd: %tu (%td:%" PRId32 ") %zd -> %zd\n",
@@ -1158,32 +1005,77 @@ rtems_bdbuf_get_buffer_from_lru_list (rtems_disk_device *dd,
               bd->group - bdbuf_cache.groups, bd->group->users,
               bd->group->bds_per_group, dd->bds_per_group);
 
+    if (bd->referenced && !bd->lru_access)
+    {
+      /*
+       * The BD was hit since it was put on the list, so give it a second
+       * chance and move it to the most recently used end.
+       */
+      bd->referenced = false;
+      rtems_chain_extract_unprotected (node);
+      rtems_chain_append_unprotected (list, node);
+
+      if (rtems_chain_is_tail (list, next))
+        next = node;
+    }
     /*
-     * If nobody waits for this BD, we may recycle it.
+     * If nobody uses or waits for this BD, we may recycle it. A BD accessed
+     * after a hit without the cache lock stays on the list while in use.
      */
-    if (bd->waiters == 0)
+    else if (bd->waiters == 0 && !bd->lru_access)
     {
       if (bd->group->bds_per_group == dd->bds_per_group)
       {
-        rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+        rtems_bdbuf_remove_from_hash_and_lru_list (bd);
 
         empty_bd = bd;
       }
-      else if (bd->group->users == 0)
+      else if (bd->group->users == 0
+               && !rtems_bdbuf_group_has_lru_access (bd->group))
         empty_bd = rtems_bdbuf_group_realloc (bd->group, dd->bds_per_group);
     }
 
-    if (empty_bd != NULL)
+    if (empty_bd != NULL)
+    {
+      rtems_bdbuf_setup_empty_buffer (empty_bd, dd, block);
+
+      return empty_bd;
+    }
+
+    node = next;
+  }
+
+  return NULL;
+}
+
+static rtems_bdbuf_buffer *
+rtems_bdbuf_get_buffer_from_lru_list (rtems_disk_device *dd,
+                                      rtems_blkdev_bnum  block)
+{
+  rtems_bdbuf_buffer *bd;
+
+  /*
+   * The LRU list contains the free buffers first. With the 2Q replacement
+   * policy it is the recent queue and buffers of the frequent queue are only
+   * recycled if no buffer of the recent queue can be used.
+   */
+  bd = rtems_bdbuf_get_buffer_from_list (&bdbuf_cache.lru, dd, block);
+
+  if (bdbuf_cache.policy_2q)
+  {
+    if (bd != NULL)
+      ++dd->stats.recent_misses;
+    else
     {
-      rtems_bdbuf_setup_empty_buffer (empty_bd, dd, block);
-
-      return empty_bd;
+      bd = rtems_bdbuf_get_buffer_from_list (&bdbuf_cache.lru_frequent,
+                                             dd,
+                                             block);
+      if (bd != NULL)
+        ++dd->stats.frequent_misses;
     }
-
-    node = rtems_chain_next (node);
   }
 
-  return NULL;
+  return bd;
 }
 
 static rtems_status_code
@@ -1303,6 +1195,7 @@ rtems_bdbuf_do_init (void)
   rtems_bdbuf_buffer* bd;
   uint8_t*            buffer;
   size_t              b;
+  uint32_t            processor_count;
   rtems_status_code   sc;
 
   if (rtems_bdbuf_tracer)
@@ -1326,12 +1219,28 @@ rtems_bdbuf_do_init (void)
 
   rtems_chain_initialize_empty (&bdbuf_cache.swapout_free_workers);
   rtems_chain_initialize_empty (&bdbuf_cache.lru);
+  rtems_chain_initialize_empty (&bdbuf_cache.lru_frequent);
   rtems_chain_initialize_empty (&bdbuf_cache.modified);
   rtems_chain_initialize_empty (&bdbuf_cache.sync);
   rtems_chain_initialize_empty (&bdbuf_cache.read_ahead_chain);
 
   rtems_mutex_set_name (&bdbuf_cache.lock, "bdbuf lock");
   rtems_mutex_set_name (&bdbuf_cache.sync_lock, "bdbuf sync lock");
+  for (b = 0; b < RTEMS_BDBUF_STRIPE_COUNT_MAX; ++b)
+    rtems_mutex_init (&bdbuf_cache.stripe_locks[b], "bdbuf stripe lock");
+
+  /*
+   * Use about two stripes per processor, so that hits on different processors
+   * seldom contend for a stripe. A single stripe is enough on uniprocessor
+   * configurations.
+   */
+  processor_count = rtems_scheduler_get_processor_maximum ();
+  if (processor_count > 1)
+  {
+    while (bdbuf_cache.stripe_mask + 1 < 2 * processor_count
+           && bdbuf_cache.stripe_mask + 1 < RTEMS_BDBUF_STRIPE_COUNT_MAX)
+      bdbuf_cache.stripe_mask = (bdbuf_cache.stripe_mask << 1) | 1;
+  }
   rtems_condition_variable_set_name (&bdbuf_cache.access_waiters.cond_var,
                                      "bdbuf access");
   rtems_condition_variable_set_name (&bdbuf_cache.transfer_waiters.cond_var,
@@ -1350,6 +1259,14 @@ rtems_bdbuf_do_init (void)
     bdbuf_config.buffer_max / bdbuf_config.buffer_min;
   bdbuf_cache.group_count =
     bdbuf_cache.buffer_min_count / bdbuf_cache.max_bds_per_group;
+  bdbuf_cache.policy_2q =
+    bdbuf_config.replacement_policy == RTEMS_BDBUF_REPLACEMENT_POLICY_2Q;
+  bdbuf_cache.frequent_max =
+    (bdbuf_cache.buffer_min_count * RTEMS_BDBUF_2Q_FREQUENT_PERCENT) / 100;
+  bdbuf_cache.recent_window =
+    (bdbuf_cache.buffer_min_count * RTEMS_BDBUF_2Q_WINDOW_PERCENT) / 100;
+  if (bdbuf_cache.recent_window == 0)
+    bdbuf_cache.recent_window = 1;
 
   /*
    * Allocate the memory for the buffer descriptors.
@@ -1367,6 +1284,19 @@ rtems_bdbuf_do_init (void)
   if (!bdbuf_cache.groups)
     goto error;
 
+  /*
+   * Allocate the lookup hash table. Use at least one bucket per buffer
+   * descriptor so that the average bucket length stays below one.
+   */
+  bdbuf_cache.hash_mask = 1;
+  while (bdbuf_cache.hash_mask < bdbuf_cache.buffer_min_count)
+    bdbuf_cache.hash_mask <<= 1;
+  bdbuf_cache.hash_table = calloc (sizeof (rtems_bdbuf_buffer*),
+                                   bdbuf_cache.hash_mask);
+  if (!bdbuf_cache.hash_table)
+    goto error;
+  --bdbuf_cache.hash_mask;
+
   /*
    * Allocate memory for buffer memory. The buffer memory will be cache
    * aligned. It is possible to free the memory allocated by
@@ -1489,6 +1419,7 @@ error:
   }
 
   free (bdbuf_cache.buffers);
+  free (bdbuf_cache.hash_table);
   free (bdbuf_cache.groups);
   free (bdbuf_cache.bds);
   free (bdbuf_cache.swapout_transfer);
@@ -1553,7 +1484,7 @@ rtems_bdbuf_wait_for_access (rtems_bdbuf_buffer *bd)
         rtems_bdbuf_group_release (bd);
         /* Fall through */
       case RTEMS_BDBUF_STATE_CACHED:
-        rtems_chain_extract_unprotected (&bd->link);
+        rtems_bdbuf_extract_from_lru_list (bd);
         /* Fall through */
       case RTEMS_BDBUF_STATE_EMPTY:
         return;
@@ -1690,7 +1621,7 @@ rtems_bdbuf_sync_after_access (rtems_bdbuf_buffer *bd)
   {
     if (bd->state == RTEMS_BDBUF_STATE_EMPTY)
     {
-      rtems_bdbuf_remove_from_tree (bd);
+      rtems_bdbuf_remove_from_hash (bd);
       rtems_bdbuf_make_free_and_add_to_lru_list (bd);
     }
     rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
@@ -1703,7 +1634,7 @@ rtems_bdbuf_get_buffer_for_read_ahead (rtems_disk_device *dd,
 {
   rtems_bdbuf_buffer *bd = NULL;
 
-  bd = rtems_bdbuf_avl_search (&bdbuf_cache.tree, dd, block);
+  bd = rtems_bdbuf_hash_search (dd, block);
 
   if (bd == NULL)
   {
@@ -1730,7 +1661,7 @@ rtems_bdbuf_get_buffer_for_access (rtems_disk_device *dd,
 
   do
   {
-    bd = rtems_bdbuf_avl_search (&bdbuf_cache.tree, dd, block);
+    bd = rtems_bdbuf_hash_search (dd, block);
 
     if (bd != NULL)
     {
@@ -1738,7 +1669,7 @@ rtems_bdbuf_get_buffer_for_access (rtems_disk_device *dd,
       {
         if (rtems_bdbuf_wait_for_recycle (bd))
         {
-          rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+          rtems_bdbuf_remove_from_hash_and_lru_list (bd);
           rtems_bdbuf_make_free_and_add_to_lru_list (bd);
           rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
         }
@@ -1785,6 +1716,110 @@ rtems_bdbuf_get_media_block (const rtems_disk_device *dd,
   return sc;
 }
 
+/**
+ * Returns true if a read of the block triggers a read-ahead request.
+ */
+static bool
+rtems_bdbuf_is_read_ahead_trigger (const rtems_disk_device *dd,
+                                   rtems_blkdev_bnum        block)
+{
+  size_t i;
+
+  if (bdbuf_cache.read_ahead_task == 0)
+    return false;
+
+  for (i = 0; i < RTEMS_DISK_READ_AHEAD_STREAM_COUNT; ++i)
+  {
+    if (dd->read_ahead.streams[i].trigger == block)
+      return true;
+  }
+
+  return false;
+}
+
+/**
+ * Tries to get a cached buffer with only the stripe of the block locked. The
+ * BD stays on the LRU list or the frequent queue while it is accessed. Hits
+ * which change cache data, for example the promotion to the frequent queue or
+ * a read-ahead trigger, need the cache lock.
+ *
+ * @param dd The disk device.
+ * @param block The block number on the disk.
+ * @param media_block The media block number of the block.
+ * @param read True for a read, false for a get.
+ *
+ * @retval NULL The buffer must be obtained with the cache locked.
+ * @return The BD in the ACCESS_CACHED state.
+ */
+static rtems_bdbuf_buffer *
+rtems_bdbuf_try_fast_access (rtems_disk_device *dd,
+                             rtems_blkdev_bnum  block,
+                             rtems_blkdev_bnum  media_block,
+                             bool               read)
+{
+  rtems_mutex        *stripe_lock = rtems_bdbuf_stripe_lock (dd, media_block);
+  rtems_bdbuf_buffer *bd;
+
+  rtems_bdbuf_lock (stripe_lock);
+
+  bd = rtems_bdbuf_hash_search (dd, media_block);
+
+  if (bd != NULL
+      && bd->state == RTEMS_BDBUF_STATE_CACHED
+      && bd->waiters == 0
+      && bd->group->bds_per_group == dd->bds_per_group
+      && !rtems_bdbuf_policy_promotes (bd)
+      && !(read && rtems_bdbuf_is_read_ahead_trigger (dd, block)))
+  {
+    if (read)
+      rtems_bdbuf_count_hit (&dd->stats.read_hits);
+
+    rtems_bdbuf_policy_hit (bd);
+    bd->lru_access = true;
+    bd->referenced = true;
+    rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_CACHED);
+  }
+  else
+  {
+    bd = NULL;
+  }
+
+  rtems_bdbuf_unlock (stripe_lock);
+
+  return bd;
+}
+
+/**
+ * Tries to release a buffer accessed after a hit without the cache lock with
+ * only the stripe of the block locked. This is not possible if someone waits
+ * for this or any buffer, since the waiters are woken with the cache locked.
+ *
+ * @retval true The buffer is released.
+ * @retval false The buffer must be released with the cache locked.
+ */
+static bool
+rtems_bdbuf_try_fast_release (rtems_bdbuf_buffer *bd)
+{
+  rtems_mutex *stripe_lock = rtems_bdbuf_stripe_lock (bd->dd, bd->block);
+  bool         released = false;
+
+  rtems_bdbuf_lock (stripe_lock);
+
+  if (bd->lru_access
+      && bd->state == RTEMS_BDBUF_STATE_ACCESS_CACHED
+      && bd->waiters == 0
+      && !rtems_bdbuf_has_buffer_waiters ())
+  {
+    bd->lru_access = false;
+    rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_CACHED);
+    released = true;
+  }
+
+  rtems_bdbuf_unlock (stripe_lock);
+
+  return released;
+}
+
 rtems_status_code
 rtems_bdbuf_get (rtems_disk_device   *dd,
                  rtems_blkdev_bnum    block,
@@ -1794,8 +1829,6 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
   rtems_bdbuf_buffer *bd = NULL;
   rtems_blkdev_bnum   media_block;
 
-  rtems_bdbuf_lock_cache ();
-
   sc = rtems_bdbuf_get_media_block (dd, block, &media_block);
   if (sc == RTEMS_SUCCESSFUL)
   {
@@ -1806,17 +1839,28 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
       printf ("bdbuf:get: %" PRIu32 " (%" PRIu32 ") (dev = %08x)\n",
               media_block, block, (unsigned) dd->dev);
 
+    bd = rtems_bdbuf_try_fast_access (dd, block, media_block, false);
+    if (bd != NULL)
+    {
+      *bd_ptr = bd;
+      return sc;
+    }
+
+    rtems_bdbuf_lock_cache ();
+
     bd = rtems_bdbuf_get_buffer_for_access (dd, media_block);
 
     switch (bd->state)
     {
       case RTEMS_BDBUF_STATE_CACHED:
+        rtems_bdbuf_policy_hit (bd);
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_CACHED);
         break;
       case RTEMS_BDBUF_STATE_EMPTY:
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_EMPTY);
         break;
       case RTEMS_BDBUF_STATE_MODIFIED:
+        rtems_bdbuf_policy_hit (bd);
         /*
          * To get a modified buffer could be considered a bug in the caller
          * because you should not be getting an already modified buffer but
@@ -1836,9 +1880,9 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
       rtems_bdbuf_show_users ("get", bd);
       rtems_bdbuf_show_usage ();
     }
-  }
 
-  rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_unlock_cache ();
+  }
 
   *bd_ptr = bd;
 
@@ -1996,48 +2040,89 @@ rtems_bdbuf_execute_read_request (rtems_disk_device  *dd,
 }
 
 static bool
-rtems_bdbuf_is_read_ahead_active (const rtems_disk_device *dd)
+rtems_bdbuf_is_read_ahead_active (const rtems_blkdev_read_ahead_stream *stream)
 {
-  return !rtems_chain_is_node_off_chain (&dd->read_ahead.node);
+  return !rtems_chain_is_node_off_chain (&stream->node);
 }
 
 static void
-rtems_bdbuf_read_ahead_cancel (rtems_disk_device *dd)
+rtems_bdbuf_read_ahead_cancel (rtems_blkdev_read_ahead_stream *stream)
 {
-  if (rtems_bdbuf_is_read_ahead_active (dd))
+  if (rtems_bdbuf_is_read_ahead_active (stream))
   {
-    rtems_chain_extract_unprotected (&dd->read_ahead.node);
-    rtems_chain_set_off_chain (&dd->read_ahead.node);
+    rtems_chain_extract_unprotected (&stream->node);
+    rtems_chain_set_off_chain (&stream->node);
   }
 }
 
 static void
 rtems_bdbuf_read_ahead_reset (rtems_disk_device *dd)
 {
-  rtems_bdbuf_read_ahead_cancel (dd);
-  dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+  size_t i;
+
+  for (i = 0; i < RTEMS_DISK_READ_AHEAD_STREAM_COUNT; ++i)
+  {
+    rtems_blkdev_read_ahead_stream *stream = &dd->read_ahead.streams[i];
+
+    rtems_bdbuf_read_ahead_cancel (stream);
+    stream->trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+  }
+}
+
+static void
+rtems_bdbuf_read_ahead_touch (rtems_disk_device              *dd,
+                              rtems_blkdev_read_ahead_stream *stream)
+{
+  stream->age = ++dd->read_ahead.clock;
 }
 
 static void
 rtems_bdbuf_check_read_ahead_trigger (rtems_disk_device *dd,
-                                      rtems_blkdev_bnum  block)
+                                      rtems_blkdev_bnum  block,
+                                      bool               hit)
 {
-  if (bdbuf_cache.read_ahead_task != 0
-      && dd->read_ahead.trigger == block
-      && !rtems_bdbuf_is_read_ahead_active (dd))
+  size_t i;
+
+  if (bdbuf_cache.read_ahead_task == 0)
+    return;
+
+  for (i = 0; i < RTEMS_DISK_READ_AHEAD_STREAM_COUNT; ++i)
   {
-    rtems_status_code sc;
-    rtems_chain_control *chain = &bdbuf_cache.read_ahead_chain;
+    rtems_blkdev_read_ahead_stream *stream = &dd->read_ahead.streams[i];
 
-    if (rtems_chain_is_empty (chain))
+    if (stream->trigger == block
+        && !rtems_bdbuf_is_read_ahead_active (stream))
     {
-      sc = rtems_event_send (bdbuf_cache.read_ahead_task,
-                             RTEMS_BDBUF_READ_AHEAD_WAKE_UP);
-      if (sc != RTEMS_SUCCESSFUL)
-        rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RA_WAKE_UP);
-    }
+      rtems_status_code sc;
+      rtems_chain_control *chain = &bdbuf_cache.read_ahead_chain;
+
+      /*
+       * The trigger block is present, so the previous read-ahead request was
+       * early enough.  Grow the window to keep ahead of the reader.
+       */
+      if (hit)
+      {
+        ++dd->stats.read_ahead_hits;
 
-    rtems_chain_append_unprotected (chain, &dd->read_ahead.node);
+        if (stream->window < bdbuf_config.max_read_ahead_blocks / 2)
+          stream->window *= 2;
+        else
+          stream->window = bdbuf_config.max_read_ahead_blocks;
+      }
+
+      rtems_bdbuf_read_ahead_touch (dd, stream);
+
+      if (rtems_chain_is_empty (chain))
+      {
+        sc = rtems_event_send (bdbuf_cache.read_ahead_task,
+                               RTEMS_BDBUF_READ_AHEAD_WAKE_UP);
+        if (sc != RTEMS_SUCCESSFUL)
+          rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RA_WAKE_UP);
+      }
+
+      rtems_chain_append_unprotected (chain, &stream->node);
+      break;
+    }
   }
 }
 
@@ -2045,12 +2130,67 @@ static void
 rtems_bdbuf_set_read_ahead_trigger (rtems_disk_device *dd,
                                     rtems_blkdev_bnum  block)
 {
-  if (dd->read_ahead.trigger != block)
+  rtems_blkdev_read_ahead_stream *victim = NULL;
+  uint32_t                        victim_age = 0;
+  size_t                          i;
+
+  if (bdbuf_cache.read_ahead_task == 0)
+    return;
+
+  for (i = 0; i < RTEMS_DISK_READ_AHEAD_STREAM_COUNT; ++i)
+  {
+    rtems_blkdev_read_ahead_stream *stream = &dd->read_ahead.streams[i];
+    uint32_t                        age;
+
+    if (stream->trigger != RTEMS_DISK_READ_AHEAD_NO_TRIGGER
+        && stream->begin <= block && block < stream->next)
+    {
+      /*
+       * The block was read ahead by this stream but is no longer in the
+       * cache.  The window is too large for the cache pressure, so shrink it.
+       * Restart the stream at this block unless it is the trigger block.
+       */
+      ++dd->stats.read_ahead_misses;
+
+      if (stream->window > 1)
+        stream->window /= 2;
+
+      if (stream->trigger == block)
+        return;
+
+      victim = stream;
+      break;
+    }
+
+    if (stream->trigger == block)
+      return;
+
+    /*
+     * Prefer a free stream, otherwise replace the least recently used stream.
+     */
+    if (stream->trigger == RTEMS_DISK_READ_AHEAD_NO_TRIGGER)
+      age = UINT32_MAX;
+    else
+      age = dd->read_ahead.clock - stream->age;
+
+    if (victim == NULL || age > victim_age)
+    {
+      victim = stream;
+      victim_age = age;
+    }
+  }
+
+  if (i == RTEMS_DISK_READ_AHEAD_STREAM_COUNT)
   {
-    rtems_bdbuf_read_ahead_cancel (dd);
-    dd->read_ahead.trigger = block + 1;
-    dd->read_ahead.next = block + 2;
+    ++dd->stats.read_ahead_streams;
+    victim->window = bdbuf_config.max_read_ahead_blocks;
   }
+
+  rtems_bdbuf_read_ahead_cancel (victim);
+  rtems_bdbuf_read_ahead_touch (dd, victim);
+  victim->trigger = block + 1;
+  victim->next = block + 2;
+  victim->begin = victim->next;
 }
 
 rtems_status_code
@@ -2061,8 +2201,7 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
   rtems_status_code     sc = RTEMS_SUCCESSFUL;
   rtems_bdbuf_buffer   *bd = NULL;
   rtems_blkdev_bnum     media_block;
-
-  rtems_bdbuf_lock_cache ();
+  bool                  hit = true;
 
   sc = rtems_bdbuf_get_media_block (dd, block, &media_block);
   if (sc == RTEMS_SUCCESSFUL)
@@ -2071,29 +2210,48 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
       printf ("bdbuf:read: %" PRIu32 " (%" PRIu32 ") (dev = %08x)\n",
               media_block, block, (unsigned) dd->dev);
 
+    bd = rtems_bdbuf_try_fast_access (dd, block, media_block, true);
+    if (bd != NULL)
+    {
+      *bd_ptr = bd;
+      return sc;
+    }
+
+    rtems_bdbuf_lock_cache ();
+
     bd = rtems_bdbuf_get_buffer_for_access (dd, media_block);
     switch (bd->state)
     {
       case RTEMS_BDBUF_STATE_CACHED:
         ++dd->stats.read_hits;
+        rtems_bdbuf_policy_hit (bd);
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_CACHED);
         break;
       case RTEMS_BDBUF_STATE_MODIFIED:
         ++dd->stats.read_hits;
+        rtems_bdbuf_policy_hit (bd);
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_MODIFIED);
         break;
       case RTEMS_BDBUF_STATE_EMPTY:
         ++dd->stats.read_misses;
+        hit = false;
         rtems_bdbuf_set_read_ahead_trigger (dd, block);
         sc = rtems_bdbuf_execute_read_request (dd, bd, 1);
-        if (sc == RTEMS_SUCCESSFUL)
+        if (sc == RTEMS_SUCCESSFUL && bd->state == RTEMS_BDBUF_STATE_CACHED)
         {
+          rtems_bdbuf_extract_from_lru_list (bd);
           rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_CACHED);
-          rtems_chain_extract_unprotected (&bd->link);
           rtems_bdbuf_group_obtain (bd);
         }
         else
         {
+          /*
+           * The buffer was discarded, since the device was purged during the
+           * transfer.
+           */
+          if (sc == RTEMS_SUCCESSFUL)
+            sc = RTEMS_IO_ERROR;
+
           bd = NULL;
         }
         break;
@@ -2102,16 +2260,152 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
         break;
     }
 
-    rtems_bdbuf_check_read_ahead_trigger (dd, block);
-  }
+    rtems_bdbuf_check_read_ahead_trigger (dd, block, hit);
 
-  rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_unlock_cache ();
+  }
 
   *bd_ptr = bd;
 
   return sc;
 }
 
+/**
+ * Returns true if the BD contains the current data of its block or will
+ * contain it after the current transfer, otherwise the data on the device is
+ * current.
+ */
+static bool
+rtems_bdbuf_has_valid_data (const rtems_bdbuf_buffer *bd)
+{
+  switch (bd->state)
+  {
+    case RTEMS_BDBUF_STATE_FREE:
+    case RTEMS_BDBUF_STATE_EMPTY:
+    case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
+    case RTEMS_BDBUF_STATE_ACCESS_PURGED:
+    case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
+      return false;
+    default:
+      return true;
+  }
+}
+
+static bool
+rtems_bdbuf_is_cached (const rtems_disk_device *dd,
+                       rtems_blkdev_bnum        media_block)
+{
+  const rtems_bdbuf_buffer *bd = rtems_bdbuf_hash_search (dd, media_block);
+
+  return bd != NULL && rtems_bdbuf_has_valid_data (bd);
+}
+
+rtems_status_code
+rtems_bdbuf_read_direct (rtems_disk_device *dd,
+                         rtems_blkdev_bnum  block,
+                         uint32_t           block_count,
+                         void              *buffer)
+{
+  rtems_status_code     sc = RTEMS_SUCCESSFUL;
+  rtems_blkdev_request *req;
+  uint8_t              *dst = buffer;
+  uint32_t              block_size = dd->block_size;
+  uint32_t              media_blocks_per_block = dd->media_blocks_per_block;
+
+  if (block > dd->block_count || block_count > dd->block_count - block)
+    return RTEMS_INVALID_ID;
+
+  req = bdbuf_alloc (rtems_bdbuf_read_request_size (
+    RTEMS_BDBUF_DIRECT_READ_MAX_BLOCKS));
+
+  rtems_bdbuf_lock_cache ();
+
+  while (sc == RTEMS_SUCCESSFUL && block_count > 0)
+  {
+    rtems_blkdev_bnum media_block;
+    uint32_t          transfer_count = 0;
+
+    rtems_bdbuf_get_media_block (dd, block, &media_block);
+
+    if (rtems_bdbuf_is_cached (dd, media_block))
+    {
+      rtems_bdbuf_buffer *bd;
+
+      /*
+       * The cached block may be newer than the block on the device, so use
+       * the normal read path which also waits for transfers and other users.
+       */
+      rtems_bdbuf_unlock_cache ();
+
+      sc = rtems_bdbuf_read (dd, block, &bd);
+      if (sc == RTEMS_SUCCESSFUL)
+      {
+        memcpy (dst, bd->buffer, block_size);
+        sc = rtems_bdbuf_release (bd);
+      }
+
+      rtems_bdbuf_lock_cache ();
+
+      transfer_count = 1;
+    }
+    else
+    {
+      /*
+       * Transfer the run of blocks not in the cache directly into the user
+       * buffer.
+       */
+      do
+      {
+        rtems_blkdev_sg_buffer *buf = &req->bufs [transfer_count];
+
+        buf->user   = NULL;
+        buf->block  = media_block;
+        buf->length = block_size;
+        buf->buffer = dst + transfer_count * block_size;
+
+        ++transfer_count;
+        media_block += media_blocks_per_block;
+      }
+      while (transfer_count < block_count
+             && transfer_count < RTEMS_BDBUF_DIRECT_READ_MAX_BLOCKS
+             && !rtems_bdbuf_is_cached (dd, media_block));
+
+      req->req = RTEMS_BLKDEV_REQ_READ;
+      req->done = rtems_bdbuf_transfer_done;
+      req->io_task = rtems_task_self ();
+      req->status = RTEMS_RESOURCE_IN_USE;
+      req->bufnum = transfer_count;
+
+      rtems_bdbuf_unlock_cache ();
+
+      /* The return value will be ignored for transfer requests */
+      dd->ioctl (dd->phys_dev, RTEMS_BLKIO_REQUEST, req);
+
+      /* Wait for transfer request completion */
+      rtems_bdbuf_wait_for_transient_event ();
+      sc = req->status;
+
+      rtems_bdbuf_lock_cache ();
+
+      dd->stats.read_blocks += transfer_count;
+      ++dd->stats.read_direct_transfers;
+      if (sc != RTEMS_SUCCESSFUL)
+      {
+        ++dd->stats.read_errors;
+        sc = RTEMS_IO_ERROR;
+      }
+    }
+
+    block += transfer_count;
+    block_count -= transfer_count;
+    dst += transfer_count * block_size;
+  }
+
+  rtems_bdbuf_unlock_cache ();
+
+  return sc;
+}
+
 static rtems_status_code
 rtems_bdbuf_check_bd_and_lock_cache (rtems_bdbuf_buffer *bd, const char *kind)
 {
@@ -2124,6 +2418,12 @@ rtems_bdbuf_check_bd_and_lock_cache (rtems_bdbuf_buffer *bd, const char *kind)
   }
   rtems_bdbuf_lock_cache();
 
+  /*
+   * A buffer accessed after a hit without the cache lock is still on the LRU
+   * list or the frequent queue.
+   */
+  rtems_bdbuf_end_lru_access (bd);
+
   return RTEMS_SUCCESSFUL;
 }
 
@@ -2132,6 +2432,9 @@ rtems_bdbuf_release (rtems_bdbuf_buffer *bd)
 {
   rtems_status_code sc = RTEMS_SUCCESSFUL;
 
+  if (bd != NULL && rtems_bdbuf_try_fast_release (bd))
+    return RTEMS_SUCCESSFUL;
+
   sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "release");
   if (sc != RTEMS_SUCCESSFUL)
     return sc;
@@ -2259,6 +2562,80 @@ rtems_bdbuf_syncdev (rtems_disk_device *dd)
   return RTEMS_SUCCESSFUL;
 }
 
+/**
+ * Fill the gap between the last block of the write request and the block of
+ * the BD with cached buffers, so that a driver which needs continuous blocks
+ * can write both in one request. The gap buffers are moved to the transfer
+ * state and written like modified buffers. All blocks of the gap must be
+ * cached, otherwise nothing is done. The cache is not locked.
+ *
+ * @param transfer The transfer transaction.
+ * @param last_block The last media block of the write request.
+ * @param bd The next buffer to write.
+ *
+ * @retval true The gap was filled.
+ * @retval false Otherwise.
+ */
+static bool
+rtems_bdbuf_swapout_fill_gap (rtems_bdbuf_swapout_transfer* transfer,
+                              rtems_blkdev_bnum             last_block,
+                              const rtems_bdbuf_buffer*     bd)
+{
+  rtems_disk_device    *dd = transfer->dd;
+  rtems_blkdev_request *req = &transfer->write_req;
+  uint32_t              media_blocks_per_block = dd->media_blocks_per_block;
+  uint32_t              gap;
+  uint32_t              i;
+  bool                  filled = false;
+
+  if (bd->block <= last_block)
+    return false;
+
+  gap = (bd->block - last_block) / media_blocks_per_block - 1;
+
+  if (gap == 0 || gap > bdbuf_config.max_write_gap_blocks
+      || req->bufnum + gap >= bdbuf_config.max_write_blocks)
+    return false;
+
+  rtems_bdbuf_lock_cache ();
+
+  for (i = 1; i <= gap; ++i)
+  {
+    rtems_bdbuf_buffer* gap_bd =
+      rtems_bdbuf_hash_search (dd, last_block + i * media_blocks_per_block);
+
+    if (gap_bd == NULL || gap_bd->state != RTEMS_BDBUF_STATE_CACHED)
+      break;
+  }
+
+  if (i > gap)
+  {
+    for (i = 1; i <= gap; ++i)
+    {
+      rtems_bdbuf_buffer* gap_bd =
+        rtems_bdbuf_hash_search (dd, last_block + i * media_blocks_per_block);
+      rtems_blkdev_sg_buffer* buf = &req->bufs[req->bufnum];
+
+      rtems_bdbuf_extract_from_lru_list (gap_bd);
+      rtems_bdbuf_group_obtain (gap_bd);
+      rtems_bdbuf_set_state (gap_bd, RTEMS_BDBUF_STATE_TRANSFER);
+
+      req->bufnum++;
+      buf->user   = gap_bd;
+      buf->block  = gap_bd->block;
+      buf->length = dd->block_size;
+      buf->buffer = gap_bd->buffer;
+    }
+
+    dd->stats.write_gap_blocks += gap;
+    filled = true;
+  }
+
+  rtems_bdbuf_unlock_cache ();
+
+  return filled;
+}
+
 /**
  * Swapout transfer to the driver. The driver will break this I/O into groups
  * of consecutive write requests is multiple consecutive buffers are required
@@ -2320,7 +2697,8 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
                 need_continuous_blocks ? "MULTI" : "SCAT");
 
       if (need_continuous_blocks && transfer->write_req.bufnum &&
-          bd->block != last_block + media_blocks_per_block)
+          bd->block != last_block + media_blocks_per_block &&
+          !rtems_bdbuf_swapout_fill_gap (transfer, last_block, bd))
       {
         rtems_chain_prepend_unprotected (&transfer->bds, &bd->link);
         write = true;
@@ -2773,75 +3151,49 @@ static void
 rtems_bdbuf_gather_for_purge (rtems_chain_control *purge_list,
                               const rtems_disk_device *dd)
 {
-  rtems_bdbuf_buffer *stack [RTEMS_BDBUF_AVL_MAX_HEIGHT];
-  rtems_bdbuf_buffer **prev = stack;
-  rtems_bdbuf_buffer *cur = bdbuf_cache.tree;
+  size_t bucket;
 
-  *prev = NULL;
-
-  while (cur != NULL)
+  for (bucket = 0; bucket <= bdbuf_cache.hash_mask; ++bucket)
   {
-    if (cur->dd == dd)
-    {
-      switch (cur->state)
-      {
-        case RTEMS_BDBUF_STATE_FREE:
-        case RTEMS_BDBUF_STATE_EMPTY:
-        case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-        case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-          break;
-        case RTEMS_BDBUF_STATE_SYNC:
-          rtems_bdbuf_wake (&bdbuf_cache.transfer_waiters);
-          /* Fall through */
-        case RTEMS_BDBUF_STATE_MODIFIED:
-          rtems_bdbuf_group_release (cur);
-          /* Fall through */
-        case RTEMS_BDBUF_STATE_CACHED:
-          rtems_chain_extract_unprotected (&cur->link);
-          rtems_chain_append_unprotected (purge_list, &cur->link);
-          break;
-        case RTEMS_BDBUF_STATE_TRANSFER:
-          rtems_bdbuf_set_state (cur, RTEMS_BDBUF_STATE_TRANSFER_PURGED);
-          break;
-        case RTEMS_BDBUF_STATE_ACCESS_CACHED:
-        case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
-        case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-          rtems_bdbuf_set_state (cur, RTEMS_BDBUF_STATE_ACCESS_PURGED);
-          break;
-        default:
-          rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_STATE_11);
-      }
-    }
+    rtems_bdbuf_buffer *cur = bdbuf_cache.hash_table[bucket];
 
-    if (cur->avl.left != NULL)
-    {
-      /* Left */
-      ++prev;
-      *prev = cur;
-      cur = cur->avl.left;
-    }
-    else if (cur->avl.right != NULL)
-    {
-      /* Right */
-      ++prev;
-      *prev = cur;
-      cur = cur->avl.right;
-    }
-    else
+    while (cur != NULL)
     {
-      while (*prev != NULL
-             && (cur == (*prev)->avl.right || (*prev)->avl.right == NULL))
+      if (cur->dd == dd)
       {
-        /* Up */
-        cur = *prev;
-        --prev;
+        switch (cur->state)
+        {
+          case RTEMS_BDBUF_STATE_FREE:
+          case RTEMS_BDBUF_STATE_EMPTY:
+          case RTEMS_BDBUF_STATE_ACCESS_PURGED:
+          case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
+            break;
+          case RTEMS_BDBUF_STATE_SYNC:
+            rtems_bdbuf_wake (&bdbuf_cache.transfer_waiters);
+            /* Fall through */
+          case RTEMS_BDBUF_STATE_MODIFIED:
+            rtems_bdbuf_group_release (cur);
+            /* Fall through */
+          case RTEMS_BDBUF_STATE_CACHED:
+            rtems_bdbuf_extract_from_lru_list (cur);
+            rtems_chain_append_unprotected (purge_list, &cur->link);
+            break;
+          case RTEMS_BDBUF_STATE_TRANSFER:
+            rtems_bdbuf_set_state (cur, RTEMS_BDBUF_STATE_TRANSFER_PURGED);
+            break;
+          case RTEMS_BDBUF_STATE_ACCESS_CACHED:
+            rtems_bdbuf_end_lru_access (cur);
+            /* Fall through */
+          case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
+          case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
+            rtems_bdbuf_set_state (cur, RTEMS_BDBUF_STATE_ACCESS_PURGED);
+            break;
+          default:
+            rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_STATE_11);
+        }
       }
-      if (*prev != NULL)
-        /* Right */
-        cur = (*prev)->avl.right;
-      else
-        /* Finished */
-        cur = NULL;
+
+      cur = cur->hash_next;
     }
   }
 }
@@ -2936,14 +3288,16 @@ rtems_bdbuf_read_ahead_task (rtems_task_argument arg)
 
     while ((node = rtems_chain_get_unprotected (chain)) != NULL)
     {
-      rtems_disk_device *dd =
-        RTEMS_CONTAINER_OF (node, rtems_disk_device, read_ahead.node);
-      rtems_blkdev_bnum block = dd->read_ahead.next;
+      rtems_blkdev_read_ahead_stream *stream =
+        RTEMS_CONTAINER_OF (node, rtems_blkdev_read_ahead_stream, node);
+      rtems_disk_device *dd = stream->dd;
+      rtems_blkdev_bnum block = stream->next;
       rtems_blkdev_bnum media_block = 0;
       rtems_status_code sc =
         rtems_bdbuf_get_media_block (dd, block, &media_block);
 
-      rtems_chain_set_off_chain (&dd->read_ahead.node);
+      rtems_chain_set_off_chain (&stream->node);
+      stream->begin = block;
 
       if (sc == RTEMS_SUCCESSFUL)
       {
@@ -2953,17 +3307,17 @@ rtems_bdbuf_read_ahead_task (rtems_task_argument arg)
         if (bd != NULL)
         {
           uint32_t transfer_count = dd->block_count - block;
-          uint32_t max_transfer_count = bdbuf_config.max_read_ahead_blocks;
+          uint32_t max_transfer_count = stream->window;
 
           if (transfer_count >= max_transfer_count)
           {
             transfer_count = max_transfer_count;
-            dd->read_ahead.trigger = block + transfer_count / 2;
-            dd->read_ahead.next = block + transfer_count;
+            stream->trigger = block + transfer_count / 2;
+            stream->next = block + transfer_count;
           }
           else
           {
-            dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+            stream->trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
           }
 
           ++dd->stats.read_ahead_transfers;
@@ -2972,7 +3326,7 @@ rtems_bdbuf_read_ahead_task (rtems_task_argument arg)
       }
       else
       {
-        dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+        stream->trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
       }
     }
 
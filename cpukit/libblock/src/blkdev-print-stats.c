@@ -28,6 +28,18 @@
 
 #include <inttypes.h>
 
+/*
+ * Returns the average blocks per transfer in hundredths of a block.
+ */
+static uint32_t average_request_size(uint32_t blocks, uint32_t transfers)
+{
+  if (transfers == 0) {
+    return 0;
+  }
+
+  return (uint32_t) (((uint64_t) blocks * 100) / transfers);
+}
+
 void rtems_blkdev_print_stats(
   const rtems_blkdev_stats *stats,
   uint32_t media_block_size,
@@ -36,6 +48,16 @@ void rtems_blkdev_print_stats(
   const rtems_printer* printer
 )
 {
+  uint32_t read_request_size = average_request_size(
+    stats->read_blocks,
+    stats->read_misses + stats->read_ahead_transfers
+      + stats->read_direct_transfers
+  );
+  uint32_t write_request_size = average_request_size(
+    stats->write_blocks,
+    stats->write_transfers
+  );
+
   rtems_printf(
      printer,
      "-------------------------------------------------------------------------------\n"
@@ -47,11 +69,22 @@ void rtems_blkdev_print_stats(
      " READ HITS            | %" PRIu32 "\n"
      " READ MISSES          | %" PRIu32 "\n"
      " READ AHEAD TRANSFERS | %" PRIu32 "\n"
+     " READ AHEAD STREAMS   | %" PRIu32 "\n"
+     " READ AHEAD HITS      | %" PRIu32 "\n"
+     " READ AHEAD MISSES    | %" PRIu32 "\n"
+     " DIRECT TRANSFERS     | %" PRIu32 "\n"
      " READ BLOCKS          | %" PRIu32 "\n"
      " READ ERRORS          | %" PRIu32 "\n"
      " WRITE TRANSFERS      | %" PRIu32 "\n"
      " WRITE BLOCKS         | %" PRIu32 "\n"
      " WRITE ERRORS         | %" PRIu32 "\n"
+     " WRITE GAP BLOCKS     | %" PRIu32 "\n"
+     " READ REQUEST SIZE    | %" PRIu32 ".%02" PRIu32 "\n"
+     " WRITE REQUEST SIZE   | %" PRIu32 ".%02" PRIu32 "\n"
+     " RECENT HITS          | %" PRIu32 "\n"
+     " FREQUENT HITS        | %" PRIu32 "\n"
+     " RECENT MISSES        | %" PRIu32 "\n"
+     " FREQUENT MISSES      | %" PRIu32 "\n"
      "----------------------+--------------------------------------------------------\n",
      media_block_size,
      media_block_count,
@@ -59,10 +92,23 @@ void rtems_blkdev_print_stats(
      stats->read_hits,
      stats->read_misses,
      stats->read_ahead_transfers,
+     stats->read_ahead_streams,
+     stats->read_ahead_hits,
+     stats->read_ahead_misses,
+     stats->read_direct_transfers,
      stats->read_blocks,
      stats->read_errors,
      stats->write_transfers,
      stats->write_blocks,
-     stats->write_errors
+     stats->write_errors,
+     stats->write_gap_blocks,
+     read_request_size / 100,
+     read_request_size % 100,
+     write_request_size / 100,
+     write_request_size % 100,
+     stats->recent_hits,
+     stats->frequent_hits,
+     stats->recent_misses,
+     stats->frequent_misses
   );
 }
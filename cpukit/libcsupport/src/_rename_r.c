@@ -65,13 +65,18 @@ int _rename_r(
     new_currentloc
   );
   if ( rv == 0 ) {
+    const char *new_name = rtems_filesystem_eval_path_get_token( &new_ctx );
+    size_t new_namelen = rtems_filesystem_eval_path_get_tokenlen( &new_ctx );
+
     rv = (*new_currentloc->mt_entry->ops->rename_h)(
       &old_parentloc,
       old_currentloc,
       new_currentloc,
-      rtems_filesystem_eval_path_get_token( &new_ctx ),
-      rtems_filesystem_eval_path_get_tokenlen( &new_ctx )
+      new_name,
+      new_namelen
     );
+    rtems_filesystem_name_cache_purge_node( old_currentloc );
+    rtems_filesystem_name_cache_remove( new_currentloc, new_name, new_namelen );
   }
 
   rtems_filesystem_eval_path_cleanup_with_parent( &old_ctx, &old_parentloc );
@@ -106,26 +106,52 @@ int rtems_libio_to_fcntl_flags( unsigned int flags )
   return fcntl_flags;
 }
 
+static unsigned int rtems_libio_iop_free_index( const rtems_libio_t *iop )
+{
+  if ( iop == NULL ) {
+    return 0;
+  }
+
+  return (unsigned int) ( iop - &rtems_libio_iops[ 0 ] ) + 1;
+}
+
 rtems_libio_t *rtems_libio_allocate( void )
 {
   rtems_libio_t *iop;
+  unsigned int   mask;
+  unsigned int   head;
+  bool           success;
 
-  rtems_libio_lock();
-
-  iop = rtems_libio_iop_free_head;
+  mask = rtems_libio_iop_free_index_mask();
+  head = _Atomic_Load_uint( &rtems_libio_iop_free_head, ATOMIC_ORDER_ACQUIRE );
 
-  if ( iop != NULL ) {
-    void *next;
+  do {
+    const rtems_libio_t *next;
+    unsigned int         desired;
 
-    next = iop->data1;
-    rtems_libio_iop_free_head = next;
-
-    if ( next == NULL ) {
-      rtems_libio_iop_free_tail = &rtems_libio_iop_free_head;
+    if ( ( head & mask ) == 0 ) {
+      return NULL;
     }
-  }
 
-  rtems_libio_unlock();
+    /*
+     * The iop may be allocated by another thread in the meantime.  In this
+     * case the next value is garbage, however, the generation count of the
+     * head changed and the compare and exchange fails.
+     */
+    iop = &rtems_libio_iops[ ( head & mask ) - 1 ];
+    next = iop->data1;
+    desired = ( ( head | mask ) + 1 )
+      | ( rtems_libio_iop_free_index( next ) & mask );
+    success = _Atomic_Compare_exchange_uint(
+      &rtems_libio_iop_free_head,
+      &head,
+      desired,
+      ATOMIC_ORDER_ACQUIRE,
+      ATOMIC_ORDER_ACQUIRE
+    );
+  } while ( !success );
+
+  rtems_libio_iop_flags_clear( iop, LIBIO_FLAGS_FREE );
 
   return iop;
 }
@@ -134,12 +160,13 @@ void rtems_libio_free(
   rtems_libio_t *iop
 )
 {
-  size_t zero;
+  size_t       zero;
+  unsigned int mask;
+  unsigned int head;
+  bool         success;
 
   rtems_filesystem_location_free( &iop->pathinfo );
 
-  rtems_libio_lock();
-
   /*
    * Clear everything except the reference count part.  At this point in time
    * there may be still some holders of this file descriptor.
@@ -147,13 +174,47 @@ void rtems_libio_free(
   rtems_libio_iop_flags_clear( iop, LIBIO_FLAGS_REFERENCE_INC - 1U );
   zero = offsetof( rtems_libio_t, offset );
   memset( (char *) iop + zero, 0, sizeof( *iop ) - zero );
+  rtems_libio_iop_flags_set( iop, LIBIO_FLAGS_FREE );
 
-  /*
-   * Append it to the free list.  This increases the likelihood that a use
-   * after close is detected.
-   */
-  *rtems_libio_iop_free_tail = iop;
-  rtems_libio_iop_free_tail = &iop->data1;
+  mask = rtems_libio_iop_free_index_mask();
+  head = _Atomic_Load_uint( &rtems_libio_iop_free_head, ATOMIC_ORDER_RELAXED );
+
+  do {
+    unsigned int desired;
+
+    if ( ( head & mask ) != 0 ) {
+      iop->data1 = &rtems_libio_iops[ ( head & mask ) - 1 ];
+    } else {
+      iop->data1 = NULL;
+    }
+
+    desired = ( ( head | mask ) + 1 ) | rtems_libio_iop_free_index( iop );
+    success = _Atomic_Compare_exchange_uint(
+      &rtems_libio_iop_free_head,
+      &head,
+      desired,
+      ATOMIC_ORDER_RELEASE,
+      ATOMIC_ORDER_RELAXED
+    );
+  } while ( !success );
+}
+
+uint32_t rtems_libio_count_used_iops( void )
+{
+  uint32_t used;
+  uint32_t i;
+
+  used = 0;
+
+  for ( i = 0; i < rtems_libio_number_iops; ++i ) {
+    unsigned int flags;
+
+    flags = rtems_libio_iop_flags( &rtems_libio_iops[ i ] );
+
+    if ( ( flags & LIBIO_FLAGS_FREE ) == 0 ) {
+      ++used;
+    }
+  }
 
-  rtems_libio_unlock();
+  return used;
 }
@@ -41,9 +41,7 @@ void rtems_libio_unlock( void )
   _API_Mutex_Unlock( &rtems_libio_mutex );
 }
 
-void *rtems_libio_iop_free_head;
-
-void **rtems_libio_iop_free_tail = &rtems_libio_iop_free_head;
+Atomic_Uint rtems_libio_iop_free_head = ATOMIC_INITIALIZER_UINT( 0 );
 
 static void rtems_libio_init( void )
 {
@@ -52,11 +50,14 @@ static void rtems_libio_init( void )
 
     if (rtems_libio_number_iops > 0)
     {
-        iop = rtems_libio_iop_free_head = &rtems_libio_iops[0];
-        for (i = 0 ; (i + 1) < rtems_libio_number_iops ; i++, iop++)
+        iop = &rtems_libio_iops[0];
+        for (i = 0 ; (i + 1) < rtems_libio_number_iops ; i++, iop++) {
           iop->data1 = iop + 1;
+          rtems_libio_iop_flags_set(iop, LIBIO_FLAGS_FREE);
+        }
         iop->data1 = NULL;
-        rtems_libio_iop_free_tail = &iop->data1;
+        rtems_libio_iop_flags_set(iop, LIBIO_FLAGS_FREE);
+        _Atomic_Store_uint(&rtems_libio_iop_free_head, 1, ATOMIC_ORDER_RELEASE);
     }
 }
 
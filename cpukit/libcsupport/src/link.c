@@ -44,12 +44,16 @@ int link( const char *path1, const char *path2 )
     currentloc_2
   );
   if ( rv == 0 ) {
+    const char *name = rtems_filesystem_eval_path_get_token( &ctx_2 );
+    size_t namelen = rtems_filesystem_eval_path_get_tokenlen( &ctx_2 );
+
     rv = (*currentloc_2->mt_entry->ops->link_h)(
       currentloc_2,
       currentloc_1,
-      rtems_filesystem_eval_path_get_token( &ctx_2 ),
-      rtems_filesystem_eval_path_get_tokenlen( &ctx_2 )
+      name,
+      namelen
     );
+    rtems_filesystem_name_cache_remove( currentloc_2, name, namelen );
   }
 
   rtems_filesystem_eval_path_cleanup( &ctx_1 );
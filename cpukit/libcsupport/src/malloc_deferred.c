@@ -87,6 +87,14 @@ void *rtems_heap_allocate_aligned_with_boundary(
 
   switch ( _Malloc_System_state() ) {
     case MALLOC_SYSTEM_STATE_NORMAL:
+      if ( rtems_malloc_cache != NULL && alignment == 0 && boundary == 0 ) {
+        p = ( *rtems_malloc_cache->allocate )( size );
+
+        if ( p != NULL ) {
+          break;
+        }
+      }
+
       _RTEMS_Lock_allocator();
       _Malloc_Process_deferred_frees();
       p = _Heap_Allocate_aligned_with_boundary(
@@ -95,6 +103,20 @@ void *rtems_heap_allocate_aligned_with_boundary(
         alignment,
         boundary
       );
+
+      /*
+       *  The cache may hold enough blocks on this or other processors.
+       */
+      if ( p == NULL && rtems_malloc_cache != NULL ) {
+        ( *rtems_malloc_cache->drain )();
+        p = _Heap_Allocate_aligned_with_boundary(
+          heap,
+          size,
+          alignment,
+          boundary
+        );
+      }
+
       _RTEMS_Unlock_allocator();
       break;
     case MALLOC_SYSTEM_STATE_NO_PROTECTION:
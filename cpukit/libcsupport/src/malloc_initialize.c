@@ -28,6 +28,10 @@ Heap_Control *RTEMS_Malloc_Heap;
 static void _Malloc_Initialize( void )
 {
   RTEMS_Malloc_Initialize( _Memory_Get(), _Heap_Extend );
+
+  if ( rtems_malloc_free_index != NULL && RTEMS_Malloc_Heap != NULL ) {
+    _Heap_Initialize_free_index( RTEMS_Malloc_Heap, rtems_malloc_free_index );
+  }
 }
 
 RTEMS_SYSINIT_ITEM(
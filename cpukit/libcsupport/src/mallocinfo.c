@@ -29,5 +29,38 @@ int malloc_info(
     return -1;
 
   _Protected_heap_Get_information( RTEMS_Malloc_Heap, the_info );
+
+  /*
+   * The blocks held by the malloc() front-end cache are used blocks from the
+   * point of view of the heap, however, they are available for allocation.
+   */
+  if ( rtems_malloc_cache != NULL ) {
+    rtems_malloc_cache_statistics statistics;
+
+    ( *rtems_malloc_cache->get_statistics )( &statistics );
+
+    if (
+      statistics.cached_blocks <= the_info->Used.number
+        && statistics.cached_bytes <= the_info->Used.total
+    ) {
+      the_info->Used.number -= statistics.cached_blocks;
+      the_info->Used.total -= statistics.cached_bytes;
+      the_info->Free.number += statistics.cached_blocks;
+      the_info->Free.total += statistics.cached_bytes;
+    }
+  }
+
   return 0;
 }
+
+bool rtems_malloc_cache_get_statistics(
+  rtems_malloc_cache_statistics *statistics
+)
+{
+  if ( rtems_malloc_cache == NULL ) {
+    return false;
+  }
+
+  ( *rtems_malloc_cache->get_statistics )( statistics );
+  return true;
+}
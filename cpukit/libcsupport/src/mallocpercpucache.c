@@ -0,0 +1,494 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup libcsupport
+ *
+ * @brief Per-Processor Small Object Cache for the C Program Heap
+ */
+
+/*
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef RTEMS_NEWLIB
+#include <string.h>
+
+#include "malloc_p.h"
+
+#include <rtems/score/heapimpl.h>
+#include <rtems/score/isrlock.h>
+#include <rtems/score/percpudata.h>
+#include <rtems/score/smpimpl.h>
+
+/*
+ * The size classes are 16, 32, 64, 128, 256 and 512 bytes.
+ */
+#define MALLOC_CACHE_CLASS_SHIFT_MIN 4
+
+#define MALLOC_CACHE_CLASS_COUNT 6
+
+#define MALLOC_CACHE_CLASS_SIZE( index ) \
+  ( (uintptr_t) 1 << ( ( index ) + MALLOC_CACHE_CLASS_SHIFT_MIN ) )
+
+#define MALLOC_CACHE_SIZE_MAX \
+  MALLOC_CACHE_CLASS_SIZE( MALLOC_CACHE_CLASS_COUNT - 1 )
+
+#define MALLOC_CACHE_MAGAZINE_SIZE 16
+
+#define MALLOC_CACHE_BATCH_SIZE ( MALLOC_CACHE_MAGAZINE_SIZE / 2 )
+
+/*
+ * The first word of a cached block contains its address exclusive-ored with
+ * this value.  A free() of a block with this mark is checked against the
+ * magazines of all processors to detect double frees.
+ */
+#define MALLOC_CACHE_MARK ( (uintptr_t) 0x5a3cc3a5UL )
+
+typedef struct {
+  uint32_t count;
+  void *blocks[ MALLOC_CACHE_MAGAZINE_SIZE ];
+} Malloc_Cache_magazine;
+
+/*
+ * The lock protects the magazines and statistics of a processor.  It is
+ * acquired by other processors only to detect double frees and to drain the
+ * magazines in case the heap is exhausted.
+ */
+typedef struct {
+  ISR_LOCK_MEMBER( Lock )
+  Malloc_Cache_magazine Magazines[ MALLOC_CACHE_CLASS_COUNT ];
+  rtems_malloc_cache_statistics Stats;
+} Malloc_Cache_per_CPU;
+
+#if defined(RTEMS_SMP)
+static PER_CPU_DATA_ITEM( Malloc_Cache_per_CPU, _Malloc_Cache ) = {
+  .Lock = ISR_LOCK_INITIALIZER( "Malloc Cache" )
+};
+#else
+static PER_CPU_DATA_ITEM( Malloc_Cache_per_CPU, _Malloc_Cache );
+#endif
+
+static Malloc_Cache_per_CPU *_Malloc_Cache_Get( Per_CPU_Control *cpu )
+{
+  Malloc_Cache_per_CPU *cache;
+
+  cache = PER_CPU_DATA_GET( cpu, Malloc_Cache_per_CPU, _Malloc_Cache );
+  return cache;
+}
+
+static Malloc_Cache_per_CPU *_Malloc_Cache_Acquire(
+  ISR_lock_Context *lock_context
+)
+{
+  Malloc_Cache_per_CPU *cache;
+
+  _ISR_lock_ISR_disable( lock_context );
+  cache = _Malloc_Cache_Get( _Per_CPU_Get() );
+  _ISR_lock_Acquire( &cache->Lock, lock_context );
+
+  return cache;
+}
+
+static void _Malloc_Cache_Release(
+  Malloc_Cache_per_CPU *cache,
+  ISR_lock_Context     *lock_context
+)
+{
+  _ISR_lock_Release_and_ISR_enable( &cache->Lock, lock_context );
+}
+
+static uintptr_t _Malloc_Cache_Mark( const void *ptr )
+{
+  return (uintptr_t) ptr ^ MALLOC_CACHE_MARK;
+}
+
+static size_t _Malloc_Cache_Class_of_request( size_t size )
+{
+  size_t index;
+
+  index = 0;
+
+  while ( MALLOC_CACHE_CLASS_SIZE( index ) < size ) {
+    ++index;
+  }
+
+  return index;
+}
+
+/*
+ * A block is cached in the largest class which it is able to satisfy.  Blocks
+ * which are more than twice as large as the class size are not cached to
+ * avoid that large blocks are wasted for small requests.
+ */
+static bool _Malloc_Cache_Class_of_block(
+  uintptr_t  alloc_size,
+  size_t    *index
+)
+{
+  size_t i;
+
+  if ( alloc_size < MALLOC_CACHE_CLASS_SIZE( 0 ) ) {
+    return false;
+  }
+
+  i = MALLOC_CACHE_CLASS_COUNT - 1;
+
+  while ( MALLOC_CACHE_CLASS_SIZE( i ) > alloc_size ) {
+    --i;
+  }
+
+  if ( alloc_size >= 2 * MALLOC_CACHE_CLASS_SIZE( i ) ) {
+    return false;
+  }
+
+  *index = i;
+  return true;
+}
+
+static void _Malloc_Cache_Free_batch( void **blocks, size_t count )
+{
+  Heap_Control *heap;
+  size_t        i;
+
+  heap = RTEMS_Malloc_Heap;
+
+  _RTEMS_Lock_allocator();
+
+  for ( i = 0; i < count; ++i ) {
+    if ( !_Heap_Free( heap, blocks[ i ] ) ) {
+      rtems_fatal(
+        RTEMS_FATAL_SOURCE_INVALID_HEAP_FREE,
+        (rtems_fatal_code) blocks[ i ]
+      );
+    }
+  }
+
+  _RTEMS_Unlock_allocator();
+}
+
+static void *_Malloc_Cache_Refill( size_t index )
+{
+  Heap_Control         *heap;
+  void                 *blocks[ MALLOC_CACHE_BATCH_SIZE ];
+  uintptr_t             sizes[ MALLOC_CACHE_BATCH_SIZE ];
+  size_t                count;
+  size_t                i;
+  ISR_lock_Context      lock_context;
+  Malloc_Cache_per_CPU *cache;
+  Malloc_Cache_magazine *magazine;
+
+  heap = RTEMS_Malloc_Heap;
+  count = 0;
+
+  _RTEMS_Lock_allocator();
+  _Malloc_Process_deferred_frees();
+
+  while ( count < MALLOC_CACHE_BATCH_SIZE ) {
+    void *p;
+
+    p = _Heap_Allocate( heap, MALLOC_CACHE_CLASS_SIZE( index ) );
+
+    if ( p == NULL ) {
+      break;
+    }
+
+    _Heap_Size_of_alloc_area( heap, p, &sizes[ count ] );
+    blocks[ count ] = p;
+    ++count;
+  }
+
+  _RTEMS_Unlock_allocator();
+
+  if ( count == 0 ) {
+    return NULL;
+  }
+
+  /*
+   * The executing thread may have migrated to another processor in the
+   * meantime.  Put the surplus blocks into the magazine of the current
+   * processor.
+   */
+  cache = _Malloc_Cache_Acquire( &lock_context );
+  magazine = &cache->Magazines[ index ];
+  ++cache->Stats.refills;
+
+  i = 1;
+
+  while ( i < count && magazine->count < MALLOC_CACHE_MAGAZINE_SIZE ) {
+    *(uintptr_t *) blocks[ i ] = _Malloc_Cache_Mark( blocks[ i ] );
+    magazine->blocks[ magazine->count ] = blocks[ i ];
+    ++magazine->count;
+    ++cache->Stats.cached_blocks;
+    cache->Stats.cached_bytes += sizes[ i ];
+    ++i;
+  }
+
+  _Malloc_Cache_Release( cache, &lock_context );
+
+  if ( i < count ) {
+    _Malloc_Cache_Free_batch( &blocks[ i ], count - i );
+  }
+
+  return blocks[ 0 ];
+}
+
+static void *_Malloc_Cache_Allocate( size_t size )
+{
+  size_t                 index;
+  ISR_lock_Context       lock_context;
+  Malloc_Cache_per_CPU  *cache;
+  Malloc_Cache_magazine *magazine;
+
+  if ( size > MALLOC_CACHE_SIZE_MAX ) {
+    return NULL;
+  }
+
+  index = _Malloc_Cache_Class_of_request( size );
+  cache = _Malloc_Cache_Acquire( &lock_context );
+  magazine = &cache->Magazines[ index ];
+
+  if ( RTEMS_PREDICT_TRUE( magazine->count > 0 ) ) {
+    void      *p;
+    uintptr_t  alloc_size;
+
+    --magazine->count;
+    p = magazine->blocks[ magazine->count ];
+    ++cache->Stats.hits;
+    --cache->Stats.cached_blocks;
+    _Heap_Size_of_alloc_area( RTEMS_Malloc_Heap, p, &alloc_size );
+    cache->Stats.cached_bytes -= alloc_size;
+    _Malloc_Cache_Release( cache, &lock_context );
+    *(uintptr_t *) p = 0;
+    return p;
+  }
+
+  ++cache->Stats.misses;
+  _Malloc_Cache_Release( cache, &lock_context );
+
+  return _Malloc_Cache_Refill( index );
+}
+
+static bool _Malloc_Cache_Is_cached( const void *ptr )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Malloc_Cache_per_CPU *cache;
+    ISR_lock_Context      lock_context;
+    size_t                index;
+    bool                  found;
+
+    cache = _Malloc_Cache_Get( _Per_CPU_Get_by_index( cpu_index ) );
+    found = false;
+    _ISR_lock_ISR_disable_and_acquire( &cache->Lock, &lock_context );
+
+    for ( index = 0; index < MALLOC_CACHE_CLASS_COUNT; ++index ) {
+      const Malloc_Cache_magazine *magazine;
+      uint32_t                     i;
+
+      magazine = &cache->Magazines[ index ];
+
+      for ( i = 0; i < magazine->count; ++i ) {
+        if ( magazine->blocks[ i ] == ptr ) {
+          found = true;
+        }
+      }
+    }
+
+    _ISR_lock_Release_and_ISR_enable( &cache->Lock, &lock_context );
+
+    if ( found ) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+static bool _Malloc_Cache_Free( void *ptr )
+{
+  uintptr_t              alloc_size;
+  size_t                 index;
+  ISR_lock_Context       lock_context;
+  Malloc_Cache_per_CPU  *cache;
+  Malloc_Cache_magazine *magazine;
+  void                  *blocks[ MALLOC_CACHE_BATCH_SIZE ];
+  size_t                 i;
+
+  /*
+   * The size of an allocated block is determined by its block header and the
+   * used flag in the header of the next block.  Both are owned by the block
+   * owner, so we can read them without holding the allocator mutex.  Invalid
+   * pointers are rejected here and reported by the normal free() path.
+   */
+  if ( !_Heap_Size_of_alloc_area( RTEMS_Malloc_Heap, ptr, &alloc_size ) ) {
+    return false;
+  }
+
+  if ( !_Malloc_Cache_Class_of_block( alloc_size, &index ) ) {
+    return false;
+  }
+
+  /*
+   * Cached blocks are still allocated from the point of view of the heap.  A
+   * second free() of a cached block must be detected here, otherwise the
+   * block would be handed out twice.
+   */
+  if (
+    RTEMS_PREDICT_FALSE( *(uintptr_t *) ptr == _Malloc_Cache_Mark( ptr ) )
+      && _Malloc_Cache_Is_cached( ptr )
+  ) {
+    rtems_fatal( RTEMS_FATAL_SOURCE_INVALID_HEAP_FREE, (rtems_fatal_code) ptr );
+  }
+
+  *(uintptr_t *) ptr = _Malloc_Cache_Mark( ptr );
+  cache = _Malloc_Cache_Acquire( &lock_context );
+  magazine = &cache->Magazines[ index ];
+  ++cache->Stats.frees;
+
+  if ( RTEMS_PREDICT_TRUE( magazine->count < MALLOC_CACHE_MAGAZINE_SIZE ) ) {
+    magazine->blocks[ magazine->count ] = ptr;
+    ++magazine->count;
+    ++cache->Stats.cached_blocks;
+    cache->Stats.cached_bytes += alloc_size;
+    _Malloc_Cache_Release( cache, &lock_context );
+    return true;
+  }
+
+  /*
+   * The magazine is full.  Move the oldest half of the magazine into a batch
+   * which is returned to the heap after thread dispatching is enabled again.
+   */
+  ++cache->Stats.drains;
+
+  for ( i = 0; i < MALLOC_CACHE_BATCH_SIZE; ++i ) {
+    uintptr_t block_size;
+
+    blocks[ i ] = magazine->blocks[ i ];
+    _Heap_Size_of_alloc_area( RTEMS_Malloc_Heap, blocks[ i ], &block_size );
+    cache->Stats.cached_bytes -= block_size;
+  }
+
+  memmove(
+    &magazine->blocks[ 0 ],
+    &magazine->blocks[ MALLOC_CACHE_BATCH_SIZE ],
+    ( MALLOC_CACHE_MAGAZINE_SIZE - MALLOC_CACHE_BATCH_SIZE )
+      * sizeof( magazine->blocks[ 0 ] )
+  );
+  magazine->count = MALLOC_CACHE_MAGAZINE_SIZE - MALLOC_CACHE_BATCH_SIZE;
+  magazine->blocks[ magazine->count ] = ptr;
+  ++magazine->count;
+  cache->Stats.cached_blocks -= MALLOC_CACHE_BATCH_SIZE - 1;
+  cache->Stats.cached_bytes += alloc_size;
+  _Malloc_Cache_Release( cache, &lock_context );
+
+  _Malloc_Cache_Free_batch( blocks, MALLOC_CACHE_BATCH_SIZE );
+  return true;
+}
+
+static void _Malloc_Cache_Drain( void )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Malloc_Cache_per_CPU *cache;
+    size_t                index;
+
+    cache = _Malloc_Cache_Get( _Per_CPU_Get_by_index( cpu_index ) );
+
+    for ( index = 0; index < MALLOC_CACHE_CLASS_COUNT; ++index ) {
+      Malloc_Cache_magazine *magazine;
+      ISR_lock_Context       lock_context;
+      void                  *blocks[ MALLOC_CACHE_MAGAZINE_SIZE ];
+      uint32_t               count;
+      uint32_t               i;
+
+      magazine = &cache->Magazines[ index ];
+      _ISR_lock_ISR_disable_and_acquire( &cache->Lock, &lock_context );
+      count = magazine->count;
+
+      for ( i = 0; i < count; ++i ) {
+        uintptr_t block_size;
+
+        blocks[ i ] = magazine->blocks[ i ];
+        _Heap_Size_of_alloc_area( RTEMS_Malloc_Heap, blocks[ i ], &block_size );
+        cache->Stats.cached_bytes -= block_size;
+      }
+
+      magazine->count = 0;
+      cache->Stats.cached_blocks -= count;
+
+      if ( count > 0 ) {
+        ++cache->Stats.drains;
+      }
+
+      _ISR_lock_Release_and_ISR_enable( &cache->Lock, &lock_context );
+      _Malloc_Cache_Free_batch( blocks, count );
+    }
+  }
+}
+
+static void _Malloc_Cache_Get_statistics(
+  rtems_malloc_cache_statistics *statistics
+)
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  memset( statistics, 0, sizeof( *statistics ) );
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    const Malloc_Cache_per_CPU *cache;
+
+    cache = _Malloc_Cache_Get( _Per_CPU_Get_by_index( cpu_index ) );
+    statistics->hits += cache->Stats.hits;
+    statistics->misses += cache->Stats.misses;
+    statistics->frees += cache->Stats.frees;
+    statistics->refills += cache->Stats.refills;
+    statistics->drains += cache->Stats.drains;
+    statistics->cached_blocks += cache->Stats.cached_blocks;
+    statistics->cached_bytes += cache->Stats.cached_bytes;
+  }
+}
+
+const rtems_malloc_cache_handlers rtems_malloc_per_cpu_cache = {
+  .allocate = _Malloc_Cache_Allocate,
+  .free = _Malloc_Cache_Free,
+  .drain = _Malloc_Cache_Drain,
+  .get_statistics = _Malloc_Cache_Get_statistics
+};
+#endif
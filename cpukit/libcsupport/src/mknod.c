@@ -51,6 +51,7 @@ int rtems_filesystem_mknod(
     const rtems_filesystem_operations_table *ops = parentloc->mt_entry->ops;
 
     rv = (*ops->mknod_h)( parentloc, name, namelen, mode, dev );
+    rtems_filesystem_name_cache_remove( parentloc, name, namelen );
   }
 
   return rv;
@@ -119,6 +119,7 @@ static int register_subordinate_file_system(
     mt_entry->mt_point_node = mt_point_node;
     rv = (*mt_point_node->location.mt_entry->ops->mount_h)( mt_entry );
     if ( rv == 0 ) {
+      rtems_filesystem_name_cache_purge_node( &mt_point_node->location );
       rtems_filesystem_mt_lock();
       rtems_chain_append_unprotected(
         &rtems_filesystem_mount_table,
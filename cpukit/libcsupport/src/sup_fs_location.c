@@ -235,6 +235,7 @@ void rtems_filesystem_do_unmount(
   rtems_chain_extract_unprotected(&mt_entry->mt_node);
   rtems_filesystem_mt_unlock();
   rtems_filesystem_global_location_release(mt_entry->mt_point_node, false);
+  rtems_filesystem_name_cache_purge_instance(mt_entry);
   (*mt_entry->ops->fsunmount_me_h)(mt_entry);
 
   if (mt_entry->unmount_task != 0) {
@@ -0,0 +1,333 @@
+/**
+ * @file
+ *
+ * @brief RTEMS File System Name Cache
+ * @ingroup LibIOInternal
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/libio_.h>
+#include <rtems/thread.h>
+
+#include <string.h>
+
+/*
+ * The name cache is set associative.  The entries of a set are kept in least
+ * recently used order, the most recently used entry first.  Unused entries
+ * are at the end of a set.
+ */
+
+static rtems_mutex name_cache_mutex =
+  RTEMS_MUTEX_INITIALIZER( "FS Name Cache" );
+
+static bool name_cache_is_enabled( void )
+{
+  return rtems_filesystem_name_cache.set_count > 0;
+}
+
+static bool name_cache_is_cacheable( const char *name, size_t namelen )
+{
+  return namelen > 0
+    && namelen <= RTEMS_FILESYSTEM_NAME_CACHE_NAME_MAX
+    && !rtems_filesystem_is_current_directory( name, namelen )
+    && !rtems_filesystem_is_parent_directory( name, namelen );
+}
+
+static uint32_t name_cache_hash(
+  const rtems_filesystem_location_info_t *parentloc,
+  const char *name,
+  size_t namelen
+)
+{
+  uint32_t hash = 2166136261U;
+  size_t i;
+
+  for ( i = 0; i < namelen; ++i ) {
+    hash = ( hash ^ (uint8_t) name[ i ] ) * 16777619U;
+  }
+
+  hash = ( hash ^ (uint32_t) (uintptr_t) parentloc->node_access ) * 16777619U;
+  hash = ( hash ^ (uint32_t) ( (uintptr_t) parentloc->mt_entry >> 3 ) )
+    * 16777619U;
+
+  return hash;
+}
+
+static rtems_filesystem_name_cache_entry *name_cache_get_set( uint32_t hash )
+{
+  const rtems_filesystem_name_cache_configuration *config =
+    &rtems_filesystem_name_cache;
+
+  return &config->entries[
+    ( hash % config->set_count ) * RTEMS_FILESYSTEM_NAME_CACHE_WAYS
+  ];
+}
+
+static size_t name_cache_find(
+  const rtems_filesystem_name_cache_entry *set,
+  const rtems_filesystem_location_info_t *parentloc,
+  uint32_t hash,
+  const char *name,
+  size_t namelen
+)
+{
+  size_t i;
+
+  for ( i = 0; i < RTEMS_FILESYSTEM_NAME_CACHE_WAYS; ++i ) {
+    const rtems_filesystem_name_cache_entry *entry = &set[ i ];
+
+    if (
+      entry->hash == hash
+        && entry->mt_entry == parentloc->mt_entry
+        && entry->parent == parentloc->node_access
+        && entry->namelen == namelen
+        && memcmp( entry->name, name, namelen ) == 0
+    ) {
+      break;
+    }
+  }
+
+  return i;
+}
+
+static void name_cache_move_to_front(
+  rtems_filesystem_name_cache_entry *set,
+  size_t i
+)
+{
+  if ( i > 0 ) {
+    rtems_filesystem_name_cache_entry entry = set[ i ];
+
+    memmove( &set[ 1 ], &set[ 0 ], i * sizeof( set[ 0 ] ) );
+    set[ 0 ] = entry;
+  }
+}
+
+static void name_cache_remove_at(
+  rtems_filesystem_name_cache_entry *set,
+  size_t i
+)
+{
+  size_t last = RTEMS_FILESYSTEM_NAME_CACHE_WAYS - 1;
+
+  memmove( &set[ i ], &set[ i + 1 ], ( last - i ) * sizeof( set[ 0 ] ) );
+  set[ last ].mt_entry = NULL;
+}
+
+rtems_filesystem_name_cache_status rtems_filesystem_name_cache_lookup(
+  const rtems_filesystem_location_info_t *parentloc,
+  const char *name,
+  size_t namelen,
+  void **node
+)
+{
+  rtems_filesystem_name_cache_status status;
+  rtems_filesystem_name_cache_entry *set;
+  uint32_t hash;
+  size_t i;
+
+  if ( !name_cache_is_enabled() || !name_cache_is_cacheable( name, namelen ) ) {
+    return RTEMS_FILESYSTEM_NAME_CACHE_MISS;
+  }
+
+  hash = name_cache_hash( parentloc, name, namelen );
+  set = name_cache_get_set( hash );
+
+  rtems_mutex_lock( &name_cache_mutex );
+
+  i = name_cache_find( set, parentloc, hash, name, namelen );
+
+  if ( i < RTEMS_FILESYSTEM_NAME_CACHE_WAYS ) {
+    name_cache_move_to_front( set, i );
+
+    if ( set[ 0 ].no_entry ) {
+      status = RTEMS_FILESYSTEM_NAME_CACHE_NO_ENTRY;
+    } else {
+      status = RTEMS_FILESYSTEM_NAME_CACHE_HIT;
+      *node = set[ 0 ].node;
+    }
+  } else {
+    status = RTEMS_FILESYSTEM_NAME_CACHE_MISS;
+  }
+
+  rtems_mutex_unlock( &name_cache_mutex );
+
+  return status;
+}
+
+static void name_cache_enter(
+  const rtems_filesystem_location_info_t *parentloc,
+  const char *name,
+  size_t namelen,
+  void *node,
+  bool no_entry
+)
+{
+  rtems_filesystem_name_cache_entry *set;
+  rtems_filesystem_name_cache_entry *entry;
+  uint32_t hash;
+  size_t i;
+
+  if ( !name_cache_is_enabled() || !name_cache_is_cacheable( name, namelen ) ) {
+    return;
+  }
+
+  hash = name_cache_hash( parentloc, name, namelen );
+  set = name_cache_get_set( hash );
+
+  rtems_mutex_lock( &name_cache_mutex );
+
+  i = name_cache_find( set, parentloc, hash, name, namelen );
+
+  if ( i == RTEMS_FILESYSTEM_NAME_CACHE_WAYS ) {
+    /* Replace the least recently used entry */
+    i = RTEMS_FILESYSTEM_NAME_CACHE_WAYS - 1;
+  }
+
+  name_cache_move_to_front( set, i );
+
+  entry = &set[ 0 ];
+  entry->mt_entry = parentloc->mt_entry;
+  entry->parent = parentloc->node_access;
+  entry->node = node;
+  entry->hash = hash;
+  entry->namelen = (uint8_t) namelen;
+  entry->no_entry = no_entry;
+  memcpy( entry->name, name, namelen );
+
+  rtems_mutex_unlock( &name_cache_mutex );
+}
+
+void rtems_filesystem_name_cache_enter(
+  const rtems_filesystem_location_info_t *parentloc,
+  const char *name,
+  size_t namelen,
+  void *node
+)
+{
+  name_cache_enter( parentloc, name, namelen, node, false );
+}
+
+void rtems_filesystem_name_cache_enter_no_entry(
+  const rtems_filesystem_location_info_t *parentloc,
+  const char *name,
+  size_t namelen
+)
+{
+  name_cache_enter( parentloc, name, namelen, NULL, true );
+}
+
+void rtems_filesystem_name_cache_remove(
+  const rtems_filesystem_location_info_t *parentloc,
+  const char *name,
+  size_t namelen
+)
+{
+  rtems_filesystem_name_cache_entry *set;
+  uint32_t hash;
+  size_t i;
+
+  if ( !name_cache_is_enabled() || !name_cache_is_cacheable( name, namelen ) ) {
+    return;
+  }
+
+  hash = name_cache_hash( parentloc, name, namelen );
+  set = name_cache_get_set( hash );
+
+  rtems_mutex_lock( &name_cache_mutex );
+
+  i = name_cache_find( set, parentloc, hash, name, namelen );
+
+  if ( i < RTEMS_FILESYSTEM_NAME_CACHE_WAYS ) {
+    name_cache_remove_at( set, i );
+  }
+
+  rtems_mutex_unlock( &name_cache_mutex );
+}
+
+static void name_cache_purge(
+  const rtems_filesystem_mount_table_entry_t *mt_entry,
+  const void *node,
+  bool whole_instance
+)
+{
+  const rtems_filesystem_name_cache_configuration *config =
+    &rtems_filesystem_name_cache;
+  size_t s;
+
+  if ( !name_cache_is_enabled() ) {
+    return;
+  }
+
+  rtems_mutex_lock( &name_cache_mutex );
+
+  for ( s = 0; s < config->set_count; ++s ) {
+    rtems_filesystem_name_cache_entry *set =
+      &config->entries[ s * RTEMS_FILESYSTEM_NAME_CACHE_WAYS ];
+    size_t i = RTEMS_FILESYSTEM_NAME_CACHE_WAYS;
+
+    while ( i > 0 ) {
+      const rtems_filesystem_name_cache_entry *entry;
+
+      --i;
+      entry = &set[ i ];
+
+      if (
+        entry->mt_entry == mt_entry
+          && (
+            whole_instance
+              || entry->parent == node
+              || ( !entry->no_entry && entry->node == node )
+          )
+      ) {
+        name_cache_remove_at( set, i );
+      }
+    }
+  }
+
+  rtems_mutex_unlock( &name_cache_mutex );
+}
+
+void rtems_filesystem_name_cache_purge_node(
+  const rtems_filesystem_location_info_t *loc
+)
+{
+  name_cache_purge( loc->mt_entry, loc->node_access, false );
+}
+
+void rtems_filesystem_name_cache_purge_instance(
+  const rtems_filesystem_mount_table_entry_t *mt_entry
+)
+{
+  name_cache_purge( mt_entry, NULL, true );
+}
@@ -31,13 +31,16 @@ int symlink( const char *path1, const char *path2 )
     | RTEMS_FS_EXCLUSIVE;
   const rtems_filesystem_location_info_t *currentloc =
     rtems_filesystem_eval_path_start( &ctx, path2, eval_flags );
+  const char *name = rtems_filesystem_eval_path_get_token( &ctx );
+  size_t namelen = rtems_filesystem_eval_path_get_tokenlen( &ctx );
 
   rv = (*currentloc->mt_entry->ops->symlink_h)(
     currentloc,
-    rtems_filesystem_eval_path_get_token( &ctx ),
-    rtems_filesystem_eval_path_get_tokenlen( &ctx ),
+    name,
+    namelen,
     path1
   );
+  rtems_filesystem_name_cache_remove( currentloc, name, namelen );
 
   rtems_filesystem_eval_path_cleanup( &ctx );
 
@@ -47,6 +47,7 @@ int unlink( const char *path )
     const rtems_filesystem_operations_table *ops = currentloc->mt_entry->ops;
 
     rv = (*ops->rmnod_h)( &parentloc, currentloc );
+    rtems_filesystem_name_cache_purge_node( currentloc );
   } else {
     rtems_filesystem_eval_path_error( &ctx, EBUSY );
     rv = -1;
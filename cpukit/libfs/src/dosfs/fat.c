@@ -200,6 +200,50 @@ _fat_block_read(
     return cmpltd;
 }
 
+/* fat_cluster_read_direct --
+ *     This function reads 'count' bytes from device filesystem is mounted on,
+ *     starts at cluster 'start_cln'.  The clusters must be consecutive on the
+ *     device and 'count' must be a multiple of the cluster size.  Blocks not
+ *     in the block device buffer cache are transferred directly into the
+ *     buffer provided by user.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     start_cln - cluster num to start read from
+ *     count    - count of bytes to read
+ *     buff     - buffer provided by user
+ *
+ * RETURNS:
+ *     bytes read on success, or -1 if error occured
+ *     and errno set appropriately
+ */
+ssize_t
+fat_cluster_read_direct(
+    fat_fs_info_t                        *fs_info,
+    uint32_t                              start_cln,
+    uint32_t                              count,
+    void                                 *buff
+    )
+{
+    rtems_status_code       sc = RTEMS_SUCCESSFUL;
+    int                     rc = RC_OK;
+    uint32_t                blk = fat_cluster_num_to_block_num(fs_info,
+                                                               start_cln);
+    uint32_t                blk_count = count >>
+                                        fs_info->vol.bytes_per_block_log2;
+
+    /* the cached block may hold modifications not yet released to bdbuf */
+    rc = fat_buf_release(fs_info);
+    if (rc != RC_OK)
+        return -1;
+
+    sc = rtems_bdbuf_read_direct(fs_info->vol.dd, blk, blk_count, buff);
+    if (sc != RTEMS_SUCCESSFUL)
+        rtems_set_errno_and_return_minus_one(EIO);
+
+    return count;
+}
+
 static ssize_t
 fat_block_write(
     fat_fs_info_t                        *fs_info,
@@ -880,6 +924,7 @@ fat_shutdown_drive(fat_fs_info_t *fs_info)
 
     free(fs_info->uino);
     free(fs_info->sec_buf);
+    free(fs_info->free_bitmap);
     close(fs_info->vol.fd);
 
     if (rc)
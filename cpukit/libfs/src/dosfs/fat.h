@@ -68,6 +68,12 @@ extern "C" {
 #define FAT_SECTOR512_SIZE     512 /* sector size (bytes) */
 #define FAT_SECTOR512_BITS       9 /* log2(SECTOR_SIZE) */
 
+/*
+ * minimum size (bytes) of a run of consecutive clusters which is read
+ * directly into the user buffer bypassing the block device buffer cache
+ */
+#define FAT_DIRECT_READ_THRESHOLD (16 * 1024)
+
 /* maximum + 1 number of clusters for FAT12 */
 #define FAT_FAT12_MAX_CLN      4085
 
@@ -359,6 +365,10 @@ typedef struct fat_fs_info_s
     uint32_t             uino_base;
     fat_cache_t          c;             /* cache */
     uint8_t             *sec_buf; /* just placeholder for anything */
+    uint32_t            *free_bitmap;   /* bitmap of used clusters */
+    bool                 free_bitmap_enabled;
+    uint32_t             free_bitmap_cln; /* next cluster to scan into the
+                                             bitmap */
 } fat_fs_info_t;
 
 /*
@@ -483,6 +493,13 @@ fat_buf_mark_modified(fat_fs_info_t *fs_info)
     fs_info->c.modified = true;
 }
 
+static inline bool
+fat_free_bitmap_is_complete(const fat_fs_info_t *fs_info)
+{
+    return fs_info->free_bitmap != NULL &&
+           fs_info->free_bitmap_cln == fs_info->vol.data_cls + 2;
+}
+
 int
 fat_buf_access(fat_fs_info_t  *fs_info,
                uint32_t        sec_num,
@@ -499,6 +516,12 @@ _fat_block_read(fat_fs_info_t                        *fs_info,
                 uint32_t                              count,
                 void                                 *buff);
 
+ssize_t
+fat_cluster_read_direct(fat_fs_info_t                *fs_info,
+                        uint32_t                      start_cln,
+                        uint32_t                      count,
+                        void                         *buff);
+
 ssize_t
 fat_cluster_write(fat_fs_info_t                    *fs_info,
                     uint32_t                          start_cln,
@@ -27,6 +27,280 @@
 #include "fat.h"
 #include "fat_fat_operations.h"
 
+/*
+ * Size of the chunks of the FAT read to build the free cluster bitmap
+ */
+#define FAT_FREE_BITMAP_READ_SIZE (16 * 1024)
+
+static inline void
+fat_free_bitmap_set(
+    fat_fs_info_t                        *fs_info,
+    uint32_t                              cln,
+    bool                                  used
+    )
+{
+    uint32_t *word = &fs_info->free_bitmap[cln / 32];
+    uint32_t  bit = UINT32_C(1) << (cln % 32);
+
+    if (used)
+        *word |= bit;
+    else
+        *word &= ~bit;
+}
+
+/* fat_free_bitmap_find --
+ *     Find the first free cluster starting with cluster 'cln' in the free
+ *     cluster bitmap.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     cln      - number of the cluster to start the search with
+ *
+ * RETURNS:
+ *     the number of the free cluster, or 0 if no cluster from 'cln' to the
+ *     last cluster of the volume is free
+ */
+static uint32_t
+fat_free_bitmap_find(
+    const fat_fs_info_t                  *fs_info,
+    uint32_t                              cln
+    )
+{
+    uint32_t i = cln / 32;
+    uint32_t words = (fs_info->vol.data_cls + 2 + 31) / 32;
+    uint32_t word = fs_info->free_bitmap[i] |
+                    ((UINT32_C(1) << (cln % 32)) - 1);
+
+    /* the bits of cluster 0 and 1 and beyond the last cluster are set */
+    while (word == UINT32_MAX)
+    {
+        if (++i == words)
+            return 0;
+
+        word = fs_info->free_bitmap[i];
+    }
+
+    return i * 32 + __builtin_ctz(~word);
+}
+
+static inline bool
+fat_entry_is_free(
+    const fat_fs_info_t                  *fs_info,
+    uint32_t                              cln,
+    const uint8_t                        *entry
+    )
+{
+    uint32_t value;
+
+    switch ( fs_info->vol.type )
+    {
+        case FAT_FAT12:
+            value = entry[0] | (entry[1] << 8);
+            if ( FAT_CLUSTER_IS_ODD(cln) )
+                value = value >> FAT12_SHIFT;
+            else
+                value = value & FAT_FAT12_MASK;
+            break;
+
+        case FAT_FAT16:
+            value = CF_LE_W(*((const uint16_t *)entry));
+            break;
+
+        default:
+            value = CF_LE_L(*((const uint32_t *)entry)) & FAT_FAT32_MASK;
+            break;
+    }
+
+    return value == FAT_GENFAT_FREE;
+}
+
+/* fat_free_bitmap_init --
+ *     Allocate the free cluster bitmap if it is enabled.  The bitmap is
+ *     built afterwards by fat_free_bitmap_scan().  In case there is not
+ *     enough memory for the bitmap, then the bitmap is disabled and the FAT
+ *     is scanned on demand as before.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ */
+void
+fat_free_bitmap_init(
+    fat_fs_info_t                        *fs_info
+    )
+{
+    uint32_t words = (fs_info->vol.data_cls + 2 + 31) / 32;
+
+    if (!fs_info->free_bitmap_enabled || fs_info->free_bitmap != NULL)
+        return;
+
+    fs_info->free_bitmap = calloc(words, sizeof(uint32_t));
+    if (fs_info->free_bitmap == NULL)
+    {
+        fs_info->free_bitmap_enabled = false;
+        return;
+    }
+
+    fs_info->free_bitmap_cln = 2;
+}
+
+static void
+fat_free_bitmap_disable(
+    fat_fs_info_t                        *fs_info
+    )
+{
+    free(fs_info->free_bitmap);
+    fs_info->free_bitmap = NULL;
+    fs_info->free_bitmap_enabled = false;
+}
+
+/* fat_free_bitmap_scan --
+ *     Scan the next chunks of the active FAT into the free cluster bitmap.
+ *     The chunks are read with requests which bypass the block device
+ *     buffer cache, so the cache is not flushed by the scan.  A chunk ends at
+ *     the end of the FAT or of the device.  Clusters which change after they
+ *     were scanned are updated by fat_set_fat_cluster().  Once the last
+ *     cluster is scanned, the count of free clusters is set from the bitmap.
+ *     In case of an error the bitmap is disabled.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *     chunks   - maximum count of chunks to scan
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if error occured
+ *     and errno set appropriately
+ */
+int
+fat_free_bitmap_scan(
+    fat_fs_info_t                        *fs_info,
+    uint32_t                              chunks
+    )
+{
+    int                 rc = RC_OK;
+    rtems_status_code   sc = RTEMS_SUCCESSFUL;
+    uint8_t            *buf;
+    uint32_t            entry_size;
+    uint32_t            chunk_blocks;
+    uint32_t            fat_begin;
+    uint32_t            fat_end;
+    uint32_t            last_blk;
+    uint32_t            words;
+    uint32_t            free_cls = 0;
+    uint32_t            data_cls_val = fs_info->vol.data_cls + 2;
+    uint32_t            cln = fs_info->free_bitmap_cln;
+
+    if (fs_info->free_bitmap == NULL || cln == data_cls_val)
+        return RC_OK;
+
+    chunk_blocks = FAT_FREE_BITMAP_READ_SIZE >>
+                   fs_info->vol.bytes_per_block_log2;
+    if (chunk_blocks == 0)
+        chunk_blocks = 1;
+
+    buf = malloc(chunk_blocks << fs_info->vol.bytes_per_block_log2);
+    if (buf == NULL)
+    {
+        fat_free_bitmap_disable(fs_info);
+        errno = ENOMEM;
+        return -1;
+    }
+
+    entry_size = (fs_info->vol.type & FAT_FAT32) ? 4 : 2;
+    fat_begin = fs_info->vol.afat_loc << fs_info->vol.sec_log2;
+    fat_end = fat_begin + (fs_info->vol.fat_length << fs_info->vol.sec_log2);
+    last_blk = (fat_end - 1) >> fs_info->vol.bytes_per_block_log2;
+    if (last_blk >= fs_info->vol.dd->block_count)
+        last_blk = fs_info->vol.dd->block_count - 1;
+
+    /* the cached sector may hold modifications not yet released to bdbuf */
+    rc = fat_buf_release(fs_info);
+
+    while (rc == RC_OK && cln < data_cls_val && chunks > 0)
+    {
+        uint32_t ofs = fat_begin + FAT_FAT_OFFSET(fs_info->vol.type, cln);
+        uint32_t blk = ofs >> fs_info->vol.bytes_per_block_log2;
+        uint32_t blocks = chunk_blocks;
+        uint32_t chunk_begin = blk << fs_info->vol.bytes_per_block_log2;
+        uint32_t chunk_end;
+
+        if (blk > last_blk)
+        {
+            errno = EIO;
+            rc = -1;
+            break;
+        }
+
+        if (blocks > last_blk - blk + 1)
+            blocks = last_blk - blk + 1;
+
+        chunk_end = chunk_begin + (blocks << fs_info->vol.bytes_per_block_log2);
+
+        sc = rtems_bdbuf_read_direct(fs_info->vol.dd, blk, blocks, buf);
+        if (sc != RTEMS_SUCCESSFUL)
+        {
+            errno = EIO;
+            rc = -1;
+            break;
+        }
+
+        while (cln < data_cls_val)
+        {
+            ofs = fat_begin + FAT_FAT_OFFSET(fs_info->vol.type, cln);
+            if (ofs + entry_size > chunk_end)
+                break;
+
+            if (!fat_entry_is_free(fs_info, cln, buf + ofs - chunk_begin))
+                fat_free_bitmap_set(fs_info, cln, true);
+
+            ++cln;
+        }
+
+        /* a FAT12 entry may straddle the chunk boundary */
+        if (cln < data_cls_val && ofs < chunk_end)
+        {
+            uint32_t value = 0;
+
+            rc = fat_get_fat_cluster(fs_info, cln, &value);
+            fat_buf_release(fs_info);
+
+            if (value != FAT_GENFAT_FREE)
+                fat_free_bitmap_set(fs_info, cln, true);
+
+            ++cln;
+        }
+
+        fs_info->free_bitmap_cln = cln;
+        --chunks;
+    }
+
+    free(buf);
+
+    if (rc != RC_OK)
+    {
+        fat_free_bitmap_disable(fs_info);
+        return rc;
+    }
+
+    if (cln == data_cls_val)
+    {
+        uint32_t i;
+
+        /* clusters 0 and 1 and the bits beyond the last cluster are never free */
+        words = (data_cls_val + 31) / 32;
+        fat_free_bitmap_set(fs_info, 0, true);
+        fat_free_bitmap_set(fs_info, 1, true);
+        for (cln = data_cls_val; cln < words * 32; ++cln)
+            fat_free_bitmap_set(fs_info, cln, true);
+
+        for (i = 0; i < words; ++i)
+            free_cls += 32 - __builtin_popcount(fs_info->free_bitmap[i]);
+
+        fs_info->vol.free_cls = free_cls;
+    }
+
+    return RC_OK;
+}
+
 /* fat_scan_fat_for_free_clusters --
  *     Allocate chain of free clusters from Files Allocation Table
  *
@@ -72,12 +346,32 @@ fat_scan_fat_for_free_clusters(
     {
         uint32_t next_cln = 0;
 
-        rc = fat_get_fat_cluster(fs_info, cl4find, &next_cln);
-        if ( rc != RC_OK )
+        if (fat_free_bitmap_is_complete(fs_info))
         {
-            if (*cls_added != 0)
-                fat_free_fat_clusters_chain(fs_info, (*chain));
-            return rc;
+            uint32_t free_cln = fat_free_bitmap_find(fs_info, cl4find);
+
+            /* skip the used clusters */
+            if (free_cln == 0)
+            {
+                i += data_cls_val - cl4find;
+                cl4find = 2;
+                continue;
+            }
+
+            i += free_cln - cl4find;
+            cl4find = free_cln;
+            if (i >= data_cls_val)
+                break;
+        }
+        else
+        {
+            rc = fat_get_fat_cluster(fs_info, cl4find, &next_cln);
+            if ( rc != RC_OK )
+            {
+                if (*cls_added != 0)
+                    fat_free_fat_clusters_chain(fs_info, (*chain));
+                return rc;
+            }
         }
 
         if (next_cln == FAT_GENFAT_FREE)
@@ -422,5 +716,9 @@ fat_set_fat_cluster(
 
     }
 
+    /* the clusters not yet scanned are read from the FAT later */
+    if (fs_info->free_bitmap != NULL && cln < fs_info->free_bitmap_cln)
+        fat_free_bitmap_set(fs_info, cln, in_val != FAT_GENFAT_FREE);
+
     return RC_OK;
 }
@@ -58,6 +58,13 @@ fat_scan_fat_for_free_clusters(
     bool                                  zero_fill
 );
 
+void
+fat_free_bitmap_init(fat_fs_info_t                       *fs_info);
+
+int
+fat_free_bitmap_scan(fat_fs_info_t                       *fs_info,
+                     uint32_t                             chunks);
+
 int
 fat_free_fat_clusters_chain(
     fat_fs_info_t                        *fs_info,
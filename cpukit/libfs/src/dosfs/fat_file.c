@@ -59,6 +59,20 @@ fat_file_lseek(
     uint32_t                              *disk_cln
 );
 
+static void
+fat_file_extent_insert(
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               file_cln,
+    uint32_t                               disk_cln,
+    uint32_t                               count
+);
+
+static void
+fat_file_extent_truncate(
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               cl_count
+);
+
 /* fat_file_open --
  *     Open fat-file. Two hash tables are accessed by key
  *     constructed from cluster num and offset of the node (i.e.
@@ -342,6 +356,43 @@ fat_file_read(
 
     while (count > 0)
     {
+        if ((ofs == 0) && (count >= fs_info->vol.bpc))
+        {
+            uint32_t run_cln = cur_cln;
+
+            /*
+             * collect whole clusters which are consecutive on the device and
+             * read large runs of regular files directly into the user buffer,
+             * directories are always read through the cache
+             */
+            c = 0;
+            do
+            {
+                c += fs_info->vol.bpc;
+                save_cln = cur_cln;
+                rc = fat_get_fat_cluster(fs_info, cur_cln, &cur_cln);
+                if ( rc != RC_OK )
+                    return rc;
+            } while ((count - c >= fs_info->vol.bpc) &&
+                     (cur_cln == save_cln + 1));
+
+            if ((fat_fd->fat_file_type == FAT_FILE) &&
+                (c >= FAT_DIRECT_READ_THRESHOLD))
+                ret = fat_cluster_read_direct(fs_info, run_cln, c,
+                                              buf + cmpltd);
+            else
+                ret = _fat_block_read(fs_info,
+                                      fat_cluster_num_to_sector_num(fs_info,
+                                                                    run_cln),
+                                      0, c, buf + cmpltd);
+            if ( ret < 0 )
+                return -1;
+
+            count -= c;
+            cmpltd += c;
+            continue;
+        }
+
         c = MIN(count, (fs_info->vol.bpc - ofs));
 
         sec = fat_cluster_num_to_sector_num(fs_info, cur_cln);
@@ -700,6 +751,22 @@ fat_file_extend(
                 return rc;
             }
         }
+
+        /*
+         * A contiguous new chain is a single extent.  Insert it only after
+         * the chain is successfully initialized, since the chain is freed on
+         * error.
+         */
+        if (last_cl - chain + 1 == cls_added)
+        {
+            uint32_t file_cln = 0;
+
+            if (fat_fd->fat_file_size > 0)
+                file_cln = ((fat_fd->fat_file_size - 1) >>
+                            fs_info->vol.bpc_log2) + 1;
+
+            fat_file_extent_insert(fat_fd, file_cln, chain, cls_added);
+        }
     }
 
     *a_length = new_length;
@@ -756,6 +823,8 @@ fat_file_truncate(
     if (rc != RC_OK)
         return rc;
 
+    fat_file_extent_truncate(fat_fd, cl_start);
+
     rc = fat_free_fat_clusters_chain(fs_info, cur_cln);
     if (rc != RC_OK)
         return rc;
@@ -1003,6 +1072,202 @@ _hash_search(
     return -1;
 }
 
+/* fat_file_extent_use --
+ *     Move an extent to the front of the extent cache.
+ *
+ * PARAMETERS:
+ *     fat_fd     - fat-file descriptor
+ *     index      - index of the extent
+ *
+ * RETURNS:
+ *     pointer to the extent
+ */
+static fat_file_extent_t *
+fat_file_extent_use(
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               index
+    )
+{
+    fat_file_extent_t extent = fat_fd->extents[index];
+
+    memmove(&fat_fd->extents[1], &fat_fd->extents[0],
+            index * sizeof(fat_fd->extents[0]));
+    fat_fd->extents[0] = extent;
+
+    return &fat_fd->extents[0];
+}
+
+/* fat_file_extent_lookup --
+ *     Search the extent cache for cluster 'file_cln' of the fat-file. If
+ *     no extent contains the cluster, then move the walk position
+ *     ('cur_file_cln', 'cur_disk_cln') to the last cluster of the closest
+ *     extent before 'file_cln', if this is closer than the walk position.
+ *
+ * PARAMETERS:
+ *     fat_fd       - fat-file descriptor
+ *     file_cln     - cluster number in the fat-file
+ *     cur_file_cln - walk position in the fat-file
+ *     cur_disk_cln - walk position on the volume
+ *
+ * RETURNS:
+ *     true and the cluster number on the volume in 'cur_disk_cln' if an
+ *     extent contains the cluster, false otherwise
+ */
+static bool
+fat_file_extent_lookup(
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               file_cln,
+    uint32_t                              *cur_file_cln,
+    uint32_t                              *cur_disk_cln
+    )
+{
+    uint32_t i;
+
+    for (i = 0; i < FAT_FILE_EXTENT_CACHE_SIZE; i++)
+    {
+        const fat_file_extent_t *extent = &fat_fd->extents[i];
+        uint32_t                 ofs;
+
+        if ((extent->count == 0) || (file_cln < extent->file_cln))
+            continue;
+
+        ofs = file_cln - extent->file_cln;
+
+        if (ofs < extent->count)
+        {
+            extent = fat_file_extent_use(fat_fd, i);
+            *cur_file_cln = file_cln;
+            *cur_disk_cln = extent->disk_cln + ofs;
+            return true;
+        }
+
+        ofs = extent->count - 1;
+
+        if (extent->file_cln + ofs > *cur_file_cln)
+        {
+            *cur_file_cln = extent->file_cln + ofs;
+            *cur_disk_cln = extent->disk_cln + ofs;
+        }
+    }
+
+    return false;
+}
+
+/* fat_file_extent_insert --
+ *     Insert a run of clusters which are consecutive on the volume into the
+ *     extent cache. The run is merged with an extent it overlaps or adjoins.
+ *     The least recently used extent is replaced if the cache is full.
+ *
+ * PARAMETERS:
+ *     fat_fd     - fat-file descriptor
+ *     file_cln   - first cluster number in the fat-file
+ *     disk_cln   - first cluster number on the volume
+ *     count      - number of clusters
+ *
+ * RETURNS:
+ *     None
+ */
+static void
+fat_file_extent_insert(
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               file_cln,
+    uint32_t                               disk_cln,
+    uint32_t                               count
+    )
+{
+    fat_file_extent_t *extent;
+    uint32_t           i;
+
+    for (i = 0; i < FAT_FILE_EXTENT_CACHE_SIZE; i++)
+    {
+        extent = &fat_fd->extents[i];
+
+        if ((extent->count != 0) &&
+            (file_cln - extent->file_cln == disk_cln - extent->disk_cln) &&
+            (file_cln <= extent->file_cln + extent->count) &&
+            (extent->file_cln <= file_cln + count))
+        {
+            uint32_t end = MAX(file_cln + count,
+                               extent->file_cln + extent->count);
+
+            extent = fat_file_extent_use(fat_fd, i);
+            if (file_cln < extent->file_cln)
+            {
+                extent->file_cln = file_cln;
+                extent->disk_cln = disk_cln;
+            }
+            extent->count = end - extent->file_cln;
+            return;
+        }
+    }
+
+    for (i = 0; i < FAT_FILE_EXTENT_CACHE_SIZE - 1; i++)
+    {
+        if (fat_fd->extents[i].count == 0)
+            break;
+    }
+
+    extent = fat_file_extent_use(fat_fd, i);
+    extent->file_cln = file_cln;
+    extent->disk_cln = disk_cln;
+    extent->count = count;
+}
+
+/* fat_file_extent_truncate --
+ *     Remove the clusters starting with cluster 'cl_count' of the fat-file
+ *     from the extent cache.
+ *
+ * PARAMETERS:
+ *     fat_fd     - fat-file descriptor
+ *     cl_count   - new number of clusters of the fat-file
+ *
+ * RETURNS:
+ *     None
+ */
+static void
+fat_file_extent_truncate(
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               cl_count
+    )
+{
+    uint32_t i;
+
+    for (i = 0; i < FAT_FILE_EXTENT_CACHE_SIZE; i++)
+    {
+        fat_file_extent_t *extent = &fat_fd->extents[i];
+
+        if (extent->file_cln >= cl_count)
+            extent->count = 0;
+        else if (extent->count > cl_count - extent->file_cln)
+            extent->count = cl_count - extent->file_cln;
+    }
+}
+
+static bool
+fat_file_is_data_cluster(
+    const fat_fs_info_t                   *fs_info,
+    uint32_t                               cln
+    )
+{
+    return (cln >= FAT_RSRVD_CLN) &&
+           ((cln & fs_info->vol.mask) < fs_info->vol.eoc_val);
+}
+
+/* fat_file_lseek --
+ *     Map cluster 'file_cln' of the fat-file to the cluster number on the
+ *     volume. The extent cache is used first, otherwise the cluster chain is
+ *     walked from the closest known position and the runs of consecutive
+ *     clusters passed by are added to the extent cache.
+ *
+ * PARAMETERS:
+ *     fs_info    - FS info
+ *     fat_fd     - fat-file descriptor
+ *     file_cln   - cluster number in the fat-file
+ *     disk_cln   - placeholder for the cluster number on the volume
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if error occured (errno set appropriately)
+ */
 static off_t
 fat_file_lseek(
     fat_fs_info_t                         *fs_info,
@@ -1018,26 +1283,54 @@ fat_file_lseek(
     else
     {
         uint32_t   cur_cln;
-        uint32_t   count;
-        uint32_t   i;
+        uint32_t   cur_file_cln;
+        uint32_t   run_cln;
+        uint32_t   run_file_cln;
 
         if (file_cln > fat_fd->map.file_cln)
         {
             cur_cln = fat_fd->map.disk_cln;
-            count = file_cln - fat_fd->map.file_cln;
+            cur_file_cln = fat_fd->map.file_cln;
         }
         else
         {
             cur_cln = fat_fd->cln;
-            count = file_cln;
+            cur_file_cln = 0;
         }
 
-        /* skip over the clusters */
-        for (i = 0; i < count; i++)
+        if (!fat_file_extent_lookup(fat_fd, file_cln, &cur_file_cln, &cur_cln))
         {
-            rc = fat_get_fat_cluster(fs_info, cur_cln, &cur_cln);
-            if ( rc != RC_OK )
-                return rc;
+            run_cln = cur_cln;
+            run_file_cln = cur_file_cln;
+
+            /* skip over the clusters */
+            while (cur_file_cln < file_cln)
+            {
+                uint32_t next_cln;
+
+                rc = fat_get_fat_cluster(fs_info, cur_cln, &next_cln);
+                if ( rc != RC_OK )
+                    return rc;
+
+                ++cur_file_cln;
+
+                if (next_cln != cur_cln + 1)
+                {
+                    if (fat_file_is_data_cluster(fs_info, run_cln))
+                        fat_file_extent_insert(fat_fd, run_file_cln, run_cln,
+                                               cur_file_cln - run_file_cln);
+
+                    run_cln = next_cln;
+                    run_file_cln = cur_file_cln;
+                }
+
+                cur_cln = next_cln;
+            }
+
+            if (fat_file_is_data_cluster(fs_info, run_cln) &&
+                fat_file_is_data_cluster(fs_info, cur_cln))
+                fat_file_extent_insert(fat_fd, run_file_cln, run_cln,
+                                       cur_file_cln - run_file_cln + 1);
         }
 
         /* update cache */
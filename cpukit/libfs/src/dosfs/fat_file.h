@@ -22,6 +22,7 @@
 #include <rtems.h>
 #include <rtems/libio_.h>
 
+#include <string.h>
 #include <time.h>
 
 #include "fat.h"
@@ -65,6 +66,24 @@ typedef struct fat_file_map_s
     uint32_t   last_cln;
 } fat_file_map_t;
 
+/*
+ * number of extents cached per fat-file
+ */
+#define FAT_FILE_EXTENT_CACHE_SIZE 8
+
+/**
+ * @brief Run of clusters of a fat-file which are consecutive on the volume.
+ *
+ * The extent cache of a fat-file maps cluster numbers in the fat-file to
+ * cluster numbers on the volume without a walk of the cluster chain.
+ */
+typedef struct fat_file_extent_s
+{
+    uint32_t   file_cln;  /* first cluster number in the fat-file */
+    uint32_t   disk_cln;  /* first cluster number on the volume */
+    uint32_t   count;     /* number of clusters, zero for an unused extent */
+} fat_file_extent_t;
+
 /**
  * @brief Descriptor of a fat-file.
  *
@@ -89,6 +108,10 @@ typedef struct fat_file_fd_s
     fat_dir_pos_t    dir_pos;
     uint8_t          flags;
     fat_file_map_t   map;
+    fat_file_extent_t extents[FAT_FILE_EXTENT_CACHE_SIZE]; /*
+                                     * extent cache in most recently used
+                                     * order
+                                     */
     time_t           ctime;
     time_t           mtime;
 
@@ -157,6 +180,12 @@ fat_file_set_first_cluster_num(fat_file_fd_t *fat_fd, uint32_t cln)
     fat_fd->flags |= FAT_FILE_META_DATA_CHANGED;
 }
 
+static inline void
+fat_file_invalidate_extents(fat_file_fd_t *fat_fd)
+{
+    memset(fat_fd->extents, 0, sizeof(fat_fd->extents));
+}
+
 static inline void fat_file_set_file_size(fat_file_fd_t *fat_fd, uint32_t s)
 {
     fat_fd->fat_file_size = s;
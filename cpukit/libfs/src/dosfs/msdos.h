@@ -41,6 +41,36 @@ extern "C" {
 
 #define MSDOS_NAME_NOT_FOUND_ERR  0x7D01
 
+/*
+ * Count of directories with a name cache
+ */
+#define MSDOS_NAME_CACHE_DIRECTORIES 8
+
+/*
+ * Name cache entry, the hash of a name and the index of the directory block
+ * which contains the first entry of the name
+ */
+typedef struct msdos_name_cache_entry_s
+{
+    uint32_t                          hash;
+    uint32_t                          dir_offset; /* block index + 1, or 0 if
+                                                   * unused
+                                                   */
+} msdos_name_cache_entry_t;
+
+/*
+ * Name cache of a directory. It contains all names of the directory, so a
+ * name not in the cache does not exist.
+ */
+typedef struct msdos_name_cache_s
+{
+    uint32_t                          dir_cln;  /* first cluster of directory */
+    uint32_t                          age;      /* time of last use */
+    uint32_t                          count;    /* count of used entries */
+    uint32_t                          size;     /* size of the hash table */
+    msdos_name_cache_entry_t         *entries;  /* NULL if cache is unused */
+} msdos_name_cache_t;
+
 /*
  * This structure identifies the instance of the filesystem on the MSDOS
  * level.
@@ -70,6 +100,19 @@ typedef struct msdos_fs_info_s
                                                             */
 
     rtems_dosfs_convert_control      *converter;
+
+    rtems_id                          free_bitmap_task;    /*
+                                                            * builds the free
+                                                            * cluster bitmap
+                                                            */
+    rtems_id                          free_bitmap_requester; /*
+                                                              * waits for the
+                                                              * task to stop
+                                                              */
+
+    bool                              name_cache_enabled;
+    uint32_t                          name_cache_clock;
+    msdos_name_cache_t                name_cache[MSDOS_NAME_CACHE_DIRECTORIES];
 } msdos_fs_info_t;
 
 RTEMS_INLINE_ROUTINE void msdos_fs_lock(msdos_fs_info_t *fs_info)
@@ -468,6 +511,19 @@ int msdos_find_name_in_fat_file(
     char                                 *name_dir_entry
 );
 
+void msdos_name_cache_invalidate(
+    msdos_fs_info_t                      *fs_info,
+    uint32_t                              dir_cln
+);
+
+void msdos_name_cache_free(
+    msdos_fs_info_t                      *fs_info
+);
+
+void msdos_free_bitmap_stop(
+    msdos_fs_info_t                      *fs_info
+);
+
 int msdos_find_node_by_cluster_num_in_fat_file(
     rtems_filesystem_mount_table_entry_t *mt_entry,
     fat_file_fd_t                        *fat_fd,
@@ -268,5 +268,6 @@ error:
 err:
     /* mark the used 32bytes structure on the disk as free */
     msdos_set_first_char4file_name(parent_loc->mt_entry, &dir_pos, 0xE5);
+    msdos_name_cache_invalidate(fs_info, parent_fat_fd->cln);
     return rc;
 }
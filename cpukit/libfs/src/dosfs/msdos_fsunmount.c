@@ -50,6 +50,8 @@ msdos_shut_down(rtems_filesystem_mount_table_entry_t *temp_mt_entry)
     fat_file_fd_t   *fat_fd = temp_mt_entry->mt_fs_root->location.node_access;
     rtems_dosfs_convert_control *converter = fs_info->converter;
 
+    msdos_free_bitmap_stop(fs_info);
+
     /* close fat-file which corresponds to root directory */
     fat_file_close(&fs_info->fat, fat_fd);
 
@@ -58,5 +60,6 @@ msdos_shut_down(rtems_filesystem_mount_table_entry_t *temp_mt_entry)
     rtems_recursive_mutex_destroy(&fs_info->vol_mutex);
     (*converter->handler->destroy)( converter );
     free(fs_info->cl_buf);
+    msdos_name_cache_free(fs_info);
     free(temp_mt_entry->fs_info);
 }
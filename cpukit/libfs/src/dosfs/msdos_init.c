@@ -28,6 +28,7 @@
 #include <rtems/libio_.h>
 #include <rtems/dosfs.h>
 #include "msdos.h"
+#include "fat_fat_operations.h"
 
 static int msdos_clone_node_info(rtems_filesystem_location_info_t *loc)
 {
@@ -84,6 +85,107 @@ void msdos_unlock(const rtems_filesystem_mount_table_entry_t *mt_entry)
   msdos_fs_unlock(mt_entry->fs_info);
 }
 
+static void msdos_free_bitmap_task(rtems_task_argument arg)
+{
+    msdos_fs_info_t *fs_info = (msdos_fs_info_t *) arg;
+    rtems_id         requester;
+    int              rc = RC_OK;
+
+    msdos_fs_lock(fs_info);
+
+    while (rc == RC_OK &&
+           fs_info->free_bitmap_requester == 0 &&
+           fs_info->fat.free_bitmap != NULL &&
+           !fat_free_bitmap_is_complete(&fs_info->fat))
+    {
+        rc = fat_free_bitmap_scan(&fs_info->fat, 1);
+
+        /* let the users of the file system run between the chunks */
+        msdos_fs_unlock(fs_info);
+        msdos_fs_lock(fs_info);
+    }
+
+    requester = fs_info->free_bitmap_requester;
+    fs_info->free_bitmap_task = 0;
+    msdos_fs_unlock(fs_info);
+
+    if (requester != 0)
+        rtems_event_transient_send(requester);
+
+    rtems_task_exit();
+}
+
+/* msdos_free_bitmap_start --
+ *     Allocate the free cluster bitmap if it is enabled and start a task
+ *     with the lowest priority of the scheduler to build it.  Until the
+ *     bitmap is complete, free clusters are found by a FAT scan.  In case
+ *     the task cannot be started, then the bitmap is built right now.
+ *
+ * PARAMETERS:
+ *     fs_info - MSDOS FS info
+ */
+static void msdos_free_bitmap_start(msdos_fs_info_t *fs_info)
+{
+    rtems_status_code   sc;
+    rtems_id            scheduler_id;
+    rtems_task_priority priority;
+    rtems_id            task_id;
+
+    fat_free_bitmap_init(&fs_info->fat);
+    if (fs_info->fat.free_bitmap == NULL)
+        return;
+
+    sc = rtems_task_get_scheduler(RTEMS_SELF, &scheduler_id);
+    if (sc == RTEMS_SUCCESSFUL)
+        sc = rtems_scheduler_get_maximum_priority(scheduler_id, &priority);
+
+    /* the idle task has the maximum priority */
+    if (sc == RTEMS_SUCCESSFUL)
+        sc = rtems_task_create(rtems_build_name('D', 'O', 'S', 'B'),
+                               priority - 1,
+                               2 * RTEMS_MINIMUM_STACK_SIZE,
+                               RTEMS_DEFAULT_MODES,
+                               RTEMS_DEFAULT_ATTRIBUTES,
+                               &task_id);
+
+    if (sc == RTEMS_SUCCESSFUL)
+    {
+        fs_info->free_bitmap_task = task_id;
+        sc = rtems_task_start(task_id,
+                              msdos_free_bitmap_task,
+                              (rtems_task_argument) fs_info);
+        if (sc != RTEMS_SUCCESSFUL)
+        {
+            fs_info->free_bitmap_task = 0;
+            rtems_task_delete(task_id);
+        }
+    }
+
+    if (sc != RTEMS_SUCCESSFUL)
+        fat_free_bitmap_scan(&fs_info->fat, UINT32_MAX);
+}
+
+/* msdos_free_bitmap_stop --
+ *     Stop the task which builds the free cluster bitmap and wait until it
+ *     no longer uses the file system.
+ *
+ * PARAMETERS:
+ *     fs_info - MSDOS FS info
+ */
+void msdos_free_bitmap_stop(msdos_fs_info_t *fs_info)
+{
+    bool wait;
+
+    msdos_fs_lock(fs_info);
+    wait = fs_info->free_bitmap_task != 0;
+    if (wait)
+        fs_info->free_bitmap_requester = rtems_task_self();
+    msdos_fs_unlock(fs_info);
+
+    if (wait)
+        rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+}
+
 /* msdos_initialize --
  *     MSDOS filesystem initialization. Called when mounting an
  *     MSDOS filesystem.
@@ -117,6 +219,15 @@ int rtems_dosfs_initialize(
                                       &msdos_file_handlers,
                                       &msdos_dir_handlers,
                                       converter);
+
+        if (rc == 0 && mount_options != NULL) {
+            msdos_fs_info_t *fs_info = mt_entry->fs_info;
+
+            fs_info->fat.free_bitmap_enabled =
+                mount_options->free_cluster_bitmap;
+            fs_info->name_cache_enabled = mount_options->name_cache;
+            msdos_free_bitmap_start(fs_info);
+        }
     } else {
         errno = ENOMEM;
         rc = -1;
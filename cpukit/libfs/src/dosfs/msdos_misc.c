@@ -425,6 +425,7 @@ msdos_find_name(
         /* these data is not actual for zero-length fat-file */
         fat_fd->map.file_cln = 0;
         fat_fd->map.disk_cln = fat_fd->cln;
+        fat_file_invalidate_extents(fat_fd);
 
         if ((fat_fd->fat_file_size != 0) &&
             (fat_fd->fat_file_size <= fs_info->fat.vol.bpc))
@@ -603,6 +604,7 @@ msdos_get_dotdot_dir_info_cluster_num_and_offset(
 
     fat_fd->map.file_cln = 0;
     fat_fd->map.disk_cln = fat_fd->cln;
+    fat_file_invalidate_extents(fat_fd);
 
     rc = fat_file_size(&fs_info->fat, fat_fd);
     if (rc != RC_OK)
@@ -672,6 +674,7 @@ msdos_get_dotdot_dir_info_cluster_num_and_offset(
 
     fat_fd->map.file_cln = 0;
     fat_fd->map.disk_cln = fat_fd->cln;
+    fat_file_invalidate_extents(fat_fd);
 
     rc = fat_file_size(&fs_info->fat, fat_fd);
     if (rc != RC_OK)
@@ -1288,6 +1291,453 @@ msdos_compare_entry_against_filename (
     return size_remaining;
 }
 
+/*
+ * Initial size of the hash table of a name cache
+ */
+#define MSDOS_NAME_CACHE_MIN_SIZE 64
+
+/*
+ * The name hash is computed from the end to the beginning of the normalized
+ * name, since the long file name entries are stored in reverse order.
+ */
+#define MSDOS_NAME_HASH_PRIME 16777619
+
+typedef struct
+{
+    uint32_t hash;
+    uint32_t factor;
+} msdos_name_hash_t;
+
+static void
+msdos_name_hash_init(msdos_name_hash_t *name_hash)
+{
+    name_hash->hash = 0;
+    name_hash->factor = 1;
+}
+
+static void
+msdos_name_hash_prepend(
+    msdos_name_hash_t *name_hash,
+    const uint8_t     *name,
+    size_t             name_len)
+{
+    while (name_len > 0)
+    {
+        --name_len;
+        name_hash->hash += name[name_len] * name_hash->factor;
+        name_hash->factor *= MSDOS_NAME_HASH_PRIME;
+    }
+}
+
+static uint32_t
+msdos_name_hash(const uint8_t *name, size_t name_len)
+{
+    msdos_name_hash_t name_hash;
+
+    msdos_name_hash_init(&name_hash);
+    msdos_name_hash_prepend(&name_hash, name, name_len);
+
+    return name_hash.hash;
+}
+
+static bool
+msdos_name_hash_prepend_entry(
+    rtems_dosfs_convert_control *converter,
+    msdos_name_hash_t           *name_hash,
+    const uint8_t               *entry_utf8,
+    ssize_t                      bytes_in_entry)
+{
+    uint8_t entry_normalized[MSDOS_LFN_ENTRY_SIZE_UTF8];
+    size_t  bytes_in_entry_normalized = sizeof(entry_normalized);
+    int     eno;
+
+    if (bytes_in_entry <= 0)
+        return false;
+
+    eno = (*converter->handler->utf8_normalize_and_fold) (
+        converter,
+        entry_utf8,
+        bytes_in_entry,
+        &entry_normalized[0],
+        &bytes_in_entry_normalized);
+    if (eno != 0)
+        return false;
+
+    msdos_name_hash_prepend(name_hash, &entry_normalized[0],
+                            bytes_in_entry_normalized);
+    return true;
+}
+
+static bool
+msdos_short_entry_name_hash(
+    rtems_dosfs_convert_control *converter,
+    const char                  *entry,
+    uint32_t                    *hash)
+{
+    uint8_t           entry_utf8[MSDOS_LFN_ENTRY_SIZE_UTF8];
+    ssize_t           bytes_in_entry;
+    msdos_name_hash_t name_hash;
+
+    bytes_in_entry = msdos_short_entry_to_utf8_name (
+        converter,
+        MSDOS_DIR_NAME(entry),
+        &entry_utf8[0],
+        MSDOS_SHORT_NAME_LEN + 1);
+
+    msdos_name_hash_init(&name_hash);
+    if (!msdos_name_hash_prepend_entry(converter, &name_hash,
+                                       &entry_utf8[0], bytes_in_entry))
+        return false;
+
+    *hash = name_hash.hash;
+    return true;
+}
+
+static msdos_name_cache_t *
+msdos_name_cache_get(
+    msdos_fs_info_t *fs_info,
+    uint32_t         dir_cln)
+{
+    int i;
+
+    for (i = 0; i < MSDOS_NAME_CACHE_DIRECTORIES; ++i)
+    {
+        msdos_name_cache_t *cache = &fs_info->name_cache[i];
+
+        if (cache->entries != NULL && cache->dir_cln == dir_cln)
+        {
+            cache->age = ++fs_info->name_cache_clock;
+            return cache;
+        }
+    }
+
+    return NULL;
+}
+
+static void
+msdos_name_cache_release(msdos_name_cache_t *cache)
+{
+    free(cache->entries);
+    cache->entries = NULL;
+    cache->count = 0;
+    cache->size = 0;
+}
+
+/* msdos_name_cache_invalidate --
+ *     Drop the name cache of a directory. This must be called if entries of
+ *     the directory are removed or if the directory itself is removed.
+ *
+ * PARAMETERS:
+ *     fs_info - MSDOS FS info
+ *     dir_cln - first cluster of the directory
+ *
+ * RETURNS:
+ *     None
+ */
+void
+msdos_name_cache_invalidate(
+    msdos_fs_info_t *fs_info,
+    uint32_t         dir_cln)
+{
+    msdos_name_cache_t *cache = msdos_name_cache_get(fs_info, dir_cln);
+
+    if (cache != NULL)
+        msdos_name_cache_release(cache);
+}
+
+void
+msdos_name_cache_free(msdos_fs_info_t *fs_info)
+{
+    int i;
+
+    for (i = 0; i < MSDOS_NAME_CACHE_DIRECTORIES; ++i)
+        msdos_name_cache_release(&fs_info->name_cache[i]);
+}
+
+static bool
+msdos_name_cache_add(
+    msdos_name_cache_t *cache,
+    uint32_t            hash,
+    uint32_t            dir_offset)
+{
+    msdos_name_cache_entry_t *entry;
+    uint32_t                  mask;
+
+    if (2 * (cache->count + 1) > cache->size)
+    {
+        msdos_name_cache_entry_t *old_entries = cache->entries;
+        uint32_t                  old_size = cache->size;
+        uint32_t                  i;
+
+        cache->size = 2 * old_size;
+        cache->entries = calloc(cache->size, sizeof(*cache->entries));
+        if (cache->entries == NULL)
+        {
+            cache->entries = old_entries;
+            return false;
+        }
+
+        cache->count = 0;
+        for (i = 0; i < old_size; ++i)
+        {
+            if (old_entries[i].dir_offset != 0)
+                msdos_name_cache_add(cache, old_entries[i].hash,
+                                     old_entries[i].dir_offset - 1);
+        }
+
+        free(old_entries);
+    }
+
+    mask = cache->size - 1;
+    entry = &cache->entries[hash & mask];
+
+    while (entry->dir_offset != 0)
+    {
+        if (entry->hash == hash && entry->dir_offset == dir_offset + 1)
+            return true;
+
+        entry = &cache->entries[(entry - cache->entries + 1) & mask];
+    }
+
+    entry->hash = hash;
+    entry->dir_offset = dir_offset + 1;
+    ++cache->count;
+
+    return true;
+}
+
+/* msdos_name_cache_build --
+ *     Create the name cache of a directory. The directory is scanned once and
+ *     the hash of each long and short file name is added together with the
+ *     index of the directory block which contains the first entry of the
+ *     name. The least recently used name cache is replaced if necessary.
+ *
+ * PARAMETERS:
+ *     fs_info - MSDOS FS info
+ *     fat_fd  - fat-file descriptor of the directory
+ *     bts2rd  - size of the directory blocks
+ *     cache   - placeholder for the name cache, NULL if there is not enough
+ *               memory available
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if error occured (errno set appropriately)
+ */
+static int
+msdos_name_cache_build(
+    msdos_fs_info_t     *fs_info,
+    fat_file_fd_t       *fat_fd,
+    uint32_t             bts2rd,
+    msdos_name_cache_t **cache_ptr)
+{
+    rtems_dosfs_convert_control *converter = fs_info->converter;
+    msdos_name_cache_t          *cache = &fs_info->name_cache[0];
+    msdos_name_hash_t            lfn_hash;
+    uint8_t                      entry_utf8[MSDOS_LFN_ENTRY_SIZE_UTF8];
+    ssize_t                      bytes_read;
+    ssize_t                      bytes_in_entry;
+    uint32_t                     dir_offset = 0;
+    uint32_t                     dir_entry;
+    uint32_t                     lfn_start = 0;
+    bool                         lfn_valid = false;
+    int                          lfn_entry = 0;
+    uint8_t                      lfn_checksum = 0;
+    bool                         ok = true;
+    int                          i;
+
+    for (i = 1; i < MSDOS_NAME_CACHE_DIRECTORIES; ++i)
+    {
+        if (cache->entries != NULL &&
+            (fs_info->name_cache[i].entries == NULL ||
+             fs_info->name_cache[i].age < cache->age))
+            cache = &fs_info->name_cache[i];
+    }
+
+    msdos_name_cache_release(cache);
+    *cache_ptr = NULL;
+
+    cache->entries = calloc(MSDOS_NAME_CACHE_MIN_SIZE,
+                            sizeof(*cache->entries));
+    if (cache->entries == NULL)
+        return RC_OK;
+
+    cache->size = MSDOS_NAME_CACHE_MIN_SIZE;
+    cache->dir_cln = fat_fd->cln;
+    cache->age = ++fs_info->name_cache_clock;
+    msdos_name_hash_init(&lfn_hash);
+
+    while (ok && (bytes_read = fat_file_read(&fs_info->fat, fat_fd,
+                                             dir_offset * bts2rd, bts2rd,
+                                             fs_info->cl_buf)) != FAT_EOF)
+    {
+        if (bytes_read < MSDOS_DIRECTORY_ENTRY_STRUCT_SIZE)
+        {
+            msdos_name_cache_release(cache);
+            rtems_set_errno_and_return_minus_one(EIO);
+        }
+
+        for (dir_entry = 0;
+             ok && dir_entry < bts2rd;
+             dir_entry += MSDOS_DIRECTORY_ENTRY_STRUCT_SIZE)
+        {
+            const char *entry = (const char *) fs_info->cl_buf + dir_entry;
+            uint8_t     entry_type = *MSDOS_DIR_ENTRY_TYPE(entry);
+
+            if (entry_type == MSDOS_THIS_DIR_ENTRY_AND_REST_EMPTY)
+                break;
+
+            if (entry_type == MSDOS_THIS_DIR_ENTRY_EMPTY)
+            {
+                lfn_valid = false;
+            }
+            else if ((*MSDOS_DIR_ATTR(entry) & MSDOS_ATTR_LFN_MASK) ==
+                     MSDOS_ATTR_LFN)
+            {
+                bool is_first_lfn_entry =
+                    (entry_type & MSDOS_LAST_LONG_ENTRY) != 0;
+
+                if (is_first_lfn_entry)
+                {
+                    lfn_valid = true;
+                    lfn_start = dir_offset;
+                    lfn_entry = entry_type & MSDOS_LAST_LONG_ENTRY_MASK;
+                    lfn_checksum = *MSDOS_DIR_LFN_CHECKSUM(entry);
+                    msdos_name_hash_init(&lfn_hash);
+                }
+
+                if (!lfn_valid ||
+                    lfn_entry != (entry_type & MSDOS_LAST_LONG_ENTRY_MASK) ||
+                    lfn_checksum != *MSDOS_DIR_LFN_CHECKSUM(entry))
+                {
+                    lfn_valid = false;
+                    continue;
+                }
+
+                lfn_entry--;
+
+                bytes_in_entry = msdos_long_entry_to_utf8_name (
+                    converter,
+                    entry,
+                    is_first_lfn_entry,
+                    &entry_utf8[0],
+                    sizeof (entry_utf8));
+                lfn_valid = msdos_name_hash_prepend_entry(converter,
+                                                          &lfn_hash,
+                                                          &entry_utf8[0],
+                                                          bytes_in_entry);
+            }
+            else
+            {
+                uint32_t name_offset = dir_offset;
+                uint32_t hash;
+
+                if (lfn_valid && lfn_entry == 0 &&
+                    lfn_checksum == msdos_lfn_checksum(entry))
+                {
+                    name_offset = lfn_start;
+                    ok = msdos_name_cache_add(cache, lfn_hash.hash,
+                                              name_offset);
+                }
+
+                if (ok &&
+                    (*MSDOS_DIR_ATTR(entry) & MSDOS_ATTR_VOLUME_ID) == 0 &&
+                    msdos_short_entry_name_hash(converter, entry, &hash))
+                    ok = msdos_name_cache_add(cache, hash, name_offset);
+
+                lfn_valid = false;
+            }
+        }
+
+        if (dir_entry < bts2rd)
+            break;
+
+        dir_offset++;
+    }
+
+    if (ok)
+        *cache_ptr = cache;
+    else
+        msdos_name_cache_release(cache);
+
+    return RC_OK;
+}
+
+/* msdos_name_cache_lookup --
+ *     Look up the hash of a name in the name cache of a directory. The name
+ *     cache is built if necessary.
+ *
+ * PARAMETERS:
+ *     fs_info    - MSDOS FS info
+ *     fat_fd     - fat-file descriptor of the directory
+ *     bts2rd     - size of the directory blocks
+ *     hash       - hash of the normalized name
+ *     dir_offset - placeholder for the index of the first directory block
+ *                  which may contain the name
+ *
+ * RETURNS:
+ *     RC_OK on success, MSDOS_NAME_NOT_FOUND_ERR if the name does not exist,
+ *     or -1 if error occured (errno set appropriately)
+ */
+static int
+msdos_name_cache_lookup(
+    msdos_fs_info_t *fs_info,
+    fat_file_fd_t   *fat_fd,
+    uint32_t         bts2rd,
+    uint32_t         hash,
+    uint32_t        *dir_offset)
+{
+    msdos_name_cache_t             *cache;
+    const msdos_name_cache_entry_t *entry;
+    uint32_t                        mask;
+    bool                            found = false;
+
+    *dir_offset = 0;
+
+    if (!fs_info->name_cache_enabled)
+        return RC_OK;
+
+    cache = msdos_name_cache_get(fs_info, fat_fd->cln);
+    if (cache == NULL)
+    {
+        int rc = msdos_name_cache_build(fs_info, fat_fd, bts2rd, &cache);
+
+        if (rc != RC_OK || cache == NULL)
+            return rc;
+    }
+
+    mask = cache->size - 1;
+    entry = &cache->entries[hash & mask];
+    *dir_offset = UINT32_MAX;
+
+    while (entry->dir_offset != 0)
+    {
+        if (entry->hash == hash)
+        {
+            found = true;
+            *dir_offset = MIN(*dir_offset, entry->dir_offset - 1);
+        }
+
+        entry = &cache->entries[(entry - cache->entries + 1) & mask];
+    }
+
+    if (!found)
+        return MSDOS_NAME_NOT_FOUND_ERR;
+
+    return RC_OK;
+}
+
+static void
+msdos_name_cache_insert(
+    msdos_fs_info_t *fs_info,
+    fat_file_fd_t   *fat_fd,
+    uint32_t         hash,
+    uint32_t         dir_offset)
+{
+    msdos_name_cache_t *cache = msdos_name_cache_get(fs_info, fat_fd->cln);
+
+    if (cache != NULL && !msdos_name_cache_add(cache, hash, dir_offset))
+        msdos_name_cache_release(cache);
+}
+
 static void
 msdos_prepare_for_next_entry(
     fat_pos_t *lfn_start,
@@ -1314,7 +1764,8 @@ msdos_find_file_in_directory (
     char                                 *name_dir_entry,
     fat_dir_pos_t                        *dir_pos,
     uint32_t                             *empty_file_offset,
-    uint32_t                             *empty_entry_count)
+    uint32_t                             *empty_entry_count,
+    uint32_t                              dir_offset)
 {
     int               rc                = RC_OK;
     ssize_t           bytes_read;
@@ -1330,7 +1781,6 @@ msdos_find_file_in_directory (
     bool              filename_matched  = false;
     ssize_t           name_len_remaining;
     rtems_dosfs_convert_control *converter = fs_info->converter;
-    uint32_t          dir_offset = 0;
 
     /*
      * Scan the directory seeing if the file is present. While
@@ -1683,7 +2133,8 @@ msdos_add_file (
     const char                           *name_dir_entry,
     fat_dir_pos_t                        *dir_pos,
     uint32_t                              empty_file_offset,
-    const uint32_t                        empty_entry_count
+    const uint32_t                        empty_entry_count,
+    const uint32_t                        name_hash
 )
 {
     int              ret;
@@ -1829,7 +2280,20 @@ msdos_add_file (
                                    empty_file_offset,
                                    length, fs_info->cl_buf);
     if (bytes_written == (ssize_t) length)
+    {
+        uint32_t hash;
+
+        msdos_name_cache_insert(fs_info, fat_fd, name_hash,
+                                empty_file_offset / bts2rd);
+        if (msdos_short_entry_name_hash(fs_info->converter, name_dir_entry,
+                                        &hash))
+            msdos_name_cache_insert(fs_info, fat_fd, hash,
+                                    empty_file_offset / bts2rd);
+        else
+            msdos_name_cache_invalidate(fs_info, fat_fd->cln);
+
         return 0;
+    }
     else if (bytes_written == -1)
         return -1;
     else
@@ -1854,6 +2318,8 @@ msdos_find_name_in_fat_file (
     uint32_t                           bts2rd                     = 0;
     uint32_t                           empty_file_offset          = 0;
     uint32_t                           empty_entry_count          = 0;
+    uint32_t                           dir_offset                 = 0;
+    uint32_t                           name_hash                  = 0;
     unsigned int                       lfn_entries;
     rtems_dosfs_convert_control       *converter = fs_info->converter;
     void                              *buffer = converter->buffer.data;
@@ -1913,6 +2379,18 @@ msdos_find_name_in_fat_file (
             retval = -1;
         break;
     }
+    if (retval == RC_OK) {
+      name_hash = msdos_name_hash(buffer, name_len_for_compare);
+
+      /*
+       * A lookup starts with the first directory block which may contain the
+       * name.  The creation of a node needs the complete scan to find the
+       * empty entries.
+       */
+      if (!create_node)
+          retval = msdos_name_cache_lookup(fs_info, fat_fd, bts2rd,
+                                           name_hash, &dir_offset);
+    }
     if (retval == RC_OK) {
       /* See if the file/directory does already exist */
       retval = msdos_find_file_in_directory (
@@ -1928,7 +2406,8 @@ msdos_find_name_in_fat_file (
           name_dir_entry,
           dir_pos,
           &empty_file_offset,
-          &empty_entry_count);
+          &empty_entry_count,
+          dir_offset);
     }
     /* Create a non-existing file/directory if requested */
     if (   retval == RC_OK
@@ -1978,7 +2457,8 @@ msdos_find_name_in_fat_file (
                 name_dir_entry,
                 dir_pos,
                 empty_file_offset,
-                empty_entry_count
+                empty_entry_count,
+                name_hash
             );
     }
 
@@ -45,7 +45,9 @@ msdos_rename(
 )
 {
     int                rc = RC_OK;
+    msdos_fs_info_t   *fs_info = old_loc->mt_entry->fs_info;
     fat_file_fd_t     *old_fat_fd  = old_loc->node_access;
+    fat_file_fd_t     *old_parent_fat_fd = old_parent_loc->node_access;
 
     /*
      * create new directory entry as "hard link", copying relevant info from
@@ -66,5 +68,7 @@ msdos_rename(
                                         &old_fat_fd->dir_pos,
                                         MSDOS_THIS_DIR_ENTRY_EMPTY);
 
+    msdos_name_cache_invalidate(fs_info, old_parent_fat_fd->cln);
+
     return rc;
 }
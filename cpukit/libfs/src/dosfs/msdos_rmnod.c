@@ -28,6 +28,7 @@ msdos_rmnod(const rtems_filesystem_location_info_t *parent_pathloc,
     int                rc = RC_OK;
     msdos_fs_info_t   *fs_info = pathloc->mt_entry->fs_info;
     fat_file_fd_t     *fat_fd = pathloc->node_access;
+    fat_file_fd_t     *parent_fat_fd = parent_pathloc->node_access;
 
     if (fat_fd->fat_file_type == FAT_DIRECTORY)
     {
@@ -65,6 +66,11 @@ msdos_rmnod(const rtems_filesystem_location_info_t *parent_pathloc,
     /* mark file removed */
     rc = msdos_set_first_char4file_name(pathloc->mt_entry, &fat_fd->dir_pos,
                                         MSDOS_THIS_DIR_ENTRY_EMPTY);
+
+    msdos_name_cache_invalidate(fs_info, parent_fat_fd->cln);
+    if (fat_fd->fat_file_type == FAT_DIRECTORY)
+        msdos_name_cache_invalidate(fs_info, fat_fd->cln);
+
     if (rc != RC_OK)
     {
         return rc;
@@ -19,6 +19,11 @@
 
 #include <rtems/imfs.h>
 
+#include <stdlib.h>
+#include <string.h>
+
+#define IMFS_DIRECTORY_INDEX_MIN_SIZE 16
+
 IMFS_jnode_t *IMFS_node_initialize_directory(
   IMFS_jnode_t *node,
   void *arg
@@ -27,10 +32,160 @@ IMFS_jnode_t *IMFS_node_initialize_directory(
   IMFS_directory_t *dir = (IMFS_directory_t *) node;
 
   rtems_chain_initialize_empty( &dir->Entries );
+  dir->Index = NULL;
+  dir->index_size = 0;
+  dir->entry_count = 0;
 
   return node;
 }
 
+static size_t IMFS_name_hash( const char *name, size_t namelen )
+{
+  uint32_t hash = 2166136261U;
+  size_t   i;
+
+  for ( i = 0; i < namelen; ++i ) {
+    hash = ( hash ^ (unsigned char) name[ i ] ) * 16777619U;
+  }
+
+  return hash;
+}
+
+static IMFS_jnode_t **IMFS_directory_index_bucket(
+  const IMFS_directory_t *dir,
+  const char             *name,
+  size_t                  namelen
+)
+{
+  size_t hash = IMFS_name_hash( name, namelen );
+
+  return &dir->Index[ hash & ( dir->index_size - 1 ) ];
+}
+
+static void IMFS_directory_index_insert(
+  IMFS_directory_t *dir,
+  IMFS_jnode_t     *node
+)
+{
+  IMFS_jnode_t **bucket;
+
+  bucket = IMFS_directory_index_bucket( dir, node->name, node->namelen );
+  node->Index_next = *bucket;
+  *bucket = node;
+}
+
+/*
+ * Creates the hash index with at least two buckets per entry and adds all
+ * entries of the directory to it.
+ */
+static bool IMFS_directory_index_create( IMFS_directory_t *dir )
+{
+  const rtems_chain_node *node;
+  const rtems_chain_node *tail;
+  IMFS_jnode_t          **index;
+  size_t                  index_size;
+
+  index_size = IMFS_DIRECTORY_INDEX_MIN_SIZE;
+
+  while ( index_size < 2 * dir->entry_count ) {
+    index_size *= 2;
+  }
+
+  index = calloc( index_size, sizeof( *index ) );
+  if ( index == NULL ) {
+    return false;
+  }
+
+  free( dir->Index );
+  dir->Index = index;
+  dir->index_size = index_size;
+
+  node = rtems_chain_immutable_first( &dir->Entries );
+  tail = rtems_chain_immutable_tail( &dir->Entries );
+
+  while ( node != tail ) {
+    IMFS_directory_index_insert( dir, (IMFS_jnode_t *) node );
+    node = rtems_chain_immutable_next( node );
+  }
+
+  return true;
+}
+
+void IMFS_directory_index_add( IMFS_directory_t *dir, IMFS_jnode_t *node )
+{
+  if ( dir->Index == NULL || dir->entry_count > dir->index_size ) {
+    if ( !IMFS_directory_index_create( dir ) ) {
+      free( dir->Index );
+      dir->Index = NULL;
+      dir->index_size = 0;
+    }
+  } else {
+    IMFS_directory_index_insert( dir, node );
+  }
+}
+
+void IMFS_directory_index_remove( IMFS_directory_t *dir, IMFS_jnode_t *node )
+{
+  IMFS_jnode_t **bucket;
+
+  if ( dir->entry_count == 0 ) {
+    free( dir->Index );
+    dir->Index = NULL;
+    dir->index_size = 0;
+    return;
+  }
+
+  bucket = IMFS_directory_index_bucket( dir, node->name, node->namelen );
+
+  while ( *bucket != node ) {
+    bucket = &( *bucket )->Index_next;
+  }
+
+  *bucket = node->Index_next;
+}
+
+IMFS_jnode_t *IMFS_find_in_directory(
+  IMFS_directory_t *dir,
+  const char       *name,
+  size_t            namelen
+)
+{
+  if ( dir->Index != NULL ) {
+    IMFS_jnode_t *entry;
+
+    entry = *IMFS_directory_index_bucket( dir, name, namelen );
+
+    while ( entry != NULL ) {
+      if (
+        entry->namelen == namelen
+          && memcmp( entry->name, name, namelen ) == 0
+      ) {
+        return entry;
+      }
+
+      entry = entry->Index_next;
+    }
+  } else {
+    rtems_chain_control *entries = &dir->Entries;
+    rtems_chain_node *current = rtems_chain_first( entries );
+    rtems_chain_node *tail = rtems_chain_tail( entries );
+
+    while ( current != tail ) {
+      IMFS_jnode_t *entry = (IMFS_jnode_t *) current;
+      bool match = entry->namelen == namelen
+        && memcmp( entry->name, name, namelen ) == 0;
+
+      if ( match ) {
+        return entry;
+      }
+
+      current = rtems_chain_next( current );
+    }
+  }
+
+  return NULL;
+}
+
 static bool IMFS_is_mount_point( const IMFS_directory_t *dir )
 {
   return dir->mt_fs != NULL;
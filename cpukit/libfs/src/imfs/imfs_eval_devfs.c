@@ -90,34 +90,13 @@ static IMFS_jnode_t *IMFS_devfs_search(
   IMFS_directory_t                     *dir
 )
 {
-  const char          *path;
-  size_t               pathlen;
-  rtems_chain_control *entries;
-  rtems_chain_node    *current;
-  rtems_chain_node    *tail;
+  const char *path;
+  size_t      pathlen;
 
   path = rtems_filesystem_eval_path_get_path( ctx );
   pathlen = rtems_filesystem_eval_path_get_pathlen( ctx );
-  entries = &dir->Entries;
-  current = rtems_chain_first( entries );
-  tail = rtems_chain_tail( entries );
-
-  while ( current != tail ) {
-    IMFS_jnode_t *entry;
-    bool          match;
-
-    entry = (IMFS_jnode_t *) current;
-    match = entry->namelen == pathlen
-      && memcmp( entry->name, path, pathlen ) == 0;
-
-    if ( match ) {
-      return entry;
-    }
 
-    current = rtems_chain_next( current );
-  }
-
-  return NULL;
+  return IMFS_find_in_directory( dir, path, pathlen );
 }
 
 void IMFS_eval_path_devfs( rtems_filesystem_eval_path_context_t *ctx )
@@ -0,0 +1,459 @@
+/**
+ * @file
+ *
+ * @ingroup IMFS
+ *
+ * @brief IMFS Extent File Handlers
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/imfs.h>
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * The offset of an extent is the sum of the sizes of all previous extents.
+ * Since each new extent is at least as large as all previous extents
+ * together, a linear search for the extent of an offset visits only a few
+ * extents.
+ */
+static IMFS_extent_t *IMFS_extfile_find(
+  const IMFS_extfile_t *extfile,
+  size_t                offset,
+  size_t               *extent_offset
+)
+{
+  IMFS_extent_t *extent;
+
+  extent = extfile->extents;
+
+  while ( offset >= extent->size ) {
+    offset -= extent->size;
+    ++extent;
+  }
+
+  *extent_offset = offset;
+  return extent;
+}
+
+static void IMFS_extfile_copy_in(
+  IMFS_extfile_t *extfile,
+  size_t          offset,
+  const uint8_t  *source,
+  size_t          count
+)
+{
+  IMFS_extent_t *extent;
+  size_t         extent_offset;
+
+  extent = IMFS_extfile_find( extfile, offset, &extent_offset );
+
+  while ( count > 0 ) {
+    size_t to_copy = extent->size - extent_offset;
+
+    if ( to_copy > count ) {
+      to_copy = count;
+    }
+
+    if ( source != NULL ) {
+      memcpy( &extent->data[ extent_offset ], source, to_copy );
+      source += to_copy;
+    } else {
+      memset( &extent->data[ extent_offset ], 0, to_copy );
+    }
+
+    count -= to_copy;
+    extent_offset = 0;
+    ++extent;
+  }
+}
+
+static void IMFS_extfile_copy_out(
+  const IMFS_extfile_t *extfile,
+  size_t                offset,
+  uint8_t              *destination,
+  size_t                count
+)
+{
+  const IMFS_extent_t *extent;
+  size_t               extent_offset;
+
+  extent = IMFS_extfile_find( extfile, offset, &extent_offset );
+
+  while ( count > 0 ) {
+    size_t to_copy = extent->size - extent_offset;
+
+    if ( to_copy > count ) {
+      to_copy = count;
+    }
+
+    memcpy( destination, &extent->data[ extent_offset ], to_copy );
+    destination += to_copy;
+    count -= to_copy;
+    extent_offset = 0;
+    ++extent;
+  }
+}
+
+static size_t IMFS_extfile_granule( const rtems_libio_t *iop )
+{
+  const IMFS_fs_info_t *fs_info = iop->pathinfo.mt_entry->fs_info;
+
+  if ( fs_info->extent_granule != 0 ) {
+    return fs_info->extent_granule;
+  }
+
+  return IMFS_EXTFILE_DEFAULT_GRANULE;
+}
+
+static size_t IMFS_extfile_round_up( size_t size, size_t granule )
+{
+  return ( ( size + granule - 1 ) / granule ) * granule;
+}
+
+/*
+ *  IMFS_extfile_reserve
+ *
+ *  This routine ensures that the capacity of the extent file is at least
+ *  the specified length.  The new extent doubles the capacity if possible.
+ *  Otherwise, it covers just the missing capacity.
+ */
+static int IMFS_extfile_reserve(
+  IMFS_extfile_t *extfile,
+  size_t          granule,
+  size_t          length
+)
+{
+  IMFS_extent_t *extents;
+  uint8_t       *data;
+  size_t         needed;
+  size_t         size;
+
+  if ( length <= extfile->capacity ) {
+    return 0;
+  }
+
+  needed = IMFS_extfile_round_up( length - extfile->capacity, granule );
+  size = extfile->capacity;
+
+  if ( size < needed ) {
+    size = needed;
+  }
+
+  size = IMFS_extfile_round_up( size, granule );
+  data = malloc( size );
+
+  if ( data == NULL && size > needed ) {
+    size = needed;
+    data = malloc( size );
+  }
+
+  if ( data == NULL ) {
+    rtems_set_errno_and_return_minus_one( ENOSPC );
+  }
+
+  extents = realloc(
+    extfile->extents,
+    ( extfile->extent_count + 1 ) * sizeof( *extents )
+  );
+  if ( extents == NULL ) {
+    free( data );
+    rtems_set_errno_and_return_minus_one( ENOSPC );
+  }
+
+  extents[ extfile->extent_count ].data = data;
+  extents[ extfile->extent_count ].size = size;
+  extfile->extents = extents;
+  ++extfile->extent_count;
+  extfile->capacity += size;
+
+  return 0;
+}
+
+/*
+ *  IMFS_extfile_release
+ *
+ *  This routine frees all extents which start at or after the specified
+ *  length.  The extents of a mapped file are kept.
+ */
+static void IMFS_extfile_release(
+  IMFS_extfile_t *extfile,
+  size_t          length
+)
+{
+  size_t offset;
+  size_t i;
+
+  offset = 0;
+
+  for ( i = 0; i < extfile->extent_count; ++i ) {
+    if ( offset >= length ) {
+      break;
+    }
+
+    offset += extfile->extents[ i ].size;
+  }
+
+  if ( extfile->map_count > 0 ) {
+    return;
+  }
+
+  extfile->capacity = offset;
+
+  while ( extfile->extent_count > i ) {
+    --extfile->extent_count;
+    free( extfile->extents[ extfile->extent_count ].data );
+  }
+
+  if ( extfile->extent_count == 0 ) {
+    free( extfile->extents );
+    extfile->extents = NULL;
+  }
+}
+
+static ssize_t IMFS_extfile_read(
+  rtems_libio_t *iop,
+  void          *buffer,
+  size_t         count
+)
+{
+  IMFS_extfile_t *extfile = IMFS_iop_to_extfile( iop );
+  size_t          size;
+  off_t           start;
+
+  size = extfile->File.size;
+  start = iop->offset;
+
+  if ( start >= (off_t) size ) {
+    return 0;
+  }
+
+  if ( count > size - (size_t) start ) {
+    count = size - (size_t) start;
+  }
+
+  IMFS_extfile_copy_out( extfile, (size_t) start, buffer, count );
+  iop->offset += count;
+  IMFS_update_atime( &extfile->File.Node );
+
+  return (ssize_t) count;
+}
+
+static ssize_t IMFS_extfile_write(
+  rtems_libio_t *iop,
+  const void    *buffer,
+  size_t         count
+)
+{
+  IMFS_extfile_t *extfile = IMFS_iop_to_extfile( iop );
+  size_t          size;
+  size_t          end;
+  off_t           start;
+
+  size = extfile->File.size;
+
+  if ( rtems_libio_iop_is_append( iop ) ) {
+    iop->offset = size;
+  }
+
+  start = iop->offset;
+
+  if ( count == 0 ) {
+    return 0;
+  }
+
+  if ( start > SSIZE_MAX || count > SSIZE_MAX - (size_t) start ) {
+    rtems_set_errno_and_return_minus_one( EFBIG );
+  }
+
+  end = (size_t) start + count;
+
+  if ( end > size ) {
+    int rv;
+
+    rv = IMFS_extfile_reserve( extfile, IMFS_extfile_granule( iop ), end );
+    if ( rv != 0 ) {
+      return rv;
+    }
+
+    if ( (size_t) start > size ) {
+      IMFS_extfile_copy_in( extfile, size, NULL, (size_t) start - size );
+    }
+
+    extfile->File.size = end;
+  }
+
+  IMFS_extfile_copy_in( extfile, (size_t) start, buffer, count );
+  iop->offset += count;
+  IMFS_mtime_ctime_update( &extfile->File.Node );
+
+  return (ssize_t) count;
+}
+
+static int IMFS_extfile_ftruncate(
+  rtems_libio_t *iop,
+  off_t          length
+)
+{
+  IMFS_extfile_t *extfile = IMFS_iop_to_extfile( iop );
+  size_t          size;
+
+  if ( length > SSIZE_MAX ) {
+    rtems_set_errno_and_return_minus_one( EFBIG );
+  }
+
+  size = extfile->File.size;
+
+  if ( (size_t) length > size ) {
+    int rv;
+
+    rv = IMFS_extfile_reserve(
+      extfile,
+      IMFS_extfile_granule( iop ),
+      (size_t) length
+    );
+    if ( rv != 0 ) {
+      return rv;
+    }
+
+    IMFS_extfile_copy_in( extfile, size, NULL, (size_t) length - size );
+  } else {
+    IMFS_extfile_release( extfile, (size_t) length );
+  }
+
+  extfile->File.size = (size_t) length;
+  IMFS_mtime_ctime_update( &extfile->File.Node );
+
+  return 0;
+}
+
+/*
+ *  IMFS_extfile_mmap
+ *
+ *  This routine maps a range of the file which is contained in one extent.
+ *  The mapping references the extent directly.  Extents do not move if the
+ *  file grows and the extents of a mapped file are kept until the last
+ *  mapping is removed.
+ */
+static int IMFS_extfile_mmap(
+  rtems_libio_t *iop,
+  void         **addr,
+  size_t         len,
+  int            prot,
+  off_t          off
+)
+{
+  IMFS_extfile_t *extfile = IMFS_iop_to_extfile( iop );
+  IMFS_extent_t  *extent;
+  size_t          extent_offset;
+
+  if (
+    off < 0
+      || (uintmax_t) off >= extfile->File.size
+      || len > extfile->File.size - (size_t) off
+  ) {
+    rtems_set_errno_and_return_minus_one( ENXIO );
+  }
+
+  extent = IMFS_extfile_find( extfile, (size_t) off, &extent_offset );
+
+  if ( len > extent->size - extent_offset ) {
+    rtems_set_errno_and_return_minus_one( ENOTSUP );
+  }
+
+  ++extfile->map_count;
+  *addr = &extent->data[ extent_offset ];
+  IMFS_update_atime( &extfile->File.Node );
+
+  return 0;
+}
+
+/*
+ *  IMFS_extfile_munmap
+ *
+ *  This routine removes a mapping of the file.  The extents kept for the
+ *  mappings beyond the file size are freed with the last mapping.
+ */
+static void IMFS_extfile_munmap(
+  const rtems_filesystem_location_info_t *loc,
+  void                                   *addr,
+  size_t                                  len
+)
+{
+  IMFS_extfile_t *extfile = loc->node_access;
+
+  --extfile->map_count;
+  IMFS_extfile_release( extfile, extfile->File.size );
+}
+
+static void IMFS_extfile_destroy( IMFS_jnode_t *node )
+{
+  IMFS_extfile_t *extfile = (IMFS_extfile_t *) node;
+
+  IMFS_extfile_release( extfile, 0 );
+  IMFS_node_destroy_default( node );
+}
+
+static const rtems_filesystem_file_handlers_r IMFS_extfile_handlers = {
+  .open_h = rtems_filesystem_default_open,
+  .close_h = rtems_filesystem_default_close,
+  .read_h = IMFS_extfile_read,
+  .write_h = IMFS_extfile_write,
+  .ioctl_h = rtems_filesystem_default_ioctl,
+  .lseek_h = rtems_filesystem_default_lseek_file,
+  .fstat_h = IMFS_stat_file,
+  .ftruncate_h = IMFS_extfile_ftruncate,
+  .fsync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fcntl_h = rtems_filesystem_default_fcntl,
+  .kqfilter_h = rtems_filesystem_default_kqfilter,
+  .mmap_h = IMFS_extfile_mmap,
+  .munmap_h = IMFS_extfile_munmap,
+  .poll_h = rtems_filesystem_default_poll,
+  .readv_h = rtems_filesystem_default_readv,
+  .writev_h = rtems_filesystem_default_writev
+};
+
+const IMFS_mknod_control IMFS_mknod_control_extfile = {
+  {
+    .handlers = &IMFS_extfile_handlers,
+    .node_initialize = IMFS_node_initialize_default,
+    .node_remove = IMFS_node_remove_default,
+    .node_destroy = IMFS_extfile_destroy
+  },
+  .node_size = sizeof( IMFS_extfile_t )
+};
@@ -22,6 +22,7 @@
 #include <rtems/imfs.h>
 
 #include <stdlib.h>
+#include <string.h>
 
 #include <rtems/seterr.h>
 
@@ -54,21 +55,71 @@ static const IMFS_mknod_controls IMFS_default_mknod_controls = {
   .fifo = &IMFS_mknod_control_enosys
 };
 
+static const IMFS_mknod_controls IMFS_extfile_mknod_controls = {
+  .directory = &IMFS_mknod_control_dir_default,
+  .device = &IMFS_mknod_control_device,
+  .file = &IMFS_mknod_control_extfile,
+  .fifo = &IMFS_mknod_control_enosys
+};
+
+static bool IMFS_is_option( const char *options, const char *option )
+{
+  size_t n = strlen( option );
+
+  if ( strncmp( options, option, n ) != 0 ) {
+    return false;
+  }
+
+  return option[ n - 1 ] == '=' || options[ n ] == '\0' || options[ n ] == ',';
+}
+
 int IMFS_initialize(
   rtems_filesystem_mount_table_entry_t *mt_entry,
   const void                           *data
 )
 {
-  IMFS_fs_info_t *fs_info = calloc( 1, sizeof( *fs_info ) );
-  IMFS_mount_data mount_data = {
-    .fs_info = fs_info,
-    .ops = &IMFS_ops,
-    .mknod_controls = &IMFS_default_mknod_controls
-  };
+  const char *options = data;
+  const IMFS_mknod_controls *mknod_controls = &IMFS_default_mknod_controls;
+  size_t extent_granule = 0;
+  IMFS_fs_info_t *fs_info;
+  IMFS_mount_data mount_data;
+
+  while ( options != NULL && *options != '\0' ) {
+    if ( IMFS_is_option( options, "extent-files" ) ) {
+      mknod_controls = &IMFS_extfile_mknod_controls;
+    } else if ( IMFS_is_option( options, "extent-granule=" ) ) {
+      char *end;
+
+      extent_granule = strtoul(
+        options + sizeof( "extent-granule=" ) - 1,
+        &end,
+        0
+      );
+
+      if ( *end != '\0' && *end != ',' ) {
+        rtems_set_errno_and_return_minus_one( EINVAL );
+      }
+    } else {
+      rtems_set_errno_and_return_minus_one( EINVAL );
+    }
+
+    options = strchr( options, ',' );
 
+    if ( options != NULL ) {
+      ++options;
+    }
+  }
+
+  fs_info = calloc( 1, sizeof( *fs_info ) );
   if ( fs_info == NULL ) {
     rtems_set_errno_and_return_minus_one( ENOMEM );
   }
 
+  fs_info->extent_granule = extent_granule;
+
+  mount_data.fs_info = fs_info;
+  mount_data.ops = &IMFS_ops;
+  mount_data.mknod_controls = mknod_controls;
+
   return IMFS_initialize_support( mt_entry, &mount_data );
 }
@@ -18,6 +18,7 @@
 #endif
 
 #include <string.h>
+#include <sys/mman.h>
 
 #include <rtems/imfs.h>
 
@@ -42,6 +43,54 @@ static ssize_t IMFS_linfile_read(
   return (ssize_t) count;
 }
 
+static int IMFS_linfile_mmap(
+  rtems_libio_t *iop,
+  void         **addr,
+  size_t         len,
+  int            prot,
+  off_t          off
+)
+{
+  IMFS_file_t *file = IMFS_iop_to_file( iop );
+
+  if (
+    off < 0
+      || (uintmax_t) off >= file->File.size
+      || len > file->File.size - (size_t) off
+  ) {
+    rtems_set_errno_and_return_minus_one( ENXIO );
+  }
+
+  /*
+   * The file image may be in read-only memory and linear files are never
+   * open for writing.
+   */
+  if ( ( prot & PROT_WRITE ) != 0 ) {
+    rtems_set_errno_and_return_minus_one( EACCES );
+  }
+
+  /*
+   * The mapping references the file image directly.  The copy on write of a
+   * writeable open is refused while the file is mapped.
+   */
+  ++file->Linearfile.map_count;
+  *addr = &file->Linearfile.direct[ off ];
+  IMFS_update_atime( &file->Node );
+
+  return 0;
+}
+
+static void IMFS_linfile_munmap(
+  const rtems_filesystem_location_info_t *loc,
+  void                                   *addr,
+  size_t                                  len
+)
+{
+  IMFS_file_t *file = loc->node_access;
+
+  --file->Linearfile.map_count;
+}
+
 static int IMFS_linfile_open(
   rtems_libio_t *iop,
   const char    *pathname,
@@ -60,6 +109,9 @@ static int IMFS_linfile_open(
     uint32_t count = file->File.size;
     const unsigned char *buffer = file->Linearfile.direct;
 
+    if (file->Linearfile.map_count > 0)
+      rtems_set_errno_and_return_minus_one( ETXTBSY );
+
     file->Node.control            = &IMFS_mknod_control_memfile.node_control;
     file->File.size               = 0;
     file->Memfile.indirect        = 0;
@@ -89,7 +141,8 @@ static const rtems_filesystem_file_handlers_r IMFS_linfile_handlers = {
   .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
   .fcntl_h = rtems_filesystem_default_fcntl,
   .kqfilter_h = rtems_filesystem_default_kqfilter,
-  .mmap_h = rtems_filesystem_default_mmap,
+  .mmap_h = IMFS_linfile_mmap,
+  .munmap_h = IMFS_linfile_munmap,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
   .writev_h = rtems_filesystem_default_writev
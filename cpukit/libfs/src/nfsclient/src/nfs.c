@@ -2855,6 +2855,7 @@ struct _rtems_filesystem_file_handlers_r nfs_file_file_handlers = {
 	.fcntl_h     = rtems_filesystem_default_fcntl,
 	.kqfilter_h  = rtems_filesystem_default_kqfilter,
 	.mmap_h      = rtems_filesystem_default_mmap,
+	.munmap_h    = rtems_filesystem_default_munmap,
 	.poll_h      = rtems_filesystem_default_poll,
 	.readv_h     = rtems_filesystem_default_readv,
 	.writev_h    = rtems_filesystem_default_writev
@@ -2876,6 +2877,7 @@ struct _rtems_filesystem_file_handlers_r nfs_dir_file_handlers = {
 	.fcntl_h     = rtems_filesystem_default_fcntl,
 	.kqfilter_h  = rtems_filesystem_default_kqfilter,
 	.mmap_h      = rtems_filesystem_default_mmap,
+	.munmap_h    = rtems_filesystem_default_munmap,
 	.poll_h      = rtems_filesystem_default_poll,
 	.readv_h     = rtems_filesystem_default_readv,
 	.writev_h    = rtems_filesystem_default_writev
@@ -2897,6 +2899,7 @@ struct _rtems_filesystem_file_handlers_r nfs_link_file_handlers = {
 	.fcntl_h     = rtems_filesystem_default_fcntl,
 	.kqfilter_h  = rtems_filesystem_default_kqfilter,
 	.mmap_h      = rtems_filesystem_default_mmap,
+	.munmap_h    = rtems_filesystem_default_munmap,
 	.poll_h      = rtems_filesystem_default_poll,
 	.readv_h     = rtems_filesystem_default_readv,
 	.writev_h    = rtems_filesystem_default_writev
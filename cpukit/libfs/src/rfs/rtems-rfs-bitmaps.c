@@ -280,7 +280,8 @@ rtems_rfs_bitmap_map_test (rtems_rfs_bitmap_control* control,
   if (bit >= control->size)
     return EINVAL;
   index = rtems_rfs_bitmap_map_index (bit);
-  *state = rtems_rfs_bitmap_test (map[index], bit);
+  *state = rtems_rfs_bitmap_test (map[index],
+                                  rtems_rfs_bitmap_map_offset (bit));
   return 0;
 }
 
@@ -357,169 +358,294 @@ rtems_rfs_bitmap_map_clear_all (rtems_rfs_bitmap_control* control)
   return 0;
 }
 
+/**
+ * Return the free bits of an element as a mask, that is a 1 for each clear
+ * bit. The searches scan whole elements with the mask and use the find first
+ * set builtins to locate a bit in an element.
+ *
+ * @param element The element of a map or search map.
+ * @return rtems_rfs_bitmap_element The mask of the free bits.
+ */
+static rtems_rfs_bitmap_element
+rtems_rfs_bitmap_free_bits (rtems_rfs_bitmap_element element)
+{
+#if RTEMS_RFS_BITMAP_CLEAR_ZERO
+  return ~element;
+#else
+  return element;
+#endif
+}
+
+/**
+ * Return the lowest bit set in the mask. The mask cannot be 0.
+ */
 static int
-rtems_rfs_search_map_for_clear_bit (rtems_rfs_bitmap_control* control,
-                                    rtems_rfs_bitmap_bit*     bit,
-                                    bool*                     found,
-                                    size_t                    window,
-                                    int                       direction)
+rtems_rfs_bitmap_first_bit (rtems_rfs_bitmap_element mask)
 {
-  rtems_rfs_bitmap_map      map;
-  rtems_rfs_bitmap_bit      test_bit;
-  rtems_rfs_bitmap_bit      end_bit;
-  rtems_rfs_bitmap_element* search_bits;
-  int                       search_index;
-  int                       search_offset;
-  rtems_rfs_bitmap_element* map_bits;
-  int                       map_index;
-  int                       map_offset;
-  int                       rc;
-
-  *found = false;
+  return __builtin_ctz (mask);
+}
 
-  /*
-   * Load the bitmap.
-   */
-  rc = rtems_rfs_bitmap_load_map (control, &map);
-  if (rc > 0)
-    return rc;
+/**
+ * Return the highest bit set in the mask. The mask cannot be 0.
+ */
+static int
+rtems_rfs_bitmap_last_bit (rtems_rfs_bitmap_element mask)
+{
+  return rtems_rfs_bitmap_element_bits () - 1 - __builtin_clz (mask);
+}
 
-  /*
-   * Calculate the bit we are testing plus the end point we search over.
-   */
-  test_bit = *bit;
-  end_bit  = test_bit + (window * direction);
+/**
+ * Find the lowest clear bit between the start and end bits. The map element
+ * holding the start bit is tested first and the search map is then used to
+ * skip to the next map element with a clear bit. Whole search elements with no
+ * clear map elements are skipped with a single test.
+ *
+ * @param control The bitmap control.
+ * @param map The map.
+ * @param start The first bit to search.
+ * @param end The last bit to search. Must be less than the size of the map.
+ * @param bit The clear bit if true is returned.
+ * @retval true A clear bit was found.
+ * @retval false No clear bit was found.
+ */
+static bool
+rtems_rfs_bitmap_find_up (rtems_rfs_bitmap_control* control,
+                          rtems_rfs_bitmap_map      map,
+                          rtems_rfs_bitmap_bit      start,
+                          rtems_rfs_bitmap_bit      end,
+                          rtems_rfs_bitmap_bit*     bit)
+{
+  rtems_rfs_bitmap_element bits;
+  int                      map_index;
+  int                      map_offset;
+  int                      end_index;
+  int                      search_index;
+  int                      search_offset;
+
+  map_index  = rtems_rfs_bitmap_map_index (start);
+  map_offset = rtems_rfs_bitmap_map_offset (start);
+  end_index  = rtems_rfs_bitmap_map_index (end);
+
+  while (true)
+  {
+    bits = rtems_rfs_bitmap_free_bits (map[map_index]) &
+      rtems_rfs_bitmap_mask_section (map_offset,
+                                     rtems_rfs_bitmap_element_bits ());
+    if (map_index == end_index)
+      bits &= rtems_rfs_bitmap_mask (rtems_rfs_bitmap_map_offset (end) + 1);
 
-  if (end_bit < 0)
-    end_bit = 0;
-  else if (end_bit >= control->size)
-    end_bit = control->size - 1;
+    if (bits != 0)
+    {
+      *bit = (map_index * rtems_rfs_bitmap_element_bits ()) +
+        rtems_rfs_bitmap_first_bit (bits);
+      return true;
+    }
 
-  map_index     = rtems_rfs_bitmap_map_index (test_bit);
-  map_offset    = rtems_rfs_bitmap_map_offset (test_bit);
-  search_index  = rtems_rfs_bitmap_map_index (map_index);
-  search_offset = rtems_rfs_bitmap_map_offset (map_index);
+    if (map_index >= end_index)
+      return false;
 
-  search_bits = &control->search_bits[search_index];
-  map_bits    = &map[map_index];
+    /*
+     * Find the next map element with a clear bit.
+     */
+    ++map_index;
+    search_index  = rtems_rfs_bitmap_map_index (map_index);
+    search_offset = rtems_rfs_bitmap_map_offset (map_index);
+    bits = rtems_rfs_bitmap_free_bits (control->search_bits[search_index]) &
+      rtems_rfs_bitmap_mask_section (search_offset,
+                                     rtems_rfs_bitmap_element_bits ());
+    while (bits == 0)
+    {
+      ++search_index;
+      if ((search_index * rtems_rfs_bitmap_element_bits ()) > end_index)
+        return false;
+      bits = rtems_rfs_bitmap_free_bits (control->search_bits[search_index]);
+    }
 
-  /*
-   * Check each bit from the search map offset for a clear bit.
-   */
-  do
+    map_index = (search_index * rtems_rfs_bitmap_element_bits ()) +
+      rtems_rfs_bitmap_first_bit (bits);
+    map_offset = 0;
+
+    if (map_index > end_index)
+      return false;
+  }
+}
+
+/**
+ * Find the highest clear bit between the start and end bits searching down
+ * from the start bit. See rtems_rfs_bitmap_find_up().
+ *
+ * @param control The bitmap control.
+ * @param map The map.
+ * @param start The first bit to search. Must be less than the size of the map.
+ * @param end The last bit to search.
+ * @param bit The clear bit if true is returned.
+ * @retval true A clear bit was found.
+ * @retval false No clear bit was found.
+ */
+static bool
+rtems_rfs_bitmap_find_down (rtems_rfs_bitmap_control* control,
+                            rtems_rfs_bitmap_map      map,
+                            rtems_rfs_bitmap_bit      start,
+                            rtems_rfs_bitmap_bit      end,
+                            rtems_rfs_bitmap_bit*     bit)
+{
+  rtems_rfs_bitmap_element bits;
+  int                      map_index;
+  int                      map_offset;
+  int                      end_index;
+  int                      search_index;
+  int                      search_offset;
+
+  map_index  = rtems_rfs_bitmap_map_index (start);
+  map_offset = rtems_rfs_bitmap_map_offset (start);
+  end_index  = rtems_rfs_bitmap_map_index (end);
+
+  while (true)
   {
+    bits = rtems_rfs_bitmap_free_bits (map[map_index]) &
+      rtems_rfs_bitmap_mask (map_offset + 1);
+    if (map_index == end_index)
+      bits &= rtems_rfs_bitmap_mask_section (rtems_rfs_bitmap_map_offset (end),
+                                             rtems_rfs_bitmap_element_bits ());
+
+    if (bits != 0)
+    {
+      *bit = (map_index * rtems_rfs_bitmap_element_bits ()) +
+        rtems_rfs_bitmap_last_bit (bits);
+      return true;
+    }
+
+    if (map_index <= end_index)
+      return false;
+
     /*
-     * If any bit is clear find that bit and then search the map element. If
-     * all bits are set there are no map bits so move to the next search
-     * element.
+     * Find the previous map element with a clear bit.
      */
-    if (!rtems_rfs_bitmap_match (*search_bits, RTEMS_RFS_BITMAP_ELEMENT_SET))
+    --map_index;
+    search_index  = rtems_rfs_bitmap_map_index (map_index);
+    search_offset = rtems_rfs_bitmap_map_offset (map_index);
+    bits = rtems_rfs_bitmap_free_bits (control->search_bits[search_index]) &
+      rtems_rfs_bitmap_mask (search_offset + 1);
+    while (bits == 0)
     {
-      while ((search_offset >= 0)
-             && (search_offset < rtems_rfs_bitmap_element_bits ()))
-      {
-        if (!rtems_rfs_bitmap_test (*search_bits, search_offset))
-        {
-          /*
-           * Find the clear bit in the map. Update the search map and map if
-           * found. We may find none are spare if searching up from the seed.
-           */
-          while ((map_offset >= 0)
-                 && (map_offset < rtems_rfs_bitmap_element_bits ()))
-          {
-            if (!rtems_rfs_bitmap_test (*map_bits, map_offset))
-            {
-              *map_bits = rtems_rfs_bitmap_set (*map_bits, 1 << map_offset);
-              if (rtems_rfs_bitmap_match(*map_bits,
-                                         RTEMS_RFS_BITMAP_ELEMENT_SET))
-                *search_bits = rtems_rfs_bitmap_set (*search_bits,
-                                                     1 << search_offset);
-              control->free--;
-              *bit = test_bit;
-              *found = true;
-              rtems_rfs_buffer_mark_dirty (control->buffer);
-              return 0;
-            }
-
-            if (test_bit == end_bit)
-              break;
-
-            map_offset += direction;
-            test_bit   += direction;
-          }
-        }
-
-        map_bits  += direction;
-        map_index += direction;
-        map_offset = direction > 0 ? 0 : rtems_rfs_bitmap_element_bits () - 1;
-
-        test_bit = (map_index * rtems_rfs_bitmap_element_bits ()) + map_offset;
-
-        search_offset += direction;
-
-        if (((direction < 0) && (test_bit <= end_bit))
-            || ((direction > 0) && (test_bit >= end_bit)))
-          break;
-      }
+      if ((search_index * rtems_rfs_bitmap_element_bits ()) <= end_index)
+        return false;
+      --search_index;
+      bits = rtems_rfs_bitmap_free_bits (control->search_bits[search_index]);
     }
+
+    map_index = (search_index * rtems_rfs_bitmap_element_bits ()) +
+      rtems_rfs_bitmap_last_bit (bits);
+    map_offset = rtems_rfs_bitmap_element_bits () - 1;
+
+    if (map_index < end_index)
+      return false;
+  }
+}
+
+/**
+ * Set the clear bits of a run starting at a clear bit. The run ends at the
+ * first set bit, the end of the map or when the number of bits wanted have
+ * been set. Whole elements are set at a time.
+ *
+ * @param control The bitmap control.
+ * @param map The map.
+ * @param bit The first bit of the run. Must be clear.
+ * @param wanted The maximum number of bits in the run.
+ * @return size_t The number of bits set.
+ */
+static size_t
+rtems_rfs_bitmap_set_run (rtems_rfs_bitmap_control* control,
+                          rtems_rfs_bitmap_map      map,
+                          rtems_rfs_bitmap_bit      bit,
+                          size_t                    wanted)
+{
+  size_t count = 0;
+
+  if (wanted > (control->size - bit))
+    wanted = control->size - bit;
+
+  while (count < wanted)
+  {
+    rtems_rfs_bitmap_element bits;
+    int                      map_index;
+    int                      map_offset;
+    int                      search_index;
+    int                      search_offset;
+    size_t                   available;
+    size_t                   run;
+
+    map_index  = rtems_rfs_bitmap_map_index (bit);
+    map_offset = rtems_rfs_bitmap_map_offset (bit);
+    available  = rtems_rfs_bitmap_element_bits () - map_offset;
+
+    /*
+     * The bits above the free bits shifted down are 0 so the inverted bits
+     * are only all 0 if the whole element is free.
+     */
+    bits = ~(rtems_rfs_bitmap_free_bits (map[map_index]) >> map_offset);
+    if (bits == 0)
+      run = available;
     else
+      run = rtems_rfs_bitmap_first_bit (bits);
+
+    if (run > (wanted - count))
+      run = wanted - count;
+
+    if (run == 0)
+      break;
+
+    map[map_index] = rtems_rfs_bitmap_set (map[map_index],
+                                           rtems_rfs_bitmap_mask (run)
+                                           << map_offset);
+
+    if (rtems_rfs_bitmap_match (map[map_index], RTEMS_RFS_BITMAP_ELEMENT_SET))
     {
-      /*
-       * Move to the next search element. We need to determine the number of
-       * bits in the search offset that are being skipped so the map bits
-       * pointer can be updated. If we are moving down and we have a search
-       * offset of 0 then the search map adjustment is to the top bit of the
-       * pervious search bit's value.
-       *
-       * Align test_bit either up or down depending on the direction to next 32
-       * bit boundary.
-       */
-      rtems_rfs_bitmap_bit bits_skipped;
-      test_bit &= ~((1 << RTEMS_RFS_ELEMENT_BITS_POWER_2) - 1);
-      if (direction > 0)
-      {
-        bits_skipped = rtems_rfs_bitmap_element_bits () - search_offset;
-        test_bit += bits_skipped * rtems_rfs_bitmap_element_bits ();
-        map_offset = 0;
-      }
-      else
-      {
-        bits_skipped = search_offset + 1;
-        /*
-         * Need to remove 1 for the rounding up. The above rounds down and
-         * adds 1. Remember the logic is for subtraction.
-         */
-        test_bit -= ((bits_skipped - 1) * rtems_rfs_bitmap_element_bits ()) + 1;
-        map_offset = rtems_rfs_bitmap_element_bits () - 1;
-      }
-      map_bits += direction * bits_skipped;
-      map_index += direction * bits_skipped;
+      search_index  = rtems_rfs_bitmap_map_index (map_index);
+      search_offset = rtems_rfs_bitmap_map_offset (map_index);
+      control->search_bits[search_index] =
+        rtems_rfs_bitmap_set (control->search_bits[search_index],
+                              1 << search_offset);
     }
 
-    search_bits  += direction;
-    search_offset = direction > 0 ? 0 : rtems_rfs_bitmap_element_bits () - 1;
+    count += run;
+    bit   += run;
+
+    if (run < available)
+      break;
   }
-  while (((direction < 0) && (test_bit >= end_bit))
-         || ((direction > 0) && (test_bit <= end_bit)));
 
-  return 0;
+  control->free -= count;
+  rtems_rfs_buffer_mark_dirty (control->buffer);
+
+  return count;
 }
 
 int
-rtems_rfs_bitmap_map_alloc (rtems_rfs_bitmap_control* control,
-                            rtems_rfs_bitmap_bit      seed,
-                            bool*                     allocated,
-                            rtems_rfs_bitmap_bit*     bit)
+rtems_rfs_bitmap_map_alloc_run (rtems_rfs_bitmap_control* control,
+                                rtems_rfs_bitmap_bit      seed,
+                                size_t                    wanted,
+                                size_t*                   count,
+                                rtems_rfs_bitmap_bit*     bit)
 {
+  rtems_rfs_bitmap_map map;
   rtems_rfs_bitmap_bit upper_seed;
   rtems_rfs_bitmap_bit lower_seed;
   rtems_rfs_bitmap_bit window;     /* may become a parameter */
-  int                  rc = 0;
+  bool                 found = false;
+  int                  rc;
 
   /*
    * By default we assume the allocation failed.
    */
-  *allocated = false;
+  *count = 0;
+
+  if ((seed < 0) || (seed >= control->size) || (wanted == 0))
+    return 0;
+
+  rc = rtems_rfs_bitmap_load_map (control, &map);
+  if (rc > 0)
+    return rc;
 
   /*
    * The window is the number of bits we search over in either direction each
@@ -537,34 +663,30 @@ rtems_rfs_bitmap_map_alloc (rtems_rfs_bitmap_control* control,
   upper_seed = seed;
   lower_seed = seed;
 
-  /*
-   * If the upper and lower seed values have reached the limits of the bitmap
-   * we have searched all of the map. The seed may not be aligned to a window
-   * boundary so we may need to search a partial window and this may also not
-   * be balanced for the upper or lower seeds. We move to the limits, search
-   * then return false if no clear bits are found.
-   */
-  while (((upper_seed >= 0) && (upper_seed < control->size))
-         || ((lower_seed >= 0) && (lower_seed < control->size)))
+  while ((upper_seed < control->size) || (lower_seed >= 0))
   {
     /*
      * Search up first so bits allocated in succession are grouped together.
      */
     if (upper_seed < control->size)
     {
+      rtems_rfs_bitmap_bit end_bit = upper_seed + window;
+      if (end_bit >= control->size)
+        end_bit = control->size - 1;
       *bit = upper_seed;
-      rc = rtems_rfs_search_map_for_clear_bit (control, bit, allocated,
-                                               window, 1);
-      if ((rc > 0) || *allocated)
+      found = rtems_rfs_bitmap_find_up (control, map, upper_seed, end_bit, bit);
+      if (found)
         break;
     }
 
     if (lower_seed >= 0)
     {
+      rtems_rfs_bitmap_bit end_bit = lower_seed - window;
+      if (end_bit < 0)
+        end_bit = 0;
       *bit = lower_seed;
-      rc = rtems_rfs_search_map_for_clear_bit (control, bit, allocated,
-                                               window, -1);
-      if ((rc > 0) || *allocated)
+      found = rtems_rfs_bitmap_find_down (control, map, lower_seed, end_bit, bit);
+      if (found)
         break;
     }
 
@@ -578,9 +700,26 @@ rtems_rfs_bitmap_map_alloc (rtems_rfs_bitmap_control* control,
       lower_seed -= window;
   }
 
+  if (found)
+    *count = rtems_rfs_bitmap_set_run (control, map, *bit, wanted);
+
   return 0;
 }
 
+int
+rtems_rfs_bitmap_map_alloc (rtems_rfs_bitmap_control* control,
+                            rtems_rfs_bitmap_bit      seed,
+                            bool*                     allocated,
+                            rtems_rfs_bitmap_bit*     bit)
+{
+  size_t count;
+  int    rc;
+
+  rc = rtems_rfs_bitmap_map_alloc_run (control, seed, 1, &count, bit);
+  *allocated = count > 0;
+  return rc;
+}
+
 int
 rtems_rfs_bitmap_create_search (rtems_rfs_bitmap_control* control)
 {
@@ -618,14 +757,9 @@ rtems_rfs_bitmap_create_search (rtems_rfs_bitmap_control* control)
     }
 
     if (rtems_rfs_bitmap_match (bits, RTEMS_RFS_BITMAP_ELEMENT_SET))
-      rtems_rfs_bitmap_set (*search_map, bit);
+      *search_map = rtems_rfs_bitmap_set (*search_map, 1 << bit);
     else
-    {
-      int b;
-      for (b = 0; b < available; b++)
-        if (!rtems_rfs_bitmap_test (bits, b))
-          control->free++;
-    }
+      control->free += __builtin_popcount (rtems_rfs_bitmap_free_bits (bits));
 
     size -= available;
 
@@ -634,7 +768,8 @@ rtems_rfs_bitmap_create_search (rtems_rfs_bitmap_control* control)
     {
       bit = 0;
       search_map++;
-      *search_map = RTEMS_RFS_BITMAP_ELEMENT_CLEAR;
+      if (size)
+        *search_map = RTEMS_RFS_BITMAP_ELEMENT_CLEAR;
     }
     else
       bit++;
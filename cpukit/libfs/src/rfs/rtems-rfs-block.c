@@ -107,6 +107,8 @@ rtems_rfs_block_map_open (rtems_rfs_file_system*  fs,
 
   map->dirty = false;
   map->inode = NULL;
+  map->reserved_block = 0;
+  map->reserved_count = 0;
   rtems_rfs_block_set_size_zero (&map->size);
   rtems_rfs_block_set_bpos_zero (&map->bpos);
 
@@ -149,13 +151,15 @@ rtems_rfs_block_map_close (rtems_rfs_file_system* fs,
   int rc = 0;
   int brc;
 
+  rc = rtems_rfs_block_map_unreserve (fs, map);
+
   if (map->dirty && map->inode)
   {
     brc = rtems_rfs_inode_load (fs, map->inode);
-    if (brc > 0)
+    if ((brc > 0) && (rc == 0))
       rc = brc;
 
-    if (rc == 0)
+    if (brc == 0)
     {
       int b;
 
@@ -167,7 +171,7 @@ rtems_rfs_block_map_close (rtems_rfs_file_system* fs,
       rtems_rfs_inode_set_last_data_block (map->inode, map->last_data_block);
 
       brc = rtems_rfs_inode_unload (fs, map->inode, true);
-      if (brc > 0)
+      if ((brc > 0) && (rc == 0))
         rc = brc;
 
       map->dirty = false;
@@ -402,13 +406,91 @@ rtems_rfs_block_map_indirect_alloc (rtems_rfs_file_system*   fs,
   return 0;
 }
 
+/**
+ * Free a run of data blocks allocated by the grow that have not been added to
+ * the map.
+ *
+ * @param fs The file system data.
+ * @param block The first block of the run.
+ * @param count The number of blocks in the run.
+ */
+static void
+rtems_rfs_block_map_free_run (rtems_rfs_file_system* fs,
+                              rtems_rfs_block_no     block,
+                              size_t                 count)
+{
+  while (count > 0)
+  {
+    rtems_rfs_group_bitmap_free (fs, false, block);
+    block++;
+    count--;
+  }
+}
+
+int
+rtems_rfs_block_map_reserve (rtems_rfs_file_system* fs,
+                             rtems_rfs_block_map*   map,
+                             size_t                 blocks)
+{
+  rtems_rfs_bitmap_bit block;
+  size_t               count;
+  int                  rc;
+
+  if ((map->reserved_count > 0) || (blocks == 0))
+    return 0;
+
+  if ((map->size.count + blocks) >= rtems_rfs_fs_max_block_map_blocks (fs))
+    blocks = rtems_rfs_fs_max_block_map_blocks (fs) - map->size.count;
+
+  rc = rtems_rfs_group_bitmap_alloc_run (fs, map->last_data_block, blocks,
+                                         &block, &count);
+  if (rc > 0)
+  {
+    /*
+     * A full file system is reported by the grow.
+     */
+    if (rc == ENOSPC)
+      return 0;
+    return rc;
+  }
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_BLOCK_MAP_GROW))
+    printf ("rtems-rfs: block-map-reserve: block=%" PRId32 " count=%zu\n",
+            block, count);
+
+  map->reserved_block = block;
+  map->reserved_count = count;
+
+  return 0;
+}
+
+int
+rtems_rfs_block_map_unreserve (rtems_rfs_file_system* fs,
+                               rtems_rfs_block_map*   map)
+{
+  int rc = 0;
+
+  while (map->reserved_count > 0)
+  {
+    int brc = rtems_rfs_group_bitmap_free (fs, false, map->reserved_block);
+    if ((brc > 0) && (rc == 0))
+      rc = brc;
+    map->reserved_block++;
+    map->reserved_count--;
+  }
+
+  return rc;
+}
+
 int
 rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
                           rtems_rfs_block_map*   map,
                           size_t                 blocks,
                           rtems_rfs_block_no*    new_block)
 {
-  int b;
+  rtems_rfs_bitmap_bit run_block = 0;
+  size_t               run_count = 0;
+  int                  b;
 
   if (rtems_rfs_trace (RTEMS_RFS_TRACE_BLOCK_MAP_GROW))
     printf ("rtems-rfs: block-map-grow: entry: blocks=%zd count=%" PRIu32 "\n",
@@ -418,8 +500,10 @@ rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
     return EFBIG;
 
   /*
-   * Allocate a block at a time. The buffer handles hold the blocks so adding
-   * this way does not thrash the cache with lots of requests.
+   * Map a block at a time. The buffer handles hold the blocks so adding this
+   * way does not thrash the cache with lots of requests. The data blocks are
+   * allocated in contiguous runs so a multi-block grow is not fragmented by
+   * other allocations.
    */
   for (b = 0; b < blocks; b++)
   {
@@ -428,13 +512,30 @@ rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
 
     /*
      * Allocate the block. If an indirect block is needed and cannot be
-     * allocated free this block.
+     * allocated free this block and the rest of the run.
      */
+    if ((run_count == 0) && (map->reserved_count > 0))
+    {
+      run_block = map->reserved_block;
+      run_count = map->reserved_count;
+      if (run_count > (blocks - b))
+        run_count = blocks - b;
+      map->reserved_block += run_count;
+      map->reserved_count -= run_count;
+    }
 
-    rc = rtems_rfs_group_bitmap_alloc (fs, map->last_data_block,
-                                       false, &block);
-    if (rc > 0)
-      return rc;
+    if (run_count == 0)
+    {
+      rc = rtems_rfs_group_bitmap_alloc_run (fs, map->last_data_block,
+                                             blocks - b,
+                                             &run_block, &run_count);
+      if (rc > 0)
+        return rc;
+    }
+
+    block = run_block;
+    run_block++;
+    run_count--;
 
     if (map->size.count < RTEMS_RFS_INODE_BLOCKS)
       map->blocks[map->size.count] = block;
@@ -478,7 +579,7 @@ rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
 
         if (rc > 0)
         {
-          rtems_rfs_group_bitmap_free (fs, false, block);
+          rtems_rfs_block_map_free_run (fs, block, run_count + 1);
           return rc;
         }
       }
@@ -507,7 +608,7 @@ rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
                                                    false);
           if (rc > 0)
           {
-            rtems_rfs_group_bitmap_free (fs, false, block);
+            rtems_rfs_block_map_free_run (fs, block, run_count + 1);
             return rc;
           }
 
@@ -527,7 +628,7 @@ rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
             if (rc > 0)
             {
               rtems_rfs_group_bitmap_free (fs, false, singly_block);
-              rtems_rfs_group_bitmap_free (fs, false, block);
+              rtems_rfs_block_map_free_run (fs, block, run_count + 1);
               return rc;
             }
           }
@@ -538,7 +639,7 @@ rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
             if (rc > 0)
             {
               rtems_rfs_group_bitmap_free (fs, false, singly_block);
-              rtems_rfs_group_bitmap_free (fs, false, block);
+              rtems_rfs_block_map_free_run (fs, block, run_count + 1);
               return rc;
             }
           }
@@ -555,7 +656,7 @@ rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
                                                 true);
           if (rc > 0)
           {
-            rtems_rfs_group_bitmap_free (fs, false, block);
+            rtems_rfs_block_map_free_run (fs, block, run_count + 1);
             return rc;
           }
 
@@ -566,7 +667,7 @@ rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
                                                 singly_block, true);
           if (rc > 0)
           {
-            rtems_rfs_group_bitmap_free (fs, false, block);
+            rtems_rfs_block_map_free_run (fs, block, run_count + 1);
             return rc;
           }
         }
@@ -650,10 +751,16 @@ rtems_rfs_block_map_shrink (rtems_rfs_file_system* fs,
                             rtems_rfs_block_map*   map,
                             size_t                 blocks)
 {
+  int brc;
+
   if (rtems_rfs_trace (RTEMS_RFS_TRACE_BLOCK_MAP_SHRINK))
     printf ("rtems-rfs: block-map-shrink: entry: blocks=%zd count=%" PRIu32 "\n",
             blocks, map->size.count);
 
+  brc = rtems_rfs_block_map_unreserve (fs, map);
+  if (brc > 0)
+    return brc;
+
   if (map->size.count == 0)
     return 0;
 
@@ -75,13 +75,57 @@ rtems_rfs_scan_chain (rtems_chain_control*   chain,
   return NULL;
 }
 
-int
-rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
-                                 rtems_rfs_buffer_handle* handle,
-                                 rtems_rfs_buffer_block   block,
-                                 bool                     read)
+/**
+ * A block requested from the I/O layer without the buffers lock.
+ */
+typedef struct
 {
-  int rc;
+  rtems_chain_node       link;  /**< The node on the pending list. */
+  rtems_rfs_buffer_block block; /**< The requested block number. */
+} rtems_rfs_buffer_pending;
+
+/**
+ * Check if another task requests the block from the I/O layer.
+ *
+ * @param fs The file system data.
+ * @param block The block number to check.
+ * @return bool True if the block is pending.
+ */
+static bool
+rtems_rfs_buffer_is_pending (rtems_rfs_file_system* fs,
+                             rtems_rfs_buffer_block block)
+{
+  rtems_chain_node* node;
+
+  node = rtems_chain_first (&fs->buffers_pending);
+
+  while (!rtems_chain_is_tail (&fs->buffers_pending, node))
+  {
+    if (((rtems_rfs_buffer_pending*) node)->block == block)
+      return true;
+    node = rtems_chain_next (node);
+  }
+
+  return false;
+}
+
+static int
+rtems_rfs_buffer_handle_release_unprotected (rtems_rfs_file_system*   fs,
+                                             rtems_rfs_buffer_handle* handle);
+
+/**
+ * Request a buffer with the buffers lock held. The lock is released while the
+ * buffer is requested from the I/O layer, so the disk I/O of one task does
+ * not block the buffer requests of other tasks.
+ */
+static int
+rtems_rfs_buffer_handle_request_locked (rtems_rfs_file_system*   fs,
+                                        rtems_rfs_buffer_handle* handle,
+                                        rtems_rfs_buffer_block   block,
+                                        bool                     read)
+{
+  rtems_rfs_buffer_pending pending;
+  int                      rc;
 
   /*
    * If the handle has a buffer release it. This allows a handle to be reused
@@ -99,7 +143,7 @@ rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
       printf ("rtems-rfs: buffer-request: handle has buffer: %" PRIu32 "\n",
               rtems_rfs_buffer_bnum (handle));
 
-    rc = rtems_rfs_buffer_handle_release (fs, handle);
+    rc = rtems_rfs_buffer_handle_release_unprotected (fs, handle);
     if (rc > 0)
       return rc;
     handle->dirty = false;
@@ -109,73 +153,96 @@ rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
   if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_HANDLE_REQUEST))
     printf ("rtems-rfs: buffer-request: block=%" PRIu32 "\n", block);
 
-  /*
-   * First check to see if the buffer has already been requested and is
-   * currently attached to a handle. If it is share the access. A buffer could
-   * be shared where different parts of the block have separate functions. An
-   * example is an inode block and the file system needs to handle 2 inodes in
-   * the same block at the same time.
-   */
-  if (fs->buffers_count)
+  while (true)
   {
     /*
-     * Check the active buffer list for shared buffers.
+     * First check to see if the buffer has already been requested and is
+     * currently attached to a handle. If it is share the access. A buffer
+     * could be shared where different parts of the block have separate
+     * functions. An example is an inode block and the file system needs to
+     * handle 2 inodes in the same block at the same time.
      */
-    handle->buffer = rtems_rfs_scan_chain (&fs->buffers,
-                                           &fs->buffers_count,
-                                           block);
-    if (rtems_rfs_buffer_handle_has_block (handle) &&
-        rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_HANDLE_REQUEST))
-      printf ("rtems-rfs: buffer-request: buffer shared: refs: %d\n",
-              rtems_rfs_buffer_refs (handle) + 1);
-  }
+    if (fs->buffers_count)
+    {
+      /*
+       * Check the active buffer list for shared buffers.
+       */
+      handle->buffer = rtems_rfs_scan_chain (&fs->buffers,
+                                             &fs->buffers_count,
+                                             block);
+      if (rtems_rfs_buffer_handle_has_block (handle) &&
+          rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_HANDLE_REQUEST))
+        printf ("rtems-rfs: buffer-request: buffer shared: refs: %d\n",
+                rtems_rfs_buffer_refs (handle) + 1);
+    }
 
-  /*
-   * If the buffer has not been found check the local cache of released
-   * buffers. There are release and released modified lists to preserve the
-   * state.
-   */
-  if (!rtems_rfs_fs_no_local_cache (fs) &&
-      !rtems_rfs_buffer_handle_has_block (handle))
-  {
     /*
-     * Check the local cache of released buffers.
+     * If the buffer has not been found check the local cache of released
+     * buffers. There are release and released modified lists to preserve the
+     * state.
      */
-    if (fs->release_count)
-      handle->buffer = rtems_rfs_scan_chain (&fs->release,
-                                             &fs->release_count,
-                                             block);
-
-    if (!rtems_rfs_buffer_handle_has_block (handle) &&
-        fs->release_modified_count)
+    if (!rtems_rfs_fs_no_local_cache (fs) &&
+        !rtems_rfs_buffer_handle_has_block (handle))
     {
-      handle->buffer = rtems_rfs_scan_chain (&fs->release_modified,
-                                             &fs->release_modified_count,
-                                             block);
       /*
-       * If we found a buffer retain the dirty buffer state.
+       * Check the local cache of released buffers.
        */
-      if (rtems_rfs_buffer_handle_has_block (handle))
-        rtems_rfs_buffer_mark_dirty (handle);
+      if (fs->release_count)
+        handle->buffer = rtems_rfs_scan_chain (&fs->release,
+                                               &fs->release_count,
+                                               block);
+
+      if (!rtems_rfs_buffer_handle_has_block (handle) &&
+          fs->release_modified_count)
+      {
+        handle->buffer = rtems_rfs_scan_chain (&fs->release_modified,
+                                               &fs->release_modified_count,
+                                               block);
+        /*
+         * If we found a buffer retain the dirty buffer state.
+         */
+        if (rtems_rfs_buffer_handle_has_block (handle))
+          rtems_rfs_buffer_mark_dirty (handle);
+      }
     }
-  }
 
-  /*
-   * If not located we request the buffer from the I/O layer.
-   */
-  if (!rtems_rfs_buffer_handle_has_block (handle))
-  {
-    rc = rtems_rfs_buffer_io_request (fs, block, read, &handle->buffer);
+    if (rtems_rfs_buffer_handle_has_block (handle))
+      break;
 
-    if (rc > 0)
+    /*
+     * If not located we request the buffer from the I/O layer. The I/O layer
+     * gives a block to one user at a time, so a second request of the block
+     * would wait there until the buffer leaves the lists of this file system.
+     * Wait here for the pending request instead and look again.
+     */
+    if (!rtems_rfs_buffer_is_pending (fs, block))
     {
-      if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_HANDLE_REQUEST))
-        printf ("rtems-rfs: buffer-request: block=%" PRIu32 ": bdbuf-%s: %d: %s\n",
-                block, read ? "read" : "get", rc, strerror (rc));
-      return rc;
+      rtems_rfs_buffer* buffer;
+
+      pending.block = block;
+      rtems_chain_append_unprotected (&fs->buffers_pending, &pending.link);
+      rtems_rfs_mutex_unlock (&fs->buffers_lock);
+
+      rc = rtems_rfs_buffer_io_request (fs, block, read, &buffer);
+
+      rtems_rfs_mutex_lock (&fs->buffers_lock);
+      rtems_chain_extract_unprotected (&pending.link);
+      rtems_rfs_condition_broadcast (&fs->buffers_pending_done);
+
+      if (rc > 0)
+      {
+        if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_HANDLE_REQUEST))
+          printf ("rtems-rfs: buffer-request: block=%" PRIu32 ": bdbuf-%s: %d: %s\n",
+                  block, read ? "read" : "get", rc, strerror (rc));
+        return rc;
+      }
+
+      handle->buffer = buffer;
+      rtems_chain_set_off_chain (rtems_rfs_buffer_link(handle));
+      break;
     }
 
-    rtems_chain_set_off_chain (rtems_rfs_buffer_link(handle));
+    rtems_rfs_condition_wait (&fs->buffers_pending_done, &fs->buffers_lock);
   }
 
   /*
@@ -197,9 +264,9 @@ rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
   return 0;
 }
 
-int
-rtems_rfs_buffer_handle_release (rtems_rfs_file_system*   fs,
-                                 rtems_rfs_buffer_handle* handle)
+static int
+rtems_rfs_buffer_handle_release_unprotected (rtems_rfs_file_system*   fs,
+                                             rtems_rfs_buffer_handle* handle)
 {
   int rc = 0;
 
@@ -285,6 +352,32 @@ rtems_rfs_buffer_handle_release (rtems_rfs_file_system*   fs,
   return rc;
 }
 
+int
+rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
+                                 rtems_rfs_buffer_handle* handle,
+                                 rtems_rfs_buffer_block   block,
+                                 bool                     read)
+{
+  int rc;
+
+  rtems_rfs_mutex_lock (&fs->buffers_lock);
+  rc = rtems_rfs_buffer_handle_request_locked (fs, handle, block, read);
+  rtems_rfs_mutex_unlock (&fs->buffers_lock);
+  return rc;
+}
+
+int
+rtems_rfs_buffer_handle_release (rtems_rfs_file_system*   fs,
+                                 rtems_rfs_buffer_handle* handle)
+{
+  int rc;
+
+  rtems_rfs_mutex_lock (&fs->buffers_lock);
+  rc = rtems_rfs_buffer_handle_release_unprotected (fs, handle);
+  rtems_rfs_mutex_unlock (&fs->buffers_lock);
+  return rc;
+}
+
 int
 rtems_rfs_buffer_open (const char* name, rtems_rfs_file_system* fs)
 {
@@ -343,7 +436,8 @@ rtems_rfs_buffer_open (const char* name, rtems_rfs_file_system* fs)
             rtems_rfs_fs_media_blocks (fs),
             rtems_rfs_fs_media_block_size (fs));
 
-  return 0;
+  rtems_rfs_condition_create (&fs->buffers_pending_done);
+  return rtems_rfs_mutex_create (&fs->buffers_lock);
 }
 
 int
@@ -372,6 +466,9 @@ rtems_rfs_buffer_close (rtems_rfs_file_system* fs)
               rc, strerror (rc));
   }
 
+  rtems_rfs_mutex_destroy (&fs->buffers_lock);
+  rtems_rfs_condition_destroy (&fs->buffers_pending_done);
+
   return rc;
 }
 
@@ -462,8 +559,8 @@ rtems_rfs_release_chain (rtems_chain_control* chain,
   return rrc;
 }
 
-int
-rtems_rfs_buffers_release (rtems_rfs_file_system* fs)
+static int
+rtems_rfs_buffers_release_unprotected (rtems_rfs_file_system* fs)
 {
   int rrc = 0;
   int rc;
@@ -486,3 +583,14 @@ rtems_rfs_buffers_release (rtems_rfs_file_system* fs)
 
   return rrc;
 }
+
+int
+rtems_rfs_buffers_release (rtems_rfs_file_system* fs)
+{
+  int rc;
+
+  rtems_rfs_mutex_lock (&fs->buffers_lock);
+  rc = rtems_rfs_buffers_release_unprotected (fs);
+  rtems_rfs_mutex_unlock (&fs->buffers_lock);
+  return rc;
+}
@@ -46,6 +46,487 @@
   (((_l) <= RTEMS_RFS_DIR_ENTRY_SIZE) || ((_l) >= rtems_rfs_fs_max_name (_f)) \
    || (_i < RTEMS_RFS_ROOT_INO) || (_i > rtems_rfs_fs_inodes (_f)))
 
+/**
+ * Return the table entry of the index for a slot.
+ */
+#define rtems_rfs_dir_index_slot(_i, _s) \
+  rtems_rfs_read_u16 ((_i) + RTEMS_RFS_DIR_INDEX_OFFSET_TABLE + \
+                      ((_s) * RTEMS_RFS_DIR_INDEX_SLOT_SIZE))
+
+/**
+ * Set the table entry of the index for a slot.
+ */
+#define rtems_rfs_dir_index_set_slot(_i, _s, _b) \
+  rtems_rfs_write_u16 ((_i) + RTEMS_RFS_DIR_INDEX_OFFSET_TABLE + \
+                       ((_s) * RTEMS_RFS_DIR_INDEX_SLOT_SIZE), _b)
+
+/**
+ * The largest directory block number an index table entry can hold.
+ */
+#define RTEMS_RFS_DIR_INDEX_MAX_BLOCK (0xffff)
+
+/**
+ * Does the directory have a hashed index ?
+ */
+static bool
+rtems_rfs_dir_indexed (rtems_rfs_inode_handle* dir)
+{
+  return (rtems_rfs_inode_get_flags (dir) & RTEMS_RFS_INODE_FLAG_DIR_INDEX) != 0;
+}
+
+/**
+ * The maximum depth of the index table that fits into a block.
+ */
+static uint32_t
+rtems_rfs_dir_index_max_depth (rtems_rfs_file_system* fs)
+{
+  uint32_t slots;
+  uint32_t depth = 0;
+
+  slots = (rtems_rfs_fs_block_size (fs) - RTEMS_RFS_DIR_INDEX_OFFSET_TABLE) /
+    RTEMS_RFS_DIR_INDEX_SLOT_SIZE;
+
+  while ((2U << depth) <= slots)
+    ++depth;
+
+  return depth;
+}
+
+/**
+ * Find the file system block of a directory block and make it the current
+ * position of the map.
+ */
+static int
+rtems_rfs_dir_index_find (rtems_rfs_file_system* fs,
+                          rtems_rfs_block_map*   map,
+                          rtems_rfs_block_no     bno,
+                          rtems_rfs_block_no*    block)
+{
+  rtems_rfs_block_pos bpos;
+
+  bpos.bno = bno;
+  bpos.boff = 0;
+  bpos.block = 0;
+
+  return rtems_rfs_block_map_find (fs, map, &bpos, block);
+}
+
+/**
+ * Load the index block of an indexed directory and check it.
+ */
+static int
+rtems_rfs_dir_index_load (rtems_rfs_file_system*   fs,
+                          rtems_rfs_block_map*     map,
+                          rtems_rfs_buffer_handle* handle,
+                          uint8_t**                index,
+                          uint32_t*                depth)
+{
+  rtems_rfs_block_no block;
+  int                rc;
+
+  rc = rtems_rfs_dir_index_find (fs, map, 0, &block);
+  if (rc > 0)
+    return rc;
+
+  rc = rtems_rfs_buffer_handle_request (fs, handle, block, true);
+  if (rc > 0)
+    return rc;
+
+  *index = rtems_rfs_buffer_data (handle);
+  *depth = rtems_rfs_read_u32 (*index + RTEMS_RFS_DIR_INDEX_OFFSET_DEPTH);
+
+  if ((rtems_rfs_read_u32 (*index + RTEMS_RFS_DIR_INDEX_OFFSET_MAGIC) !=
+       RTEMS_RFS_DIR_INDEX_MAGIC) ||
+      (*depth > rtems_rfs_dir_index_max_depth (fs)))
+  {
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+      printf ("rtems-rfs: dir-index: bad index block for ino %" PRIu32 "\n",
+              rtems_rfs_inode_ino (map->inode));
+    return EIO;
+  }
+
+  return 0;
+}
+
+/**
+ * Find the directory block of an indexed directory that holds the entries
+ * with the hash. The map is positioned on the block.
+ */
+static int
+rtems_rfs_dir_index_lookup (rtems_rfs_file_system*   fs,
+                            rtems_rfs_block_map*     map,
+                            rtems_rfs_buffer_handle* handle,
+                            uint32_t                 hash,
+                            rtems_rfs_block_no*      block)
+{
+  uint8_t*           index;
+  uint32_t           depth;
+  rtems_rfs_block_no bno;
+  int                rc;
+
+  rc = rtems_rfs_dir_index_load (fs, map, handle, &index, &depth);
+  if (rc > 0)
+    return rc;
+
+  bno = rtems_rfs_dir_index_slot (index, hash & ((1U << depth) - 1));
+  if ((bno == 0) || (bno >= rtems_rfs_block_map_count (map)))
+    return EIO;
+
+  return rtems_rfs_dir_index_find (fs, map, bno, block);
+}
+
+/**
+ * Add a directory block to the map and initialise it to ones.
+ */
+static int
+rtems_rfs_dir_index_grow (rtems_rfs_file_system*   fs,
+                          rtems_rfs_block_map*     map,
+                          rtems_rfs_buffer_handle* handle)
+{
+  rtems_rfs_block_no block;
+  int                rc;
+
+  rc = rtems_rfs_block_map_grow (fs, map, 1, &block);
+  if (rc > 0)
+    return rc;
+
+  rc = rtems_rfs_buffer_handle_request (fs, handle, block, false);
+  if (rc > 0)
+    return rc;
+
+  memset (rtems_rfs_buffer_data (handle), 0xff, rtems_rfs_fs_block_size (fs));
+  rtems_rfs_buffer_mark_dirty (handle);
+  return 0;
+}
+
+/**
+ * Create the index of an empty directory. The index block is followed by a
+ * single empty directory block all hashes map to.
+ */
+static int
+rtems_rfs_dir_index_create (rtems_rfs_file_system*   fs,
+                            rtems_rfs_block_map*     map,
+                            rtems_rfs_buffer_handle* handle)
+{
+  uint8_t* index;
+  int      rc;
+
+  rc = rtems_rfs_dir_index_grow (fs, map, handle);
+  if (rc > 0)
+    return rc;
+
+  index = rtems_rfs_buffer_data (handle);
+  rtems_rfs_write_u32 (index + RTEMS_RFS_DIR_INDEX_OFFSET_MAGIC,
+                       RTEMS_RFS_DIR_INDEX_MAGIC);
+  rtems_rfs_write_u32 (index + RTEMS_RFS_DIR_INDEX_OFFSET_DEPTH, 0);
+  rtems_rfs_dir_index_set_slot (index, 0, 1);
+
+  return rtems_rfs_dir_index_grow (fs, map, handle);
+}
+
+/**
+ * Add an entry to a directory block if there is space.
+ *
+ * @retval 0 The entry has been added.
+ * @retval ENOSPC The block is full.
+ * @retval EIO The block is corrupt.
+ */
+static int
+rtems_rfs_dir_block_add (rtems_rfs_file_system* fs,
+                         uint8_t*               entry,
+                         const char*            name,
+                         size_t                 length,
+                         uint32_t               hash,
+                         rtems_rfs_ino          ino)
+{
+  int offset = 0;
+
+  while (offset < (rtems_rfs_fs_block_size (fs) - RTEMS_RFS_DIR_ENTRY_SIZE))
+  {
+    rtems_rfs_ino eino;
+    int           elength;
+
+    elength = rtems_rfs_dir_entry_length (entry);
+    eino    = rtems_rfs_dir_entry_ino (entry);
+
+    if (elength == RTEMS_RFS_DIR_ENTRY_EMPTY)
+    {
+      if ((length + RTEMS_RFS_DIR_ENTRY_SIZE) <
+          (rtems_rfs_fs_block_size (fs) - offset))
+      {
+        rtems_rfs_dir_set_entry_hash (entry, hash);
+        rtems_rfs_dir_set_entry_ino (entry, ino);
+        rtems_rfs_dir_set_entry_length (entry,
+                                        RTEMS_RFS_DIR_ENTRY_SIZE + length);
+        memcpy (entry + RTEMS_RFS_DIR_ENTRY_SIZE, name, length);
+        return 0;
+      }
+
+      return ENOSPC;
+    }
+
+    if (rtems_rfs_dir_entry_valid (fs, elength, eino))
+      return EIO;
+
+    entry  += elength;
+    offset += elength;
+  }
+
+  return ENOSPC;
+}
+
+/**
+ * Split the full directory block the hash maps to. The index table is doubled
+ * if the block is referenced by a single table entry. A new directory block
+ * is added and the entries of the full block with the next hash bit set are
+ * moved to it.
+ *
+ * @retval 0 The block has been split.
+ * @retval ENOSPC The index cannot grow any further.
+ */
+static int
+rtems_rfs_dir_index_split (rtems_rfs_file_system*   fs,
+                           rtems_rfs_block_map*     map,
+                           rtems_rfs_buffer_handle* index_buffer,
+                           rtems_rfs_buffer_handle* leaf_buffer,
+                           rtems_rfs_buffer_handle* new_buffer,
+                           uint32_t                 hash)
+{
+  rtems_rfs_block_no block;
+  rtems_rfs_block_no leaf;
+  rtems_rfs_block_no new_leaf;
+  uint8_t*           index;
+  uint8_t*           entry;
+  uint8_t*           new_entry;
+  uint32_t           depth;
+  uint32_t           local_depth;
+  uint32_t           refs;
+  uint32_t           slot;
+  uint32_t           bit;
+  int                offset;
+  int                rc;
+
+  rc = rtems_rfs_dir_index_load (fs, map, index_buffer, &index, &depth);
+  if (rc > 0)
+    return rc;
+
+  leaf = rtems_rfs_dir_index_slot (index, hash & ((1U << depth) - 1));
+
+  /*
+   * The number of table entries referencing the block gives the number of
+   * hash bits all entries in the block have in common.
+   */
+  refs = 0;
+  for (slot = 0; slot < (1U << depth); ++slot)
+    if (rtems_rfs_dir_index_slot (index, slot) == leaf)
+      ++refs;
+
+  local_depth = depth;
+  while (refs > 1)
+  {
+    --local_depth;
+    refs >>= 1;
+  }
+
+  if ((local_depth == depth) &&
+      (depth == rtems_rfs_dir_index_max_depth (fs)))
+    return ENOSPC;
+
+  if (rtems_rfs_block_map_count (map) > RTEMS_RFS_DIR_INDEX_MAX_BLOCK)
+    return ENOSPC;
+
+  rc = rtems_rfs_dir_index_grow (fs, map, new_buffer);
+  if (rc > 0)
+    return rc;
+
+  new_leaf = rtems_rfs_block_map_count (map) - 1;
+
+  if (local_depth == depth)
+  {
+    for (slot = 0; slot < (1U << depth); ++slot)
+      rtems_rfs_dir_index_set_slot (index, slot + (1U << depth),
+                                    rtems_rfs_dir_index_slot (index, slot));
+    ++depth;
+    rtems_rfs_write_u32 (index + RTEMS_RFS_DIR_INDEX_OFFSET_DEPTH, depth);
+  }
+
+  bit = 1U << local_depth;
+
+  for (slot = 0; slot < (1U << depth); ++slot)
+    if ((rtems_rfs_dir_index_slot (index, slot) == leaf) && ((slot & bit) != 0))
+      rtems_rfs_dir_index_set_slot (index, slot, new_leaf);
+
+  rtems_rfs_buffer_mark_dirty (index_buffer);
+
+  rc = rtems_rfs_dir_index_find (fs, map, leaf, &block);
+  if (rc > 0)
+    return rc;
+
+  rc = rtems_rfs_buffer_handle_request (fs, leaf_buffer, block, true);
+  if (rc > 0)
+    return rc;
+
+  /*
+   * Move the entries with the bit set to the new block and compact the
+   * remaining entries.
+   */
+  entry = rtems_rfs_buffer_data (leaf_buffer);
+  new_entry = rtems_rfs_buffer_data (new_buffer);
+  offset = 0;
+
+  while (offset < (rtems_rfs_fs_block_size (fs) - RTEMS_RFS_DIR_ENTRY_SIZE))
+  {
+    rtems_rfs_ino eino;
+    int           elength;
+
+    elength = rtems_rfs_dir_entry_length (entry);
+    eino    = rtems_rfs_dir_entry_ino (entry);
+
+    if (elength == RTEMS_RFS_DIR_ENTRY_EMPTY)
+      break;
+
+    if (rtems_rfs_dir_entry_valid (fs, elength, eino))
+      return EIO;
+
+    if ((rtems_rfs_dir_entry_hash (entry) & bit) != 0)
+    {
+      uint32_t remaining;
+      memcpy (new_entry, entry, elength);
+      new_entry += elength;
+      remaining = rtems_rfs_fs_block_size (fs) - (offset + elength);
+      memmove (entry, entry + elength, remaining);
+      memset (entry + remaining, 0xff, elength);
+    }
+    else
+    {
+      entry  += elength;
+      offset += elength;
+    }
+  }
+
+  rtems_rfs_buffer_mark_dirty (leaf_buffer);
+  rtems_rfs_buffer_mark_dirty (new_buffer);
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+    printf ("rtems-rfs: dir-index: split ino %" PRIu32 ": bno=%" PRIu32
+            " new=%" PRIu32 " depth=%" PRIu32 "\n",
+            rtems_rfs_inode_ino (map->inode), leaf, new_leaf, depth);
+
+  return 0;
+}
+
+/**
+ * Convert an indexed directory into a plain directory. The index block is
+ * cleared which makes it an empty directory block.
+ */
+static int
+rtems_rfs_dir_index_remove (rtems_rfs_file_system*   fs,
+                            rtems_rfs_inode_handle*  dir,
+                            rtems_rfs_block_map*     map,
+                            rtems_rfs_buffer_handle* handle)
+{
+  rtems_rfs_block_no block;
+  int                rc;
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+    printf ("rtems-rfs: dir-index: remove index of ino %" PRIu32 "\n",
+            rtems_rfs_inode_ino (dir));
+
+  rc = rtems_rfs_dir_index_find (fs, map, 0, &block);
+  if (rc > 0)
+    return rc;
+
+  rc = rtems_rfs_buffer_handle_request (fs, handle, block, true);
+  if (rc > 0)
+    return rc;
+
+  memset (rtems_rfs_buffer_data (handle), 0xff, rtems_rfs_fs_block_size (fs));
+  rtems_rfs_buffer_mark_dirty (handle);
+
+  rtems_rfs_inode_set_flags (dir, rtems_rfs_inode_get_flags (dir) &
+                             ~RTEMS_RFS_INODE_FLAG_DIR_INDEX);
+  return 0;
+}
+
+/**
+ * Add an entry to an indexed directory. Full directory blocks are split until
+ * the entry fits. If the index cannot grow any further the index is removed
+ * and ENOSPC is returned so the caller adds the entry to the plain directory.
+ */
+static int
+rtems_rfs_dir_index_add_entry (rtems_rfs_file_system*  fs,
+                               rtems_rfs_inode_handle* dir,
+                               rtems_rfs_block_map*    map,
+                               const char*             name,
+                               size_t                  length,
+                               rtems_rfs_ino           ino)
+{
+  rtems_rfs_buffer_handle index_buffer;
+  rtems_rfs_buffer_handle leaf_buffer;
+  rtems_rfs_buffer_handle new_buffer;
+  uint32_t                hash;
+  int                     rc;
+
+  hash = rtems_rfs_dir_hash (name, length);
+
+  rc = rtems_rfs_buffer_handle_open (fs, &index_buffer);
+  if (rc > 0)
+    return rc;
+  rc = rtems_rfs_buffer_handle_open (fs, &leaf_buffer);
+  if (rc > 0)
+  {
+    rtems_rfs_buffer_handle_close (fs, &index_buffer);
+    return rc;
+  }
+  rc = rtems_rfs_buffer_handle_open (fs, &new_buffer);
+  if (rc > 0)
+  {
+    rtems_rfs_buffer_handle_close (fs, &leaf_buffer);
+    rtems_rfs_buffer_handle_close (fs, &index_buffer);
+    return rc;
+  }
+
+  if (rtems_rfs_block_map_count (map) == 0)
+    rc = rtems_rfs_dir_index_create (fs, map, &index_buffer);
+
+  while (rc == 0)
+  {
+    rtems_rfs_block_no block;
+
+    rc = rtems_rfs_dir_index_lookup (fs, map, &index_buffer, hash, &block);
+    if (rc > 0)
+      break;
+
+    rc = rtems_rfs_buffer_handle_request (fs, &leaf_buffer, block, true);
+    if (rc > 0)
+      break;
+
+    rc = rtems_rfs_dir_block_add (fs, rtems_rfs_buffer_data (&leaf_buffer),
+                                  name, length, hash, ino);
+    if (rc == 0)
+    {
+      rtems_rfs_buffer_mark_dirty (&leaf_buffer);
+      break;
+    }
+
+    if (rc == ENOSPC)
+      rc = rtems_rfs_dir_index_split (fs, map, &index_buffer, &leaf_buffer,
+                                      &new_buffer, hash);
+  }
+
+  if (rc == ENOSPC)
+  {
+    rc = rtems_rfs_dir_index_remove (fs, dir, map, &index_buffer);
+    if (rc == 0)
+      rc = ENOSPC;
+  }
+
+  rtems_rfs_buffer_handle_close (fs, &new_buffer);
+  rtems_rfs_buffer_handle_close (fs, &leaf_buffer);
+  rtems_rfs_buffer_handle_close (fs, &index_buffer);
+  return rc;
+}
+
 int
 rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
                           rtems_rfs_inode_handle* inode,
@@ -101,9 +582,13 @@ rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
 
     /*
      * Locate the first block. The map points to the start after open so just
-     * seek 0. If an error the block will be 0.
+     * seek 0. If an error the block will be 0. An indexed directory only has
+     * the block the hash maps to.
      */
-    rc = rtems_rfs_block_map_seek (fs, &map, 0, &block);
+    if (rtems_rfs_dir_indexed (inode))
+      rc = rtems_rfs_dir_index_lookup (fs, &map, &entries, hash, &block);
+    else
+      rc = rtems_rfs_block_map_seek (fs, &map, 0, &block);
     if (rc > 0)
     {
       if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO))
@@ -192,6 +677,9 @@ rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
         entry += elength;
       }
 
+      if ((rc == 0) && rtems_rfs_dir_indexed (inode))
+        rc = ENOENT;
+
       if (rc == 0)
       {
         rc = rtems_rfs_block_map_next_block (fs, &map, &block);
@@ -247,6 +735,24 @@ rtems_rfs_dir_add_entry (rtems_rfs_file_system*  fs,
   if (rc > 0)
     return rc;
 
+  /*
+   * If the index cannot hold the entry the directory has been converted to a
+   * plain directory so fall through and search it.
+   */
+  if (rtems_rfs_dir_indexed (dir))
+  {
+    rc = rtems_rfs_dir_index_add_entry (fs, dir, &map, name, length, ino);
+    if (rc != ENOSPC)
+    {
+      if ((rc > 0) && rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_ADD_ENTRY))
+        printf ("rtems-rfs: dir-add-entry: "
+                "index add failed for ino %" PRIu32 ": %d: %s\n",
+                rtems_rfs_inode_ino (dir), rc, strerror (rc));
+      rtems_rfs_block_map_close (fs, &map);
+      return rc;
+    }
+  }
+
   rc = rtems_rfs_buffer_handle_open (fs, &buffer);
   if (rc > 0)
   {
@@ -378,6 +884,7 @@ rtems_rfs_dir_del_entry (rtems_rfs_file_system*  fs,
   rtems_rfs_block_no      block;
   rtems_rfs_buffer_handle buffer;
   bool                    search;
+  bool                    indexed;
   int                     rc;
 
   if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_DEL_ENTRY))
@@ -388,6 +895,16 @@ rtems_rfs_dir_del_entry (rtems_rfs_file_system*  fs,
   if (rc > 0)
     return rc;
 
+  /*
+   * Only search if the offset is 0 else we are at that position. The search
+   * of an indexed directory starts after the index block.
+   */
+  search = offset ? false : true;
+  indexed = rtems_rfs_dir_indexed (dir);
+
+  if (search && indexed)
+    offset = rtems_rfs_fs_block_size (fs);
+
   rc = rtems_rfs_block_map_seek (fs, &map, offset, &block);
   if (rc > 0)
   {
@@ -404,11 +921,6 @@ rtems_rfs_dir_del_entry (rtems_rfs_file_system*  fs,
     return rc;
   }
 
-  /*
-   * Only search if the offset is 0 else we are at that position.
-   */
-  search = offset ? false : true;
-
   while (rc == 0)
   {
     uint8_t* entry;
@@ -466,7 +978,9 @@ rtems_rfs_dir_del_entry (rtems_rfs_file_system*  fs,
 
         /*
          * If the remainder of the block is empty and this is the start of the
-         * block and it is the last block in the map shrink the map.
+         * block and it is the last block in the map shrink the map. The
+         * blocks of an indexed directory are referenced by the index so
+         * they are kept.
          *
          * @note We could check again to see if the new end block in the map is
          *       also empty. This way we could clean up an empty directory.
@@ -480,7 +994,7 @@ rtems_rfs_dir_del_entry (rtems_rfs_file_system*  fs,
                   ino, elength, block, eoffset,
                   rtems_rfs_block_map_last (&map) ? "yes" : "no");
 
-        if ((elength == RTEMS_RFS_DIR_ENTRY_EMPTY) &&
+        if (!indexed && (elength == RTEMS_RFS_DIR_ENTRY_EMPTY) &&
             (eoffset == 0) && rtems_rfs_block_map_last (&map))
         {
           rc = rtems_rfs_block_map_shrink (fs, &map, 1);
@@ -544,6 +1058,15 @@ rtems_rfs_dir_read (rtems_rfs_file_system*  fs,
   if (rc > 0)
     return rc;
 
+  /*
+   * Skip the index block of an indexed directory.
+   */
+  if (rtems_rfs_dir_indexed (dir) && (offset < rtems_rfs_fs_block_size (fs)))
+  {
+    *length = rtems_rfs_fs_block_size (fs) - offset;
+    offset = rtems_rfs_fs_block_size (fs);
+  }
+
   if (((rtems_rfs_fs_block_size (fs) -
         (offset % rtems_rfs_fs_block_size (fs))) <= RTEMS_RFS_DIR_ENTRY_SIZE))
     offset = (((offset / rtems_rfs_fs_block_size (fs)) + 1) *
@@ -664,7 +1187,13 @@ rtems_rfs_dir_empty (rtems_rfs_file_system*  fs,
   if (rc > 0)
     return rc;
 
-  rc = rtems_rfs_block_map_seek (fs, &map, 0, &block);
+  /*
+   * The entries of an indexed directory start after the index block.
+   */
+  rc = rtems_rfs_block_map_seek (fs, &map,
+                                 rtems_rfs_dir_indexed (dir) ?
+                                 rtems_rfs_fs_block_size (fs) : 0,
+                                 &block);
   if (rc > 0)
   {
     rtems_rfs_block_map_close (fs, &map);
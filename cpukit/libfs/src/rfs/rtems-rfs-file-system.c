@@ -103,6 +103,19 @@ rtems_rfs_fs_read_superblock (rtems_rfs_file_system* fs)
     return EIO;
   }
 
+  if ((read_sb (RTEMS_RFS_SB_OFFSET_VERSION) & ~RTEMS_RFS_VERSION_MASK) &
+      ~RTEMS_RFS_VERSION_FEATURES)
+  {
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_OPEN))
+      printf ("rtems-rfs: read-superblock: unsupported features: %08" PRIx32 "\n",
+              read_sb (RTEMS_RFS_SB_OFFSET_VERSION));
+    rtems_rfs_buffer_handle_close (fs, &handle);
+    return EIO;
+  }
+
+  if (read_sb (RTEMS_RFS_SB_OFFSET_VERSION) & RTEMS_RFS_VERSION_DIR_INDEX)
+    fs->flags |= RTEMS_RFS_FS_DIR_INDEX;
+
   if (read_sb (RTEMS_RFS_SB_OFFSET_INODE_SIZE) != RTEMS_RFS_INODE_SIZE)
   {
     if (rtems_rfs_trace (RTEMS_RFS_TRACE_OPEN))
@@ -223,6 +236,7 @@ rtems_rfs_fs_open (const char*             name,
 
   (*fs)->user = user;
   rtems_chain_initialize_empty (&(*fs)->buffers);
+  rtems_chain_initialize_empty (&(*fs)->buffers_pending);
   rtems_chain_initialize_empty (&(*fs)->release);
   rtems_chain_initialize_empty (&(*fs)->release_modified);
   rtems_chain_initialize_empty (&(*fs)->file_shares);
@@ -314,6 +328,8 @@ rtems_rfs_fs_close (rtems_rfs_file_system* fs)
   if (rtems_rfs_trace (RTEMS_RFS_TRACE_CLOSE))
     printf ("rtems-rfs: close\n");
 
+  rtems_rfs_inode_cache_close (fs);
+
   for (group = 0; group < fs->group_count; group++)
     rtems_rfs_group_close (fs, &fs->groups[group]);
 
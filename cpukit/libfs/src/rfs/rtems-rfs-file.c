@@ -117,6 +117,17 @@ rtems_rfs_file_open (rtems_rfs_file_system*  fs,
       return rc;
     }
 
+    rc = rtems_rfs_mutex_create (&shared->lock);
+    if (rc > 0)
+    {
+      rtems_rfs_block_map_close (fs, &shared->map);
+      rtems_rfs_inode_close (fs, &shared->inode);
+      free (shared);
+      rtems_rfs_buffer_handle_close (fs, &handle->buffer);
+      free (handle);
+      return rc;
+    }
+
     shared->references = 1;
     shared->size.count = rtems_rfs_inode_get_block_count (&shared->inode);
     shared->size.offset = rtems_rfs_inode_get_block_offset (&shared->inode);
@@ -200,6 +211,7 @@ rtems_rfs_file_close (rtems_rfs_file_system* fs,
     }
 
     rtems_chain_extract_unprotected (&handle->shared->link);
+    rtems_rfs_mutex_destroy (&handle->shared->lock);
     free (handle->shared);
   }
 
@@ -218,6 +230,25 @@ rtems_rfs_file_close (rtems_rfs_file_system* fs,
   return rrc;
 }
 
+/**
+ * Return the number of blocks a write of the size from the current position
+ * of the handle covers plus the number of blocks the file system reserves for
+ * files.
+ */
+static size_t
+rtems_rfs_file_write_blocks (rtems_rfs_file_handle* handle,
+                             size_t                 size)
+{
+  rtems_rfs_file_system* fs = rtems_rfs_file_fs (handle);
+  size_t                 block_size = rtems_rfs_fs_block_size (fs);
+  size_t                 blocks;
+
+  blocks = (rtems_rfs_file_block_offset (handle) + size + block_size - 1) /
+    block_size;
+
+  return blocks + fs->file_reserve_blocks;
+}
+
 int
 rtems_rfs_file_io_start (rtems_rfs_file_handle* handle,
                          size_t*                available,
@@ -258,6 +289,18 @@ rtems_rfs_file_io_start (rtems_rfs_file_handle* handle,
       if (rtems_rfs_trace (RTEMS_RFS_TRACE_FILE_IO))
         printf ("rtems-rfs: file-io: start: grow\n");
 
+      /*
+       * Reserve a run of blocks for the rest of the write so the blocks of a
+       * write that spans more than a block are contiguous. The map takes the
+       * blocks from the reserved run as the write proceeds.
+       */
+      rc = rtems_rfs_block_map_reserve (rtems_rfs_file_fs (handle),
+                                        rtems_rfs_file_map (handle),
+                                        rtems_rfs_file_write_blocks (handle,
+                                                                     *available));
+      if (rc > 0)
+        return rc;
+
       rc = rtems_rfs_block_map_grow (rtems_rfs_file_fs (handle),
                                      rtems_rfs_file_map (handle),
                                      1, &block);
@@ -511,6 +554,15 @@ rtems_rfs_file_set_size (rtems_rfs_file_handle* handle,
         length = rtems_rfs_fs_block_size (rtems_rfs_file_fs (handle));
         read_block = false;
 
+        if (((new_size + length - 1) / length) > rtems_rfs_block_map_count (map))
+        {
+          rc = rtems_rfs_block_map_reserve (rtems_rfs_file_fs (handle), map,
+                                            ((new_size + length - 1) / length) -
+                                            rtems_rfs_block_map_count (map));
+          if (rc > 0)
+            return rc;
+        }
+
         while (count)
         {
           rtems_rfs_buffer_block block;
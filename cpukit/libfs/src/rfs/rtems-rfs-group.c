@@ -116,7 +116,7 @@ rtems_rfs_group_open (rtems_rfs_file_system* fs,
     rtems_rfs_bitmap_release_buffer (fs, &group->inode_bitmap);
   }
 
-  return 0;
+  return rtems_rfs_mutex_create (&group->lock);
 }
 
 int
@@ -143,17 +143,27 @@ rtems_rfs_group_close (rtems_rfs_file_system* fs, rtems_rfs_group* group)
   if (rc > 0)
     result = rc;
   rc = rtems_rfs_buffer_handle_close (fs, &group->block_bitmap_buffer);
+  if (rc > 0)
+    result = rc;
+  rc = rtems_rfs_mutex_destroy (&group->lock);
   if (rc > 0)
     result = rc;
 
   return result;
 }
 
-int
-rtems_rfs_group_bitmap_alloc (rtems_rfs_file_system* fs,
-                              rtems_rfs_bitmap_bit   goal,
-                              bool                   inode,
-                              rtems_rfs_bitmap_bit*  result)
+/**
+ * Allocate a run of inodes or blocks. The run is allocated from a single
+ * group and is shorter than the number wanted if the group has no run of that
+ * length near the goal.
+ */
+static int
+rtems_rfs_group_bitmap_alloc_bits (rtems_rfs_file_system* fs,
+                                   rtems_rfs_bitmap_bit   goal,
+                                   bool                   inode,
+                                   size_t                 wanted,
+                                   rtems_rfs_bitmap_bit*  result,
+                                   size_t*                count)
 {
   int                  group_start;
   size_t               size;
@@ -194,7 +204,6 @@ rtems_rfs_group_bitmap_alloc (rtems_rfs_file_system* fs,
   {
     rtems_rfs_bitmap_control* bitmap;
     int                       group;
-    bool                      allocated = false;
     int                       rc;
 
     /*
@@ -224,22 +233,29 @@ rtems_rfs_group_bitmap_alloc (rtems_rfs_file_system* fs,
     else
       bitmap = &fs->groups[group].block_bitmap;
 
-    rc = rtems_rfs_bitmap_map_alloc (bitmap, bit, &allocated, &bit);
+    rtems_rfs_mutex_lock (&fs->groups[group].lock);
+
+    rc = rtems_rfs_bitmap_map_alloc_run (bitmap, bit, wanted, count, &bit);
     if (rc > 0)
+    {
+      rtems_rfs_mutex_unlock (&fs->groups[group].lock);
       return rc;
+    }
 
     if (rtems_rfs_fs_release_bitmaps (fs))
       rtems_rfs_bitmap_release_buffer (fs, bitmap);
 
-    if (allocated)
+    rtems_rfs_mutex_unlock (&fs->groups[group].lock);
+
+    if (*count > 0)
     {
       if (inode)
         *result = rtems_rfs_group_inode (fs, group, bit);
       else
         *result = rtems_rfs_group_block (&fs->groups[group], bit);
       if (rtems_rfs_trace (RTEMS_RFS_TRACE_GROUP_BITMAPS))
-        printf ("rtems-rfs: group-bitmap-alloc: %s allocated: %" PRId32 "\n",
-                inode ? "inode" : "block", *result);
+        printf ("rtems-rfs: group-bitmap-alloc: %s allocated: %" PRId32
+                " count=%zu\n", inode ? "inode" : "block", *result, *count);
       return 0;
     }
 
@@ -269,6 +285,27 @@ rtems_rfs_group_bitmap_alloc (rtems_rfs_file_system* fs,
   return ENOSPC;
 }
 
+int
+rtems_rfs_group_bitmap_alloc (rtems_rfs_file_system* fs,
+                              rtems_rfs_bitmap_bit   goal,
+                              bool                   inode,
+                              rtems_rfs_bitmap_bit*  result)
+{
+  size_t count;
+  return rtems_rfs_group_bitmap_alloc_bits (fs, goal, inode, 1, result, &count);
+}
+
+int
+rtems_rfs_group_bitmap_alloc_run (rtems_rfs_file_system* fs,
+                                  rtems_rfs_bitmap_bit   goal,
+                                  size_t                 wanted,
+                                  rtems_rfs_bitmap_bit*  result,
+                                  size_t*                count)
+{
+  return rtems_rfs_group_bitmap_alloc_bits (fs, goal, false, wanted,
+                                            result, count);
+}
+
 int
 rtems_rfs_group_bitmap_free (rtems_rfs_file_system* fs,
                              bool                   inode,
@@ -303,10 +340,14 @@ rtems_rfs_group_bitmap_free (rtems_rfs_file_system* fs,
   else
     bitmap = &fs->groups[group].block_bitmap;
 
+  rtems_rfs_mutex_lock (&fs->groups[group].lock);
+
   rc = rtems_rfs_bitmap_map_clear (bitmap, bit);
 
   rtems_rfs_bitmap_release_buffer (fs, bitmap);
 
+  rtems_rfs_mutex_unlock (&fs->groups[group].lock);
+
   return rc;
 }
 
@@ -349,10 +390,14 @@ rtems_rfs_group_bitmap_test (rtems_rfs_file_system* fs,
   else
     bitmap = &fs->groups[group].block_bitmap;
 
+  rtems_rfs_mutex_lock (&fs->groups[group].lock);
+
   rc = rtems_rfs_bitmap_map_test (bitmap, bit, state);
 
   rtems_rfs_bitmap_release_buffer (fs, bitmap);
 
+  rtems_rfs_mutex_unlock (&fs->groups[group].lock);
+
   return rc;
 }
 
@@ -369,12 +414,14 @@ rtems_rfs_group_usage (rtems_rfs_file_system* fs,
   for (g = 0; g < fs->group_count; g++)
   {
     rtems_rfs_group* group = &fs->groups[g];
+    rtems_rfs_mutex_lock (&group->lock);
     *blocks +=
       rtems_rfs_bitmap_map_size(&group->block_bitmap) -
       rtems_rfs_bitmap_map_free (&group->block_bitmap);
     *inodes +=
       rtems_rfs_bitmap_map_size (&group->inode_bitmap) -
       rtems_rfs_bitmap_map_free (&group->inode_bitmap);
+    rtems_rfs_mutex_unlock (&group->lock);
   }
 
   if (*blocks > rtems_rfs_fs_blocks (fs))
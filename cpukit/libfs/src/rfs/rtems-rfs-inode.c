@@ -21,6 +21,7 @@
 #endif
 
 #include <inttypes.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include <rtems/rfs/rtems-rfs-block.h>
@@ -49,6 +50,208 @@ rtems_rfs_inode_free (rtems_rfs_file_system* fs,
   return rtems_rfs_group_bitmap_free (fs, true, bit);
 }
 
+int
+rtems_rfs_inode_cache_open (rtems_rfs_file_system* fs,
+                            uint32_t               size)
+{
+  rtems_rfs_inode_cache* cache = &fs->inode_cache;
+  uint32_t               b;
+
+  rtems_chain_initialize_empty (&cache->lru);
+  cache->lru_count = 0;
+  cache->size = size;
+  cache->bucket_count = 0;
+  cache->buckets = NULL;
+
+  if (size == 0)
+    return 0;
+
+  cache->buckets = malloc (size * sizeof (rtems_chain_control));
+  if (!cache->buckets)
+    return ENOMEM;
+
+  cache->bucket_count = size;
+  for (b = 0; b < cache->bucket_count; b++)
+    rtems_chain_initialize_empty (&cache->buckets[b]);
+
+  return 0;
+}
+
+void
+rtems_rfs_inode_cache_close (rtems_rfs_file_system* fs)
+{
+  rtems_rfs_inode_cache* cache = &fs->inode_cache;
+
+  if (!cache->buckets)
+    return;
+
+  while (!rtems_chain_is_empty (&cache->lru))
+  {
+    rtems_rfs_inode_cache_entry* entry;
+    entry = RTEMS_CONTAINER_OF (rtems_chain_get_unprotected (&cache->lru),
+                                rtems_rfs_inode_cache_entry, lru_link);
+    free (entry);
+  }
+
+  free (cache->buckets);
+  cache->buckets = NULL;
+  cache->bucket_count = 0;
+  cache->lru_count = 0;
+}
+
+/**
+ * Load the inode from the cache reading it from the media if not cached.
+ */
+static int
+rtems_rfs_inode_cache_get (rtems_rfs_file_system*  fs,
+                           rtems_rfs_inode_handle* handle)
+{
+  rtems_rfs_inode_cache*       cache = &fs->inode_cache;
+  rtems_rfs_inode_cache_entry* entry = NULL;
+  rtems_chain_control*         bucket;
+  rtems_chain_node*            node;
+
+  bucket = &cache->buckets[handle->ino % cache->bucket_count];
+
+  node = rtems_chain_first (bucket);
+  while (!rtems_chain_is_tail (bucket, node))
+  {
+    rtems_rfs_inode_cache_entry* candidate;
+    candidate = RTEMS_CONTAINER_OF (node, rtems_rfs_inode_cache_entry,
+                                    hash_link);
+    if (candidate->ino == handle->ino)
+    {
+      entry = candidate;
+      break;
+    }
+    node = rtems_chain_next (node);
+  }
+
+  if (entry)
+  {
+    if (entry->references == 0)
+    {
+      rtems_chain_extract_unprotected (&entry->lru_link);
+      cache->lru_count--;
+    }
+  }
+  else
+  {
+    int rc;
+
+    /*
+     * Reuse the least recently used inode if the cache is full. Inodes loaded
+     * by handles are not counted so the cache grows while all are referenced.
+     */
+    if (cache->lru_count >= cache->size)
+    {
+      entry = RTEMS_CONTAINER_OF (rtems_chain_last (&cache->lru),
+                                  rtems_rfs_inode_cache_entry, lru_link);
+      rtems_chain_extract_unprotected (&entry->lru_link);
+      rtems_chain_extract_unprotected (&entry->hash_link);
+      cache->lru_count--;
+    }
+    else
+    {
+      entry = malloc (sizeof (rtems_rfs_inode_cache_entry));
+      if (!entry)
+        return ENOMEM;
+    }
+
+    rc = rtems_rfs_buffer_handle_request (fs, &handle->buffer,
+                                          handle->block, true);
+    if (rc > 0)
+    {
+      free (entry);
+      return rc;
+    }
+
+    memcpy (&entry->node,
+            ((rtems_rfs_inode*) rtems_rfs_buffer_data (&handle->buffer)) +
+            handle->offset,
+            RTEMS_RFS_INODE_SIZE);
+
+    rc = rtems_rfs_buffer_handle_release (fs, &handle->buffer);
+    if (rc > 0)
+    {
+      free (entry);
+      return rc;
+    }
+
+    entry->ino = handle->ino;
+    entry->references = 0;
+    rtems_chain_prepend_unprotected (bucket, &entry->hash_link);
+  }
+
+  entry->references++;
+  handle->cached = entry;
+  handle->node = &entry->node;
+  handle->buffer.dirty = false;
+  return 0;
+}
+
+/**
+ * Release the cached inode of the handle. A modified inode is written back to
+ * the media.
+ */
+static int
+rtems_rfs_inode_cache_put (rtems_rfs_file_system*  fs,
+                           rtems_rfs_inode_handle* handle)
+{
+  rtems_rfs_inode_cache*       cache = &fs->inode_cache;
+  rtems_rfs_inode_cache_entry* entry = handle->cached;
+  int                          rc = 0;
+
+  if (rtems_rfs_buffer_dirty (&handle->buffer))
+  {
+    rc = rtems_rfs_buffer_handle_request (fs, &handle->buffer,
+                                          handle->block, true);
+    if (rc == 0)
+    {
+      memcpy (((rtems_rfs_inode*) rtems_rfs_buffer_data (&handle->buffer)) +
+              handle->offset,
+              &entry->node,
+              RTEMS_RFS_INODE_SIZE);
+      rtems_rfs_buffer_mark_dirty (&handle->buffer);
+      rc = rtems_rfs_buffer_handle_release (fs, &handle->buffer);
+    }
+    handle->buffer.dirty = false;
+  }
+
+  handle->cached = NULL;
+
+  entry->references--;
+  if (entry->references == 0)
+  {
+    rtems_chain_prepend_unprotected (&cache->lru, &entry->lru_link);
+    cache->lru_count++;
+
+    if (cache->lru_count > cache->size)
+    {
+      entry = RTEMS_CONTAINER_OF (rtems_chain_last (&cache->lru),
+                                  rtems_rfs_inode_cache_entry, lru_link);
+      rtems_chain_extract_unprotected (&entry->lru_link);
+      rtems_chain_extract_unprotected (&entry->hash_link);
+      cache->lru_count--;
+      free (entry);
+    }
+  }
+
+  return rc;
+}
+
+/**
+ * Release the inode of the handle to the cache or the buffer layer.
+ */
+static int
+rtems_rfs_inode_release (rtems_rfs_file_system*  fs,
+                         rtems_rfs_inode_handle* handle)
+{
+  if (handle->cached)
+    return rtems_rfs_inode_cache_put (fs, handle);
+  return rtems_rfs_buffer_handle_release (fs, &handle->buffer);
+}
+
 int
 rtems_rfs_inode_open (rtems_rfs_file_system*  fs,
                       rtems_rfs_ino           ino,
@@ -72,6 +275,7 @@ rtems_rfs_inode_open (rtems_rfs_file_system*  fs,
   handle->ino = ino;
   handle->node = NULL;
   handle->loads = 0;
+  handle->cached = NULL;
 
   gino  = ino - RTEMS_RFS_ROOT_INO;
   group = gino / fs->group_inodes;
@@ -127,13 +331,22 @@ rtems_rfs_inode_load (rtems_rfs_file_system*  fs,
   {
     int rc;
 
-    rc = rtems_rfs_buffer_handle_request (fs,&handle->buffer,
-                                          handle->block, true);
-    if (rc > 0)
-      return rc;
+    if (fs->inode_cache.buckets)
+    {
+      rc = rtems_rfs_inode_cache_get (fs, handle);
+      if (rc > 0)
+        return rc;
+    }
+    else
+    {
+      rc = rtems_rfs_buffer_handle_request (fs,&handle->buffer,
+                                            handle->block, true);
+      if (rc > 0)
+        return rc;
 
-    handle->node = rtems_rfs_buffer_data (&handle->buffer);
-    handle->node += handle->offset;
+      handle->node = rtems_rfs_buffer_data (&handle->buffer);
+      handle->node += handle->offset;
+    }
   }
 
   handle->loads++;
@@ -167,7 +380,7 @@ rtems_rfs_inode_unload (rtems_rfs_file_system*  fs,
        */
       if (rtems_rfs_buffer_dirty (&handle->buffer) && update_ctime)
         rtems_rfs_inode_set_ctime (handle, time (NULL));
-      rc = rtems_rfs_buffer_handle_release (fs, &handle->buffer);
+      rc = rtems_rfs_inode_release (fs, handle);
       handle->node = NULL;
     }
   }
@@ -251,6 +464,9 @@ rtems_rfs_inode_create (rtems_rfs_file_system*  fs,
    */
   if (RTEMS_RFS_S_ISDIR (mode))
   {
+    if (rtems_rfs_fs_dir_index (fs))
+      rtems_rfs_inode_set_flags (&inode, RTEMS_RFS_INODE_FLAG_DIR_INDEX);
+
     rc = rtems_rfs_dir_add_entry (fs, &inode, ".", 1, *ino);
     if (rc == 0)
       rc = rtems_rfs_dir_add_entry (fs, &inode, "..", 2, parent);
@@ -356,7 +572,7 @@ rtems_rfs_inode_delete (rtems_rfs_file_system*  fs,
        * close. Also if the loads is greater then one then other loads
        * active. Forcing the loads count to 0.
        */
-      rc = rtems_rfs_buffer_handle_release (fs, &handle->buffer);
+      rc = rtems_rfs_inode_release (fs, handle);
       handle->loads = 0;
       handle->node = NULL;
       /*
@@ -36,3 +36,21 @@ rtems_rfs_mutex_destroy (rtems_rfs_mutex* mutex)
 #endif
   return 0;
 }
+
+int
+rtems_rfs_condition_create (rtems_rfs_condition* cond)
+{
+#if __rtems__
+  rtems_condition_variable_init(cond, "RFS");
+#endif
+  return 0;
+}
+
+int
+rtems_rfs_condition_destroy (rtems_rfs_condition* cond)
+{
+#if __rtems__
+  rtems_condition_variable_destroy(cond);
+#endif
+  return 0;
+}
@@ -28,6 +28,33 @@
 #include <rtems/rfs/rtems-rfs-file.h>
 #include "rtems-rfs-rtems.h"
 
+/**
+ * Lock the shared data of a file. The data path of a file only needs the lock
+ * of the file's shared data as the buffers and the group bitmaps have their
+ * own locks. Operations that change the namespace or the open files list
+ * still hold the file system lock.
+ *
+ * @param file The file handle.
+ */
+static void
+rtems_rfs_rtems_file_lock (rtems_rfs_file_handle* file)
+{
+  rtems_rfs_mutex_lock (&file->shared->lock);
+}
+
+/**
+ * Unlock the shared data of a file and release any buffers held for the file
+ * system.
+ *
+ * @param file The file handle.
+ */
+static void
+rtems_rfs_rtems_file_unlock (rtems_rfs_file_handle* file)
+{
+  rtems_rfs_buffers_release (rtems_rfs_file_fs (file));
+  rtems_rfs_mutex_unlock (&file->shared->lock);
+}
+
 /**
  * This routine processes the open() system call.  Note that there is nothing
  * special to be done at open() time.
@@ -120,7 +147,7 @@ rtems_rfs_rtems_file_read (rtems_libio_t* iop,
   if (rtems_rfs_rtems_trace (RTEMS_RFS_RTEMS_DEBUG_FILE_READ))
     printf("rtems-rfs: file-read: handle:%p count:%zd\n", file, count);
 
-  rtems_rfs_rtems_lock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_lock (file);
 
   pos = iop->offset;
 
@@ -161,7 +188,7 @@ rtems_rfs_rtems_file_read (rtems_libio_t* iop,
   if (read >= 0)
     iop->offset = pos + read;
 
-  rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_unlock (file);
 
   return read;
 }
@@ -189,7 +216,7 @@ rtems_rfs_rtems_file_write (rtems_libio_t* iop,
   if (rtems_rfs_rtems_trace (RTEMS_RFS_RTEMS_DEBUG_FILE_WRITE))
     printf("rtems-rfs: file-write: handle:%p count:%zd\n", file, count);
 
-  rtems_rfs_rtems_lock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_lock (file);
 
   pos = iop->offset;
   file_size = rtems_rfs_file_size (file);
@@ -203,7 +230,7 @@ rtems_rfs_rtems_file_write (rtems_libio_t* iop,
     rc = rtems_rfs_file_set_size (file, pos);
     if (rc)
     {
-      rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+      rtems_rfs_rtems_file_unlock (file);
       return rtems_rfs_rtems_error ("file-write: write extend", rc);
     }
 
@@ -215,7 +242,7 @@ rtems_rfs_rtems_file_write (rtems_libio_t* iop,
     rc = rtems_rfs_file_seek (file, pos, &pos);
     if (rc)
     {
-      rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+      rtems_rfs_rtems_file_unlock (file);
       return rtems_rfs_rtems_error ("file-write: write append seek", rc);
     }
   }
@@ -257,7 +284,7 @@ rtems_rfs_rtems_file_write (rtems_libio_t* iop,
   if (write >= 0)
     iop->offset = pos + write;
 
-  rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_unlock (file);
 
   return write;
 }
@@ -282,7 +309,7 @@ rtems_rfs_rtems_file_lseek (rtems_libio_t* iop,
   if (rtems_rfs_rtems_trace (RTEMS_RFS_RTEMS_DEBUG_FILE_LSEEK))
     printf("rtems-rfs: file-lseek: handle:%p offset:%" PRIdoff_t "\n", file, offset);
 
-  rtems_rfs_rtems_lock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_lock (file);
 
   old_offset = iop->offset;
   new_offset = rtems_filesystem_default_lseek_file (iop, offset, whence);
@@ -299,7 +326,7 @@ rtems_rfs_rtems_file_lseek (rtems_libio_t* iop,
     }
   }
 
-  rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_unlock (file);
 
   return new_offset;
 }
@@ -321,13 +348,13 @@ rtems_rfs_rtems_file_ftruncate (rtems_libio_t* iop,
   if (rtems_rfs_rtems_trace (RTEMS_RFS_RTEMS_DEBUG_FILE_FTRUNC))
     printf("rtems-rfs: file-ftrunc: handle:%p length:%" PRIdoff_t "\n", file, length);
 
-  rtems_rfs_rtems_lock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_lock (file);
 
   rc = rtems_rfs_file_set_size (file, length);
   if (rc)
     rc = rtems_rfs_rtems_error ("file_ftruncate: set size", rc);
 
-  rtems_rfs_rtems_unlock (rtems_rfs_file_fs (file));
+  rtems_rfs_rtems_file_unlock (file);
 
   return rc;
 }
@@ -350,6 +377,7 @@ const rtems_filesystem_file_handlers_r rtems_rfs_rtems_file_handlers = {
   .fcntl_h     = rtems_filesystem_default_fcntl,
   .kqfilter_h  = rtems_filesystem_default_kqfilter,
   .mmap_h      = rtems_filesystem_default_mmap,
+  .munmap_h    = rtems_filesystem_default_munmap,
   .poll_h      = rtems_filesystem_default_poll,
   .readv_h     = rtems_filesystem_default_readv,
   .writev_h    = rtems_filesystem_default_writev
@@ -102,6 +102,50 @@ static void rtems_rfs_rtems_follow_link(
   }
 }
 
+/**
+ * The directory offset of a cached entry is not known. An offset of 0 lets
+ * the directory entry delete search for the first entry of the inode. This
+ * is the entry of the name only if the inode has no other link in the
+ * directory, so look up the offset of an inode with more than one link.
+ * Directories have no hard links.
+ */
+static int
+rtems_rfs_rtems_cached_doff (rtems_rfs_file_system*  fs,
+                             rtems_rfs_inode_handle* dir,
+                             const char*             name,
+                             size_t                  length,
+                             rtems_rfs_ino           ino,
+                             uint32_t*               doff)
+{
+  rtems_rfs_inode_handle entry;
+  rtems_rfs_ino          entry_ino;
+  uint16_t               links;
+  uint16_t               mode;
+  int                    rc;
+
+  *doff = 0;
+
+  rc = rtems_rfs_inode_open (fs, ino, &entry, true);
+  if (rc > 0)
+    return rc;
+
+  links = rtems_rfs_inode_get_links (&entry);
+  mode = rtems_rfs_inode_get_mode (&entry);
+
+  rc = rtems_rfs_inode_close (fs, &entry);
+  if (rc > 0)
+    return rc;
+
+  if (links > 1 && !S_ISDIR (mode))
+  {
+    rc = rtems_rfs_dir_lookup_ino (fs, dir, name, length, &entry_ino, doff);
+    if (rc == 0 && entry_ino != ino)
+      rc = EIO;
+  }
+
+  return rc;
+}
+
 static rtems_filesystem_eval_path_generic_status
 rtems_rfs_rtems_eval_token(
   rtems_filesystem_eval_path_context_t *ctx,
@@ -124,14 +168,36 @@ rtems_rfs_rtems_eval_token(
       rtems_rfs_file_system* fs = rtems_rfs_rtems_pathloc_dev (currentloc);
       rtems_rfs_ino entry_ino;
       uint32_t entry_doff;
-      int rc = rtems_rfs_dir_lookup_ino (
-        fs,
-        inode,
-        token,
-        tokenlen,
-        &entry_ino,
-        &entry_doff
-      );
+      void* entry_node;
+      int rc;
+
+      switch (rtems_filesystem_name_cache_lookup (currentloc, token, tokenlen,
+                                                  &entry_node)) {
+        case RTEMS_FILESYSTEM_NAME_CACHE_HIT:
+          entry_ino = (rtems_rfs_ino) (intptr_t) entry_node;
+          rc = rtems_rfs_rtems_cached_doff (fs, inode, token, tokenlen,
+                                            entry_ino, &entry_doff);
+          break;
+        case RTEMS_FILESYSTEM_NAME_CACHE_NO_ENTRY:
+          rc = ENOENT;
+          break;
+        default:
+          rc = rtems_rfs_dir_lookup_ino (
+            fs,
+            inode,
+            token,
+            tokenlen,
+            &entry_ino,
+            &entry_doff
+          );
+          if (rc == 0)
+            rtems_filesystem_name_cache_enter (currentloc, token, tokenlen,
+                                               (void*) (intptr_t) entry_ino);
+          else if (rc == ENOENT)
+            rtems_filesystem_name_cache_enter_no_entry (currentloc, token,
+                                                        tokenlen);
+          break;
+      }
 
       if (rc == 0) {
         rc = rtems_rfs_inode_close (fs, inode);
@@ -456,6 +522,11 @@ rtems_rfs_rtems_fstat (const rtems_filesystem_location_info_t* pathloc,
 
   if (shared)
   {
+    /*
+     * The data path of an open file only holds the lock of the shared data.
+     */
+    rtems_rfs_mutex_lock (&shared->lock);
+
     buf->st_atime   = rtems_rfs_file_shared_get_atime (shared);
     buf->st_mtime   = rtems_rfs_file_shared_get_mtime (shared);
     buf->st_ctime   = rtems_rfs_file_shared_get_ctime (shared);
@@ -465,6 +536,8 @@ rtems_rfs_rtems_fstat (const rtems_filesystem_location_info_t* pathloc,
       buf->st_size = rtems_rfs_file_shared_get_block_offset (shared);
     else
       buf->st_size = rtems_rfs_file_shared_get_size (fs, shared);
+
+    rtems_rfs_mutex_unlock (&shared->lock);
   }
   else
   {
@@ -703,6 +776,7 @@ const rtems_filesystem_file_handlers_r rtems_rfs_rtems_link_handlers =
   .fcntl_h     = rtems_filesystem_default_fcntl,
   .kqfilter_h  = rtems_filesystem_default_kqfilter,
   .mmap_h      = rtems_filesystem_default_mmap,
+  .munmap_h    = rtems_filesystem_default_munmap,
   .poll_h      = rtems_filesystem_default_poll,
   .readv_h     = rtems_filesystem_default_readv,
   .writev_h    = rtems_filesystem_default_writev
@@ -754,6 +828,8 @@ rtems_rfs_rtems_initialise (rtems_filesystem_mount_table_entry_t* mt_entry,
   rtems_rfs_file_system*   fs;
   uint32_t                 flags = 0;
   uint32_t                 max_held_buffers = RTEMS_RFS_FS_MAX_HELD_BUFFERS;
+  uint32_t                 inode_cache_size = 0;
+  uint32_t                 file_reserve_blocks = 0;
   const char*              options = data;
   int                      rc;
 
@@ -774,6 +850,16 @@ rtems_rfs_rtems_initialise (rtems_filesystem_mount_table_entry_t* mt_entry,
     {
       max_held_buffers = strtoul (options + sizeof ("max-held-bufs"), 0, 0);
     }
+    else if (strncmp (options, "inode-cache",
+                      sizeof ("inode-cache") - 1) == 0)
+    {
+      inode_cache_size = strtoul (options + sizeof ("inode-cache"), 0, 0);
+    }
+    else if (strncmp (options, "file-reserve",
+                      sizeof ("file-reserve") - 1) == 0)
+    {
+      file_reserve_blocks = strtoul (options + sizeof ("file-reserve"), 0, 0);
+    }
     else
       return rtems_rfs_rtems_error ("initialise: invalid option", EINVAL);
 
@@ -816,6 +902,18 @@ rtems_rfs_rtems_initialise (rtems_filesystem_mount_table_entry_t* mt_entry,
     return rtems_rfs_rtems_error ("initialise: open", errno);
   }
 
+  rc = rtems_rfs_inode_cache_open (fs, inode_cache_size);
+  if (rc > 0)
+  {
+    rtems_rfs_fs_close (fs);
+    rtems_rfs_mutex_unlock (&rtems->access);
+    rtems_rfs_mutex_destroy (&rtems->access);
+    free (rtems);
+    return rtems_rfs_rtems_error ("initialise: inode cache", rc);
+  }
+
+  fs->file_reserve_blocks = file_reserve_blocks;
+
   mt_entry->fs_info                          = fs;
   mt_entry->ops                              = &rtems_rfs_ops;
   mt_entry->mt_fs_root->location.node_access = (void*) RTEMS_RFS_ROOT_INO;
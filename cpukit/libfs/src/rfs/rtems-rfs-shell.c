@@ -372,7 +372,7 @@ rtems_rfs_shell_inode (rtems_rfs_file_system* fs, int argc, char *argv[])
       if (!error_check_only || error)
       {
         printf (" %5" PRIu32 ": pos=%06" PRIu32 ":%04zx %c ",
-                ino, rtems_rfs_buffer_bnum (&inode.buffer),
+                ino, inode.block,
                 inode.offset * RTEMS_RFS_INODE_SIZE,
                 allocated ? 'A' : 'F');
 
@@ -713,6 +713,10 @@ rtems_shell_rfs_format (int argc, char* argv[])
           config.initialise_inodes = true;
           break;
 
+        case 'd':
+          config.dir_index = true;
+          break;
+
         case 'o':
           arg++;
           if (arg >= argc)
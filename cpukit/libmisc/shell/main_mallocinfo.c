@@ -14,6 +14,7 @@
 #endif
 
 #include <inttypes.h>
+#include <stdio.h>
 #include <string.h>
 
 #include <rtems.h>
@@ -31,13 +32,33 @@ static int rtems_shell_main_malloc_info(
   if ( argc == 2 && strcmp( argv[ 1 ], "walk" ) == 0 ) {
     malloc_walk( 0, true );
   } else {
-    Heap_Information_block info;
+    Heap_Information_block        info;
+    rtems_malloc_cache_statistics cache;
 
     rtems_shell_print_unified_work_area_message();
     malloc_info( &info );
     rtems_shell_print_heap_info( "free", &info.Free );
     rtems_shell_print_heap_info( "used", &info.Used );
     rtems_shell_print_heap_stats( &info.Stats );
+
+    if ( rtems_malloc_cache_get_statistics( &cache ) ) {
+      printf(
+        "Per-CPU cache hits:                       %12" PRIu64 "\n"
+        "Per-CPU cache misses:                     %12" PRIu64 "\n"
+        "Per-CPU cache frees:                      %12" PRIu64 "\n"
+        "Per-CPU cache refills:                    %12" PRIu64 "\n"
+        "Per-CPU cache drains:                     %12" PRIu64 "\n"
+        "Per-CPU cache blocks:                     %12" PRIuPTR "\n"
+        "Per-CPU cache bytes:                      %12" PRIuPTR "\n",
+        cache.hits,
+        cache.misses,
+        cache.frees,
+        cache.refills,
+        cache.drains,
+        cache.cached_blocks,
+        cache.cached_bytes
+      );
+    }
   }
 
   return 0;
@@ -21,7 +21,7 @@
 #include <rtems/fsmount.h>
 #include "internal.h"
 
-#define OPTIONS "[-v] [-s blksz] [-b grpblk] [-i grpinode] [-I] [-o %inode]"
+#define OPTIONS "[-v] [-s blksz] [-b grpblk] [-i grpinode] [-I] [-d] [-o %inode]"
 
 rtems_shell_cmd_t rtems_shell_MKRFS_Command = {
   "mkrfs",                                   /* name */
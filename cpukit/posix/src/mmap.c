@@ -159,9 +159,7 @@ void *mmap(
 
     /* Check to see if the mapping is valid for a regular file. */
     if ( S_ISREG( sb.st_mode )
-    /* FIXME: Should this be using strict inequality (>) comparisons? It would
-     * be valid to map a region exactly equal to the st_size, e.g. see below. */
-         && (( off >= sb.st_size ) || (( off + len ) >= sb.st_size ))) {
+         && (( off >= sb.st_size ) || (( off + len ) > sb.st_size ))) {
       errno = EOVERFLOW;
       return MAP_FAILED;
     }
@@ -285,8 +283,23 @@ void *mmap(
       mapping->shm = iop_to_shm( iop );
     }
 
-    err = (*iop->pathinfo.handlers->mmap_h)(
-        iop, &mapping->addr, len, prot, off );
+    if ( S_ISREG( sb.st_mode ) ) {
+      /*
+       * Shared mappings of regular files reference the file storage
+       * directly.  Keep a reference to the file to prevent its removal
+       * while it is mapped.
+       */
+      rtems_filesystem_instance_lock( &iop->pathinfo );
+      err = (*iop->pathinfo.handlers->mmap_h)(
+          iop, &mapping->addr, len, prot, off );
+      if ( err == 0 ) {
+        rtems_filesystem_location_clone( &mapping->location, &iop->pathinfo );
+      }
+      rtems_filesystem_instance_unlock( &iop->pathinfo );
+    } else {
+      err = (*iop->pathinfo.handlers->mmap_h)(
+          iop, &mapping->addr, len, prot, off );
+    }
     if ( err != 0 ) {
       mmap_mappings_lock_release( );
       free( mapping );
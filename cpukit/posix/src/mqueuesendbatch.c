@@ -0,0 +1,109 @@
+/**
+ * @file
+ *
+ * @ingroup POSIX_MQUEUE
+ *
+ * @brief mq_send_batch_np()
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/posix/mqueueimpl.h>
+#include <rtems/posix/posixapi.h>
+
+#include <fcntl.h>
+
+int mq_send_batch_np(
+  mqd_t         mqdes,
+  const char   *msg_ptr,
+  size_t        msg_len,
+  const size_t *msg_lens,
+  unsigned int  count,
+  unsigned int  msg_prio
+)
+{
+  POSIX_Message_queue_Control *the_mq;
+  Thread_queue_Context         queue_context;
+  Status_Control               status;
+  uint32_t                     sent;
+
+  if ( msg_prio > MQ_PRIO_MAX ) {
+    rtems_set_errno_and_return_minus_one( EINVAL );
+  }
+
+  if ( msg_ptr == NULL || msg_lens == NULL ) {
+    rtems_set_errno_and_return_minus_one( EINVAL );
+  }
+
+  the_mq = _POSIX_Message_queue_Get( mqdes, &queue_context );
+
+  if ( the_mq == NULL ) {
+    rtems_set_errno_and_return_minus_one( EBADF );
+  }
+
+  if ( ( the_mq->oflag & O_ACCMODE ) == O_RDONLY ) {
+    _ISR_lock_ISR_enable( &queue_context.Lock_context.Lock_context );
+    rtems_set_errno_and_return_minus_one( EBADF );
+  }
+
+  if ( msg_len < the_mq->Message_queue.maximum_message_size ) {
+    _ISR_lock_ISR_enable( &queue_context.Lock_context.Lock_context );
+    rtems_set_errno_and_return_minus_one( EMSGSIZE );
+  }
+
+  _CORE_message_queue_Acquire_critical(
+    &the_mq->Message_queue,
+    &queue_context
+  );
+
+  if ( the_mq->open_count == 0 ) {
+    _CORE_message_queue_Release( &the_mq->Message_queue, &queue_context );
+    rtems_set_errno_and_return_minus_one( EBADF );
+  }
+
+  status = _CORE_message_queue_Submit_multiple(
+    &the_mq->Message_queue,
+    msg_ptr,
+    msg_len,
+    msg_lens,
+    count,
+    &sent,
+    _POSIX_Message_queue_Priority_to_core( msg_prio ),
+    &queue_context
+  );
+
+  if ( sent == 0 && status != STATUS_SUCCESSFUL ) {
+    rtems_set_errno_and_return_minus_one( _POSIX_Get_error( status ) );
+  }
+
+  return (int) sent;
+}
@@ -18,11 +18,52 @@
 #include <errno.h>
 #include <rtems/seterr.h>
 
+#include <rtems/posix/mmanimpl.h>
+
 int msync( void *addr, size_t len, int flags )
 {
-  (void) addr;
-  (void) len;
-  (void) flags;
+  rtems_chain_node *node;
+  bool              mapped;
+
+  if ( ( flags & ~( MS_ASYNC | MS_SYNC | MS_INVALIDATE ) ) != 0 ) {
+    rtems_set_errno_and_return_minus_one( EINVAL );
+  }
+
+  if ( ( flags & ( MS_ASYNC | MS_SYNC ) ) == ( MS_ASYNC | MS_SYNC ) ) {
+    rtems_set_errno_and_return_minus_one( EINVAL );
+  }
+
+  /*
+   * Shared mappings reference the storage of the mapped object directly and
+   * private mappings are copies, so there is nothing to write back.  Only
+   * check that the range is mapped.
+   */
+  mapped = false;
+
+  mmap_mappings_lock_obtain();
+
+  node = rtems_chain_first( &mmap_mappings );
+  while ( !rtems_chain_is_tail( &mmap_mappings, node ) ) {
+    mmap_mapping *mapping = (mmap_mapping *) node;
+    char         *begin = mapping->addr;
+
+    if (
+      (char *) addr >= begin
+        && (size_t) ( (char *) addr - begin ) <= mapping->len
+        && len <= mapping->len - (size_t) ( (char *) addr - begin )
+    ) {
+      mapped = true;
+      break;
+    }
+
+    node = rtems_chain_next( node );
+  }
+
+  mmap_mappings_lock_release();
+
+  if ( !mapped ) {
+    rtems_set_errno_and_return_minus_one( ENOMEM );
+  }
 
-  rtems_set_errno_and_return_minus_one( EINVAL );
+  return 0;
 }
@@ -22,6 +22,7 @@
 int munmap(void *addr, size_t len)
 {
   mmap_mapping     *mapping;
+  mmap_mapping     *unmapped;
   rtems_chain_node *node;
 
   /*
@@ -43,6 +44,8 @@ int munmap(void *addr, size_t len)
     return -1;
   }
 
+  unmapped = NULL;
+
   mmap_mappings_lock_obtain();
 
   node = rtems_chain_first (&mmap_mappings);
@@ -67,12 +70,36 @@ int munmap(void *addr, size_t len)
           free( mapping->addr );
         }
       }
-      free( mapping );
+      unmapped = mapping;
       break;
     }
     node = rtems_chain_next( node );
   }
 
   mmap_mappings_lock_release( );
+
+  if ( unmapped != NULL ) {
+    /* Release the reference to a mapped regular file */
+    if ( unmapped->location.mt_entry != NULL ) {
+      rtems_filesystem_munmap_t munmap_h;
+
+      /*
+       * Handler tables initialized before the munmap handler was added to the
+       * end of the table have no munmap handler.
+       */
+      munmap_h = unmapped->location.handlers->munmap_h;
+      if ( munmap_h == NULL ) {
+        munmap_h = rtems_filesystem_default_munmap;
+      }
+
+      rtems_filesystem_instance_lock( &unmapped->location );
+      (*munmap_h)( &unmapped->location, unmapped->addr, unmapped->len );
+      rtems_filesystem_instance_unlock( &unmapped->location );
+      rtems_filesystem_location_free( &unmapped->location );
+    }
+
+    free( unmapped );
+  }
+
   return 0;
 }
@@ -0,0 +1,183 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPISPSC
+ *
+ * @brief Single-Producer/Single-Consumer Channel Implementation
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/spsc.h>
+#include <rtems/rtems/optionsimpl.h>
+#include <rtems/rtems/statusimpl.h>
+#include <rtems/score/statesimpl.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/threadqimpl.h>
+
+#define SPSC_TQ_OPERATIONS &_Thread_queue_Operations_FIFO
+
+rtems_status_code rtems_spsc_channel_initialize(
+  rtems_spsc_channel *channel,
+  void               *storage,
+  unsigned int        message_count,
+  size_t              message_size
+)
+{
+  if ( channel == NULL || storage == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if ( message_count == 0 || ( message_count & ( message_count - 1 ) ) != 0 ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  if ( message_size == 0 ) {
+    return RTEMS_INVALID_SIZE;
+  }
+
+  memset( channel, 0, sizeof( *channel ) );
+  _Thread_queue_Initialize( &channel->Wait_queue, "SPSC" );
+  channel->storage = storage;
+  channel->message_size = message_size;
+  channel->mask = message_count - 1;
+  _Atomic_Init_uint( &channel->waiting, 0 );
+  _Atomic_Init_uint( &channel->Producer.tail, 0 );
+  _Atomic_Init_uint( &channel->Consumer.head, 0 );
+
+  return RTEMS_SUCCESSFUL;
+}
+
+void rtems_spsc_channel_destroy( rtems_spsc_channel *channel )
+{
+  _Assert( _Thread_queue_Is_empty( &channel->Wait_queue.Queue ) );
+  _Thread_queue_Destroy( &channel->Wait_queue );
+}
+
+static bool _SPSC_Is_empty( rtems_spsc_channel *channel )
+{
+  return _Atomic_Load_uint( &channel->Consumer.head, ATOMIC_ORDER_RELAXED )
+    == _Atomic_Load_uint( &channel->Producer.tail, ATOMIC_ORDER_RELAXED );
+}
+
+void _RTEMS_spsc_channel_Wake( rtems_spsc_channel *channel )
+{
+  Thread_queue_Context  queue_context;
+  Thread_Control       *the_thread;
+
+  _Thread_queue_Context_initialize( &queue_context );
+  _Thread_queue_Acquire( &channel->Wait_queue, &queue_context );
+
+  if ( _Atomic_Load_uint( &channel->waiting, ATOMIC_ORDER_RELAXED ) == 0 ) {
+    /* Another producer call or the consumer itself handled the waiting */
+    _Thread_queue_Release( &channel->Wait_queue, &queue_context );
+    return;
+  }
+
+  _Atomic_Store_uint( &channel->waiting, 0, ATOMIC_ORDER_RELAXED );
+  the_thread = _Thread_queue_First_locked(
+    &channel->Wait_queue,
+    SPSC_TQ_OPERATIONS
+  );
+
+  if ( the_thread == NULL ) {
+    _Thread_queue_Release( &channel->Wait_queue, &queue_context );
+    return;
+  }
+
+  _Thread_queue_Extract_critical(
+    &channel->Wait_queue.Queue,
+    SPSC_TQ_OPERATIONS,
+    the_thread,
+    &queue_context
+  );
+}
+
+rtems_status_code rtems_spsc_channel_receive(
+  rtems_spsc_channel *channel,
+  void               *message,
+  rtems_option        option_set,
+  rtems_interval      timeout
+)
+{
+  while ( !rtems_spsc_channel_try_receive( channel, message ) ) {
+    Thread_queue_Context  queue_context;
+    Thread_Control       *executing;
+    Status_Control        status;
+
+    if ( _Options_Is_no_wait( option_set ) ) {
+      return RTEMS_UNSATISFIED;
+    }
+
+    _Thread_queue_Context_initialize( &queue_context );
+    _Thread_queue_Acquire( &channel->Wait_queue, &queue_context );
+
+    /*
+     * Announce that the consumer is about to wait and check the channel
+     * again.  This fence pairs with the fence in rtems_spsc_channel_send().
+     */
+    _Atomic_Store_uint( &channel->waiting, 1, ATOMIC_ORDER_RELAXED );
+    _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+    if ( !_SPSC_Is_empty( channel ) ) {
+      _Atomic_Store_uint( &channel->waiting, 0, ATOMIC_ORDER_RELAXED );
+      _Thread_queue_Release( &channel->Wait_queue, &queue_context );
+      continue;
+    }
+
+    executing = _Thread_Executing;
+    _Thread_queue_Context_set_thread_state(
+      &queue_context,
+      STATES_WAITING_FOR_MESSAGE
+    );
+    _Thread_queue_Context_set_enqueue_timeout_ticks( &queue_context, timeout );
+    _Thread_queue_Enqueue(
+      &channel->Wait_queue.Queue,
+      SPSC_TQ_OPERATIONS,
+      executing,
+      &queue_context
+    );
+    status = _Thread_Wait_get_status( executing );
+
+    if ( status != STATUS_SUCCESSFUL ) {
+      _Atomic_Store_uint( &channel->waiting, 0, ATOMIC_ORDER_RELAXED );
+
+      if ( rtems_spsc_channel_try_receive( channel, message ) ) {
+        return RTEMS_SUCCESSFUL;
+      }
+
+      return _Status_Get( status );
+    }
+  }
+
+  return RTEMS_SUCCESSFUL;
+}
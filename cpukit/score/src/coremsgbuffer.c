@@ -0,0 +1,147 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreMessageQueue
+ *
+ * @brief Submit and Seize Loaned Message Buffers
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/statesimpl.h>
+
+Status_Control _CORE_message_queue_Submit_buffer(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  size_t                             size,
+  CORE_message_queue_Submit_types    submit_type,
+  Thread_queue_Context              *queue_context
+)
+{
+  Thread_Control *the_thread;
+
+  if ( size > the_message_queue->maximum_message_size ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_MESSAGE_INVALID_SIZE;
+  }
+
+  the_thread = _CORE_message_queue_Dequeue_receiver(
+    the_message_queue,
+    the_message,
+    the_message->Contents.buffer,
+    size,
+    submit_type,
+    queue_context
+  );
+  if ( the_thread != NULL ) {
+    return STATUS_SUCCESSFUL;
+  }
+
+  /*
+   *  The message buffer is already owned by the caller, so the message
+   *  content is in place and there is no need for a free message buffer.
+   */
+  _CORE_message_queue_Insert_message(
+    the_message_queue,
+    the_message,
+    the_message->Contents.buffer,
+    size,
+    submit_type
+  );
+
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
+  if (
+    the_message_queue->number_of_pending_messages == 1
+      && the_message_queue->notify_handler != NULL
+  ) {
+    ( *the_message_queue->notify_handler )(
+      the_message_queue,
+      queue_context
+    );
+  } else {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+  }
+#else
+  _CORE_message_queue_Release( the_message_queue, queue_context );
+#endif
+
+  return STATUS_SUCCESSFUL;
+}
+
+Status_Control _CORE_message_queue_Seize_buffer(
+  CORE_message_queue_Control  *the_message_queue,
+  Thread_Control              *executing,
+  void                       **buffer_p,
+  size_t                      *size_p,
+  bool                         wait,
+  Thread_queue_Context        *queue_context
+)
+{
+  CORE_message_queue_Buffer_control *the_message;
+
+  the_message = _CORE_message_queue_Get_pending_message( the_message_queue );
+  if ( the_message != NULL ) {
+    the_message_queue->number_of_pending_messages -= 1;
+    _Chain_Set_off_chain( &the_message->Node );
+
+    *buffer_p = the_message->Contents.buffer;
+    *size_p = the_message->Contents.size;
+    executing->Wait.count =
+      _CORE_message_queue_Get_message_priority( the_message );
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_SUCCESSFUL;
+  }
+
+  if ( !wait ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_UNSATISFIED;
+  }
+
+  executing->Wait.return_argument_second.mutable_object = buffer_p;
+  executing->Wait.return_argument = size_p;
+  executing->Wait.option = CORE_MESSAGE_QUEUE_RECEIVE_LOANED;
+  /* Wait.count will be filled in with the message priority */
+
+  _Thread_queue_Context_set_thread_state(
+    queue_context,
+    STATES_WAITING_FOR_MESSAGE
+  );
+  _Thread_queue_Enqueue(
+    &the_message_queue->Wait_queue.Queue,
+    the_message_queue->operations,
+    executing,
+    queue_context
+  );
+  return _Thread_Wait_get_status( executing );
+}
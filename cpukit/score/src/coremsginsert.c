@@ -50,11 +50,13 @@ void _CORE_message_queue_Insert_message(
 
   the_message->Contents.size = content_size;
 
-  _CORE_message_queue_Copy_buffer(
-    content_source,
-    the_message->Contents.buffer,
-    content_size
-  );
+  if ( content_source != the_message->Contents.buffer ) {
+    _CORE_message_queue_Copy_buffer(
+      content_source,
+      the_message->Contents.buffer,
+      content_size
+    );
+  }
 
 #if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
   the_message->priority = submit_type;
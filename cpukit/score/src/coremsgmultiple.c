@@ -0,0 +1,250 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreMessageQueue
+ *
+ * @brief Submit and Seize Multiple Messages
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/threadimpl.h>
+
+Status_Control _CORE_message_queue_Submit_multiple(
+  CORE_message_queue_Control       *the_message_queue,
+  const void                       *buffer,
+  size_t                            stride,
+  const size_t                     *sizes,
+  uint32_t                          count,
+  uint32_t                         *sent,
+  CORE_message_queue_Submit_types   submit_type,
+  Thread_queue_Context             *queue_context
+)
+{
+  const char     *source;
+  Status_Control  status;
+  uint32_t        i;
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
+  bool            notify;
+
+  notify = false;
+#endif
+  source = buffer;
+  status = STATUS_SUCCESSFUL;
+
+  for ( i = 0; i < count; ++i ) {
+    CORE_message_queue_Buffer_control *the_message;
+    Thread_Control                    *the_thread;
+    size_t                             size;
+
+    size = sizes[ i ];
+
+    if ( size > the_message_queue->maximum_message_size ) {
+      status = STATUS_MESSAGE_INVALID_SIZE;
+      break;
+    }
+
+    the_thread = _CORE_message_queue_Dequeue_receiver(
+      the_message_queue,
+      NULL,
+      source,
+      size,
+      submit_type,
+      queue_context
+    );
+
+    if ( the_thread != NULL ) {
+      /*
+       *  The receiver was extracted from the thread queue and the message
+       *  queue was released.
+       */
+      _CORE_message_queue_Acquire( the_message_queue, queue_context );
+    } else {
+      the_message =
+        _CORE_message_queue_Allocate_message_buffer( the_message_queue );
+
+      if ( the_message == NULL ) {
+        status = STATUS_TOO_MANY;
+        break;
+      }
+
+      _CORE_message_queue_Insert_message(
+        the_message_queue,
+        the_message,
+        source,
+        size,
+        submit_type
+      );
+
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
+      if ( the_message_queue->number_of_pending_messages == 1 ) {
+        notify = true;
+      }
+#endif
+    }
+
+    source += stride;
+  }
+
+  *sent = i;
+
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
+  if ( notify && the_message_queue->notify_handler != NULL ) {
+    ( *the_message_queue->notify_handler )(
+      the_message_queue,
+      queue_context
+    );
+  } else {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+  }
+#else
+  _CORE_message_queue_Release( the_message_queue, queue_context );
+#endif
+
+  return status;
+}
+
+Status_Control _CORE_message_queue_Seize_multiple(
+  CORE_message_queue_Control      *the_message_queue,
+  Thread_Control                  *executing,
+  void                            *buffer,
+  size_t                           stride,
+  size_t                          *sizes,
+  CORE_message_queue_Submit_types *priorities,
+  uint32_t                         maximum_count,
+  uint32_t                        *count,
+  bool                             wait,
+  Thread_queue_Context            *queue_context
+)
+{
+  char           *destination;
+  Status_Control  status;
+  uint32_t        i;
+
+  destination = buffer;
+
+  for ( i = 0; i < maximum_count; ++i ) {
+    CORE_message_queue_Buffer_control *the_message;
+
+    the_message = _CORE_message_queue_Get_pending_message( the_message_queue );
+    if ( the_message == NULL ) {
+      break;
+    }
+
+    the_message_queue->number_of_pending_messages -= 1;
+
+    sizes[ i ] = the_message->Contents.size;
+
+    if ( priorities != NULL ) {
+      priorities[ i ] =
+        _CORE_message_queue_Get_message_priority( the_message );
+    }
+
+    _CORE_message_queue_Copy_buffer(
+      the_message->Contents.buffer,
+      destination,
+      sizes[ i ]
+    );
+    destination += stride;
+
+    #if !defined(RTEMS_SCORE_COREMSG_ENABLE_BLOCKING_SEND)
+      _CORE_message_queue_Free_message_buffer( the_message_queue, the_message );
+    #else
+    {
+      Thread_Control *the_thread;
+
+      /*
+       *  There could be a thread waiting to send a message.  If there is
+       *  one, then use the free message buffer to put its message in the
+       *  message queue on behalf of the waiting thread.
+       */
+      the_thread = _Thread_queue_First_locked(
+        &the_message_queue->Wait_queue,
+        the_message_queue->operations
+      );
+      if ( the_thread == NULL ) {
+        _CORE_message_queue_Free_message_buffer(
+          the_message_queue,
+          the_message
+        );
+      } else {
+        _CORE_message_queue_Insert_message(
+          the_message_queue,
+          the_message,
+          the_thread->Wait.return_argument_second.immutable_object,
+          (size_t) the_thread->Wait.option,
+          (CORE_message_queue_Submit_types) the_thread->Wait.count
+        );
+        _Thread_queue_Extract_critical(
+          &the_message_queue->Wait_queue.Queue,
+          the_message_queue->operations,
+          the_thread,
+          queue_context
+        );
+        _CORE_message_queue_Acquire( the_message_queue, queue_context );
+      }
+    }
+    #endif
+  }
+
+  if ( i > 0 ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    *count = i;
+    return STATUS_SUCCESSFUL;
+  }
+
+  /*
+   *  No message is pending, so block for exactly one message if the caller
+   *  is willing to wait.
+   */
+  status = _CORE_message_queue_Seize(
+    the_message_queue,
+    executing,
+    buffer,
+    sizes,
+    wait,
+    queue_context
+  );
+
+  if ( status == STATUS_SUCCESSFUL ) {
+    if ( priorities != NULL ) {
+      priorities[ 0 ] = (CORE_message_queue_Submit_types) executing->Wait.count;
+    }
+
+    *count = 1;
+  } else {
+    *count = 0;
+  }
+
+  return status;
+}
@@ -50,6 +50,7 @@ Status_Control _CORE_message_queue_Submit(
 
   the_thread = _CORE_message_queue_Dequeue_receiver(
     the_message_queue,
+    NULL,
     buffer,
     size,
     submit_type,
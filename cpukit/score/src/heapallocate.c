@@ -223,7 +223,16 @@ void *_Heap_Allocate_aligned_with_boundary(
   do {
     Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
 
-    block = _Heap_Free_list_first( heap );
+    /*
+     * Without alignment constraints any block of a large enough size class
+     * satisfies the request, so the free block index provides the start.
+     */
+    if ( heap->free_index != NULL && alignment == 0 ) {
+      block = _Heap_Free_index_search( heap, block_size_floor );
+    } else {
+      block = _Heap_Free_list_first( heap );
+    }
+
     while ( block != free_list_tail ) {
       _HAssert( _Heap_Is_prev_used( block ) );
 
@@ -35,13 +35,17 @@ static void _Heap_Free_block( Heap_Control *heap, Heap_Block *block )
   /*
    * The _Heap_Free() will place the block to the head of free list.  We want
    * the new block at the end of the free list.  So that initial and earlier
-   * areas are consumed first.
+   * areas are consumed first.  A heap with a free block index keeps the free
+   * list ordered by size classes, so leave the block where it is.
    */
   _Heap_Free( heap, (void *) _Heap_Alloc_area_of_block( block ) );
   _Heap_Protection_free_all_delayed_blocks( heap );
-  first_free = _Heap_Free_list_first( heap );
-  _Heap_Free_list_remove( first_free );
-  _Heap_Free_list_insert_before( _Heap_Free_list_tail( heap ), first_free );
+
+  if ( heap->free_index == NULL ) {
+    first_free = _Heap_Free_list_first( heap );
+    _Heap_Free_list_remove( first_free );
+    _Heap_Free_list_insert_before( _Heap_Free_list_tail( heap ), first_free );
+  }
 }
 
 static void _Heap_Merge_below(
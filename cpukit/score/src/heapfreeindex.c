@@ -0,0 +1,232 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreHeap
+ *
+ * @brief Heap Handler Segregated Fit Free Block Index Implementation
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/heapimpl.h>
+
+#include <string.h>
+
+/*
+ * The free list of a heap with a free block index is a concatenation of the
+ * free blocks of each size class in ascending size class order.  The index
+ * references the first free block of each non-empty size class.  Thus the
+ * first block of the next non-empty size class is the insert position for a
+ * block of an empty size class.
+ */
+
+static Heap_Block *_Heap_Free_index_find(
+  const Heap_Free_index *index,
+  uint32_t               first_level,
+  uint32_t               second_level
+)
+{
+  uint32_t second_level_map;
+
+  if ( second_level < HEAP_FREE_INDEX_SECOND_LEVEL_COUNT ) {
+    second_level_map = index->second_level_bitmap[ first_level ]
+      & ( UINT32_MAX << second_level );
+  } else {
+    second_level_map = 0;
+  }
+
+  if ( second_level_map == 0 ) {
+    uint32_t first_level_map;
+
+    if ( first_level + 1 < HEAP_FREE_INDEX_FIRST_LEVEL_COUNT ) {
+      first_level_map = index->first_level_bitmap
+        & ( UINT32_MAX << ( first_level + 1 ) );
+    } else {
+      first_level_map = 0;
+    }
+
+    if ( first_level_map == 0 ) {
+      return NULL;
+    }
+
+    first_level = (uint32_t) __builtin_ctz( first_level_map );
+    second_level_map = index->second_level_bitmap[ first_level ];
+  }
+
+  second_level = (uint32_t) __builtin_ctz( second_level_map );
+
+  return index->first[ first_level ][ second_level ];
+}
+
+void _Heap_Free_index_insert( Heap_Control *heap, Heap_Block *block )
+{
+  Heap_Free_index *index;
+  Heap_Block      *next;
+  uint32_t         first_level;
+  uint32_t         second_level;
+
+  index = heap->free_index;
+  _Heap_Free_index_mapping(
+    _Heap_Block_size( block ),
+    &first_level,
+    &second_level
+  );
+  next = index->first[ first_level ][ second_level ];
+
+  if ( next == NULL ) {
+    next = _Heap_Free_index_find( index, first_level, second_level + 1 );
+
+    if ( next == NULL ) {
+      next = _Heap_Free_list_tail( heap );
+    }
+
+    index->first_level_bitmap |= 1U << first_level;
+    index->second_level_bitmap[ first_level ] |= 1U << second_level;
+  }
+
+  index->first[ first_level ][ second_level ] = block;
+  _Heap_Free_list_insert_before( next, block );
+}
+
+void _Heap_Free_index_remove( Heap_Control *heap, Heap_Block *block )
+{
+  Heap_Free_index *index;
+  uint32_t         first_level;
+  uint32_t         second_level;
+
+  index = heap->free_index;
+  _Heap_Free_index_mapping(
+    _Heap_Block_size( block ),
+    &first_level,
+    &second_level
+  );
+
+  if ( index->first[ first_level ][ second_level ] == block ) {
+    Heap_Block *next;
+    uint32_t    next_first_level;
+    uint32_t    next_second_level;
+
+    next = block->next;
+
+    if ( next != _Heap_Free_list_tail( heap ) ) {
+      _Heap_Free_index_mapping(
+        _Heap_Block_size( next ),
+        &next_first_level,
+        &next_second_level
+      );
+    } else {
+      next_first_level = HEAP_FREE_INDEX_FIRST_LEVEL_COUNT;
+      next_second_level = HEAP_FREE_INDEX_SECOND_LEVEL_COUNT;
+    }
+
+    if (
+      next_first_level == first_level && next_second_level == second_level
+    ) {
+      index->first[ first_level ][ second_level ] = next;
+    } else {
+      index->first[ first_level ][ second_level ] = NULL;
+      index->second_level_bitmap[ first_level ] &= ~( 1U << second_level );
+
+      if ( index->second_level_bitmap[ first_level ] == 0 ) {
+        index->first_level_bitmap &= ~( 1U << first_level );
+      }
+    }
+  }
+
+  _Heap_Free_list_remove( block );
+}
+
+Heap_Block *_Heap_Free_index_search(
+  Heap_Control *heap,
+  uintptr_t     block_size
+)
+{
+  const Heap_Free_index *index;
+  Heap_Block            *block;
+  uintptr_t              good_fit_size;
+  uint32_t               first_level;
+  uint32_t               second_level;
+
+  index = heap->free_index;
+
+  /*
+   * Round up the block size to the next size class boundary.  All blocks of
+   * the size class of the rounded up size and all following size classes are
+   * large enough.
+   */
+  good_fit_size = block_size;
+  _Heap_Free_index_mapping( block_size, &first_level, &second_level );
+
+  if ( first_level > 0 ) {
+    good_fit_size += ( (uintptr_t) 1 << ( first_level - 1 ) ) - 1;
+  }
+
+  if ( good_fit_size >= block_size ) {
+    _Heap_Free_index_mapping( good_fit_size, &first_level, &second_level );
+    block = _Heap_Free_index_find( index, first_level, second_level );
+
+    if ( block != NULL ) {
+      return block;
+    }
+
+    _Heap_Free_index_mapping( block_size, &first_level, &second_level );
+  }
+
+  block = _Heap_Free_index_find( index, first_level, second_level );
+
+  if ( block == NULL ) {
+    block = _Heap_Free_list_tail( heap );
+  }
+
+  return block;
+}
+
+void _Heap_Initialize_free_index( Heap_Control *heap, Heap_Free_index *index )
+{
+  Heap_Block *const free_list_head = _Heap_Free_list_head( heap );
+  Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
+  Heap_Block *block;
+
+  memset( index, 0, sizeof( *index ) );
+
+  block = _Heap_Free_list_first( heap );
+  free_list_head->next = free_list_tail;
+  free_list_tail->prev = free_list_head;
+  heap->free_index = index;
+
+  while ( block != free_list_tail ) {
+    Heap_Block *next = block->next;
+
+    _Heap_Free_index_insert( heap, block );
+    block = next;
+  }
+}
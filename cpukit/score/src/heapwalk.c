@@ -52,6 +52,104 @@ static void _Heap_Walk_print( int source, bool error, const char *fmt, ... )
   va_end( ap );
 }
 
+static bool _Heap_Walk_check_free_index(
+  int source,
+  Heap_Walk_printer printer,
+  Heap_Control *heap
+)
+{
+  const Heap_Free_index *const index = heap->free_index;
+  const Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
+  const Heap_Block *free_block = _Heap_Free_list_first( heap );
+  uint32_t prev_class = 0;
+  uint32_t class_count = 0;
+  uint32_t first_level = 0;
+  uint32_t second_level = 0;
+  uint32_t bit_count = 0;
+
+  while ( free_block != free_list_tail ) {
+    uint32_t class;
+
+    _Heap_Free_index_mapping(
+      _Heap_Block_size( free_block ),
+      &first_level,
+      &second_level
+    );
+    class = first_level * HEAP_FREE_INDEX_SECOND_LEVEL_COUNT + second_level;
+
+    if ( class_count > 0 && class < prev_class ) {
+      (*printer)(
+        source,
+        true,
+        "free block 0x%08x: size class out of order\n",
+        free_block
+      );
+
+      return false;
+    }
+
+    if ( class_count == 0 || class != prev_class ) {
+      if (
+        index->first[ first_level ][ second_level ] != free_block
+          || ( index->first_level_bitmap & ( 1U << first_level ) ) == 0
+          || ( index->second_level_bitmap[ first_level ]
+            & ( 1U << second_level ) ) == 0
+      ) {
+        (*printer)(
+          source,
+          true,
+          "free block 0x%08x: not first block of size class in index\n",
+          free_block
+        );
+
+        return false;
+      }
+
+      prev_class = class;
+      ++class_count;
+    }
+
+    free_block = free_block->next;
+  }
+
+  for (
+    first_level = 0;
+    first_level < HEAP_FREE_INDEX_FIRST_LEVEL_COUNT;
+    ++first_level
+  ) {
+    uint32_t const map = index->second_level_bitmap[ first_level ];
+    bool const is_set =
+      ( index->first_level_bitmap & ( 1U << first_level ) ) != 0;
+
+    if ( ( map != 0 ) != is_set ) {
+      (*printer)(
+        source,
+        true,
+        "free index: inconsistent first level bitmap for class %u\n",
+        first_level
+      );
+
+      return false;
+    }
+
+    bit_count += (uint32_t) __builtin_popcount( map );
+  }
+
+  if ( bit_count != class_count ) {
+    (*printer)(
+      source,
+      true,
+      "free index: %u non-empty size classes, but %u in free list\n",
+      bit_count,
+      class_count
+    );
+
+    return false;
+  }
+
+  return true;
+}
+
 static bool _Heap_Walk_check_free_list(
   int source,
   Heap_Walk_printer printer,
@@ -116,6 +214,10 @@ static bool _Heap_Walk_check_free_list(
     free_block = free_block->next;
   }
 
+  if ( heap->free_index != NULL ) {
+    return _Heap_Walk_check_free_index( source, printer, heap );
+  }
+
   return true;
 }
 
@@ -26,7 +26,63 @@
 
 #include <rtems/score/watchdogimpl.h>
 
-void _Watchdog_Insert(
+#if defined(RTEMS_SMP)
+bool _Watchdog_Tickless_idle_enabled;
+
+/*
+ * Returns the processor of the watchdog header if this is another processor
+ * which sleeps in the tickless idle mode, otherwise NULL.
+ */
+static Per_CPU_Control *_Watchdog_Get_sleeping_CPU(
+  const Watchdog_Header  *header,
+  const Watchdog_Control *the_watchdog
+)
+{
+  Per_CPU_Control *cpu;
+
+  cpu = _Watchdog_Get_CPU( the_watchdog );
+
+  if ( cpu->Watchdog.sleep_until == 0 || cpu == _Per_CPU_Get() ) {
+    return NULL;
+  }
+
+  if (
+    header != &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ]
+      && header != &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ]
+      && header != &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_REALTIME ]
+  ) {
+    return NULL;
+  }
+
+  return cpu;
+}
+
+static void _Watchdog_Wake_up(
+  Per_CPU_Control        *cpu,
+  const Watchdog_Header  *header,
+  const Watchdog_Control *the_watchdog
+)
+{
+  bool wake_up;
+
+  if ( header == &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ] ) {
+    wake_up = the_watchdog->expire < cpu->Watchdog.sleep_until;
+  } else {
+    /*
+     * The expiration time of the clock based headers is not in ticks, so
+     * let the processor check a new first watchdog.
+     */
+    wake_up = header->first == &the_watchdog->Node.RBTree;
+  }
+
+  if ( wake_up ) {
+    cpu->Watchdog.sleep_until = 0;
+    _CPU_SMP_Send_interrupt( _Per_CPU_Get_index( cpu ) );
+  }
+}
+#endif
+
+static void _Watchdog_Insert_tree(
   Watchdog_Header  *header,
   Watchdog_Control *the_watchdog,
   uint64_t          expire
@@ -37,8 +93,6 @@ void _Watchdog_Insert(
   RBTree_Node  *old_first;
   RBTree_Node  *new_first;
 
-  _Assert( _Watchdog_Get_state( the_watchdog ) == WATCHDOG_INACTIVE );
-
   link = _RBTree_Root_reference( &header->Watchdogs );
   parent = NULL;
   old_first = header->first;
@@ -65,3 +119,46 @@ void _Watchdog_Insert(
   _RBTree_Add_child( &the_watchdog->Node.RBTree, parent, link );
   _RBTree_Insert_color( &header->Watchdogs, &the_watchdog->Node.RBTree );
 }
+
+void _Watchdog_Insert(
+  Watchdog_Header  *header,
+  Watchdog_Control *the_watchdog,
+  uint64_t          expire
+)
+{
+#if defined(RTEMS_SMP)
+  Per_CPU_Control *cpu;
+#endif
+
+  _Assert( _Watchdog_Get_state( the_watchdog ) == WATCHDOG_INACTIVE );
+
+#if defined(RTEMS_SMP)
+  if ( _Watchdog_Tickless_idle_enabled ) {
+    cpu = _Watchdog_Get_sleeping_CPU( header, the_watchdog );
+  } else {
+    cpu = NULL;
+  }
+
+  if (
+    cpu != NULL && header == &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ]
+  ) {
+    /*
+     * The expiration time is relative to the watchdog ticks of the processor
+     * which stand still while it sleeps.  Account for the elapsed ticks.
+     */
+    expire += _Watchdog_Tickless_forward( cpu );
+  }
+#endif
+
+  if ( header->wheel != NULL ) {
+    _Watchdog_Wheel_insert( header->wheel, the_watchdog, expire );
+  } else {
+    _Watchdog_Insert_tree( header, the_watchdog, expire );
+  }
+
+#if defined(RTEMS_SMP)
+  if ( cpu != NULL ) {
+    _Watchdog_Wake_up( cpu, header, the_watchdog );
+  }
+#endif
+}
@@ -59,28 +59,46 @@ void _Watchdog_Tick( Per_CPU_Control *cpu )
   uint64_t          ticks;
   struct timespec   now;
 
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+
+  /*
+   * Update the ticks since boot under the watchdog lock, since other
+   * processors may account for skipped ticks of a processor in the tickless
+   * idle mode, see _Watchdog_Tickless_forward().
+   */
   if ( _Per_CPU_Is_boot_processor( cpu ) ) {
     ++_Watchdog_Ticks_since_boot;
   }
 
-  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
-
   ticks = cpu->Watchdog.ticks;
   _Assert( ticks < UINT64_MAX );
   ++ticks;
   cpu->Watchdog.ticks = ticks;
+#if defined(RTEMS_SMP)
+  cpu->Watchdog.sleep_until = 0;
+#endif
 
   header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ];
-  first = _Watchdog_Header_first( header );
 
-  if ( first != NULL ) {
-    _Watchdog_Tickle(
-      header,
-      first,
+  if ( header->wheel != NULL ) {
+    _Watchdog_Wheel_tickle(
+      header->wheel,
       ticks,
       &cpu->Watchdog.Lock,
       &lock_context
     );
+  } else {
+    first = _Watchdog_Header_first( header );
+
+    if ( first != NULL ) {
+      _Watchdog_Tickle(
+        header,
+        first,
+        ticks,
+        &cpu->Watchdog.Lock,
+        &lock_context
+      );
+    }
   }
 
   header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ];
@@ -0,0 +1,283 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreWatchdog
+ *
+ * @brief Watchdog Tickless Support
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+#include <rtems/score/timecounter.h>
+
+static uint64_t _Watchdog_Tickless_uptime( void )
+{
+  struct timespec now;
+
+  _Timecounter_Nanouptime( &now );
+
+  return (uint64_t) now.tv_sec * WATCHDOG_NANOSECONDS_PER_SECOND
+    + (uint64_t) now.tv_nsec;
+}
+
+/*
+ * Advances the watchdog ticks of the processor without a watchdog tick.  The
+ * watchdogs which expired in the skipped ticks are processed by the next
+ * _Watchdog_Tick().  The watchdog lock of the processor must be held.
+ */
+static void _Watchdog_Skip_ticks( Per_CPU_Control *cpu, uint64_t ticks )
+{
+  Watchdog_Wheel *wheel;
+
+  if ( _Per_CPU_Is_boot_processor( cpu ) ) {
+    _Watchdog_Ticks_since_boot += (Watchdog_Interval) ticks;
+  }
+
+  _Assert( cpu->Watchdog.ticks <= UINT64_MAX - ticks );
+  cpu->Watchdog.ticks += ticks;
+  wheel = cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ].wheel;
+
+  if ( wheel != NULL ) {
+    uint64_t next;
+
+    /*
+     * The skipped ticks up to the next expiration time have no work on the
+     * timing wheel.  Fast forward to avoid an iteration over each skipped
+     * tick in the next _Watchdog_Tick().
+     */
+    next = _Watchdog_Wheel_next_expire( wheel );
+
+    if ( next > cpu->Watchdog.ticks + 1 ) {
+      next = cpu->Watchdog.ticks + 1;
+    }
+
+    if ( next > wheel->next ) {
+      wheel->next = next;
+    }
+  }
+}
+
+void _Watchdog_Tickless_tick( Per_CPU_Control *cpu )
+{
+  ISR_lock_Context lock_context;
+  uint64_t         now;
+  uint64_t         last;
+
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+
+  now = _Watchdog_Tickless_uptime();
+  last = cpu->Watchdog.tickless_last;
+
+  if ( last == 0 ) {
+    last = now;
+  } else {
+    uint64_t nanoseconds_per_tick;
+    uint64_t elapsed;
+
+    /* The rounding compensates the jitter of the interrupt latency */
+    nanoseconds_per_tick = _Watchdog_Nanoseconds_per_tick;
+    elapsed = ( now - last + nanoseconds_per_tick / 2 ) / nanoseconds_per_tick;
+
+    if ( elapsed > 1 ) {
+      _Watchdog_Skip_ticks( cpu, elapsed - 1 );
+    } else {
+      elapsed = 1;
+    }
+
+    last += elapsed * nanoseconds_per_tick;
+  }
+
+  cpu->Watchdog.tickless_last = last;
+
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+}
+
+uint64_t _Watchdog_Tickless_forward( Per_CPU_Control *cpu )
+{
+  uint64_t last;
+  uint64_t nanoseconds_per_tick;
+  uint64_t elapsed;
+
+  last = cpu->Watchdog.tickless_last;
+
+  if ( last == 0 ) {
+    return 0;
+  }
+
+  nanoseconds_per_tick = _Watchdog_Nanoseconds_per_tick;
+  elapsed = ( _Watchdog_Tickless_uptime() - last ) / nanoseconds_per_tick;
+
+  /* The last tick boundary is accounted by the next clock interrupt */
+  if ( elapsed > 1 ) {
+    _Watchdog_Skip_ticks( cpu, elapsed - 1 );
+    cpu->Watchdog.tickless_last = last
+      + ( elapsed - 1 ) * nanoseconds_per_tick;
+  }
+
+  return elapsed;
+}
+
+void _Watchdog_Tickless_wake_up( Per_CPU_Control *cpu )
+{
+  ISR_lock_Context lock_context;
+
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+#if defined(RTEMS_SMP)
+  cpu->Watchdog.sleep_until = 0;
+#endif
+  (void) _Watchdog_Tickless_forward( cpu );
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+}
+
+static uint64_t _Watchdog_Ticks_until_timespec(
+  const Watchdog_Header *header,
+  const struct timespec *now
+)
+{
+  Watchdog_Control *first;
+  uint64_t          expire;
+  uint64_t          seconds;
+  int64_t           nanoseconds;
+
+  first = _Watchdog_Header_first( header );
+
+  if ( first == NULL ) {
+    return WATCHDOG_MAXIMUM_TICKS;
+  }
+
+  expire = first->expire;
+
+  if ( expire <= _Watchdog_Ticks_from_timespec( now ) ) {
+    return 1;
+  }
+
+  seconds = ( expire >> WATCHDOG_BITS_FOR_1E9_NANOSECONDS )
+    - (uint64_t) now->tv_sec;
+
+  if ( seconds > UINT32_MAX ) {
+    return WATCHDOG_MAXIMUM_TICKS;
+  }
+
+  nanoseconds = (int64_t) seconds * WATCHDOG_NANOSECONDS_PER_SECOND
+    + (int64_t) (
+      expire & ( ( UINT64_C( 1 ) << WATCHDOG_BITS_FOR_1E9_NANOSECONDS ) - 1 )
+    )
+    - now->tv_nsec;
+
+  return ( (uint64_t) nanoseconds + _Watchdog_Nanoseconds_per_tick - 1 )
+    / _Watchdog_Nanoseconds_per_tick;
+}
+
+uint64_t _Watchdog_Ticks_until_next_expire( Per_CPU_Control *cpu )
+{
+  ISR_lock_Context  lock_context;
+  Watchdog_Header  *header;
+  uint64_t          ticks;
+  uint64_t          next;
+  uint64_t          expire;
+  struct timespec   now;
+
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+
+  /* Without a first tick, there is no reference for the ticks to sleep */
+  if ( cpu->Watchdog.tickless_last == 0 ) {
+    _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+    return 1;
+  }
+
+  ticks = cpu->Watchdog.ticks;
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ];
+
+  if ( header->wheel != NULL ) {
+    expire = _Watchdog_Wheel_next_expire( header->wheel );
+  } else {
+    Watchdog_Control *first;
+
+    first = _Watchdog_Header_first( header );
+
+    if ( first != NULL ) {
+      expire = first->expire;
+    } else {
+      expire = WATCHDOG_MAXIMUM_TICKS;
+    }
+  }
+
+  if ( expire == WATCHDOG_MAXIMUM_TICKS ) {
+    next = WATCHDOG_MAXIMUM_TICKS;
+  } else if ( expire > ticks ) {
+    next = expire - ticks;
+  } else {
+    next = 1;
+  }
+
+  /*
+   * The watchdogs of the clock based headers are processed by the first tick
+   * which observes a time point after their expiration time.
+   */
+  _Timecounter_Nanouptime( &now );
+  expire = _Watchdog_Ticks_until_timespec(
+    &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ],
+    &now
+  );
+
+  if ( expire < next ) {
+    next = expire;
+  }
+
+  _Timecounter_Nanotime( &now );
+  expire = _Watchdog_Ticks_until_timespec(
+    &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_REALTIME ],
+    &now
+  );
+
+  if ( expire < next ) {
+    next = expire;
+  }
+
+#if defined(RTEMS_SMP)
+  /*
+   * Publish the wake up time while the lock is held, so that a watchdog
+   * inserted by another processor afterwards interrupts this processor.
+   */
+  if ( next == WATCHDOG_MAXIMUM_TICKS ) {
+    cpu->Watchdog.sleep_until = WATCHDOG_MAXIMUM_TICKS;
+  } else {
+    cpu->Watchdog.sleep_until = ticks + next;
+  }
+#endif
+
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+
+  return next;
+}
@@ -0,0 +1,266 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreWatchdog
+ *
+ * @brief Watchdog Timing Wheel Implementation
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+
+#define WATCHDOG_WHEEL_SLOT_MASK ( WATCHDOG_WHEEL_SLOT_COUNT - 1 )
+
+static Chain_Control *_Watchdog_Wheel_slot(
+  Watchdog_Wheel *wheel,
+  uint64_t        expire
+)
+{
+  uint64_t next;
+  uint64_t delta;
+  uint32_t level;
+
+  next = wheel->next;
+
+  /* Watchdogs which already expired are processed by the next tick */
+  if ( expire < next ) {
+    expire = next;
+  }
+
+  delta = expire - next;
+
+  for ( level = 0; level < WATCHDOG_WHEEL_LEVEL_COUNT; ++level ) {
+    uint32_t shift;
+
+    shift = level * WATCHDOG_WHEEL_LEVEL_BITS;
+
+    if ( delta < ( (uint64_t) WATCHDOG_WHEEL_SLOT_COUNT << shift ) ) {
+      return &wheel->Slots[ level ][
+        ( expire >> shift ) & WATCHDOG_WHEEL_SLOT_MASK
+      ];
+    }
+  }
+
+  return &wheel->Far_future;
+}
+
+static void _Watchdog_Wheel_enqueue(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog
+)
+{
+  _Chain_Initialize_node( &the_watchdog->Node.Chain );
+  _Chain_Append_unprotected(
+    _Watchdog_Wheel_slot( wheel, the_watchdog->expire ),
+    &the_watchdog->Node.Chain
+  );
+}
+
+static void _Watchdog_Wheel_take(
+  Chain_Control *slot,
+  Chain_Control *watchdogs
+)
+{
+  _Chain_Initialize_empty( watchdogs );
+
+  if ( !_Chain_Is_empty( slot ) ) {
+    Chain_Node *first;
+    Chain_Node *last;
+
+    first = _Chain_First( slot );
+    last = _Chain_Last( slot );
+    first->previous = _Chain_Head( watchdogs );
+    _Chain_Head( watchdogs )->next = first;
+    last->next = _Chain_Tail( watchdogs );
+    _Chain_Tail( watchdogs )->previous = last;
+    _Chain_Initialize_empty( slot );
+  }
+}
+
+static void _Watchdog_Wheel_cascade(
+  Watchdog_Wheel *wheel,
+  Chain_Control  *slot
+)
+{
+  Chain_Control  watchdogs;
+  Chain_Node    *node;
+
+  /*
+   * Take the watchdogs first, since the watchdogs of the far future chain may
+   * end up on this chain again.
+   */
+  _Watchdog_Wheel_take( slot, &watchdogs );
+
+  while ( ( node = _Chain_Get_unprotected( &watchdogs ) ) != NULL ) {
+    _Watchdog_Wheel_enqueue( wheel, (Watchdog_Control *) node );
+  }
+}
+
+void _Watchdog_Wheel_insert(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog,
+  uint64_t          expire
+)
+{
+  _Assert( _Watchdog_Get_state( the_watchdog ) == WATCHDOG_INACTIVE );
+
+  the_watchdog->expire = expire;
+  _Watchdog_Wheel_enqueue( wheel, the_watchdog );
+  _Watchdog_Set_state( the_watchdog, WATCHDOG_SCHEDULED_BLACK );
+}
+
+void _Watchdog_Wheel_remove( Watchdog_Control *the_watchdog )
+{
+  if ( _Watchdog_Is_scheduled( the_watchdog ) ) {
+    _Chain_Extract_unprotected( &the_watchdog->Node.Chain );
+    _Watchdog_Set_state( the_watchdog, WATCHDOG_INACTIVE );
+  }
+}
+
+void _Watchdog_Wheel_do_tickle(
+  Watchdog_Wheel   *wheel,
+  uint64_t          now,
+#ifdef RTEMS_SMP
+  ISR_lock_Control *lock,
+#endif
+  ISR_lock_Context *lock_context
+)
+{
+  while ( wheel->next <= now ) {
+    Chain_Control  expired;
+    Chain_Node    *node;
+    uint64_t       ticks;
+    uint32_t       level;
+
+    ticks = wheel->next;
+    level = 0;
+
+    /*
+     * At the begin of the range of a slot of a higher level, move its
+     * watchdogs to the lower levels.
+     */
+    while (
+      level < WATCHDOG_WHEEL_LEVEL_COUNT
+        && ( ( ticks >> ( level * WATCHDOG_WHEEL_LEVEL_BITS ) )
+          & WATCHDOG_WHEEL_SLOT_MASK ) == 0
+    ) {
+      ++level;
+
+      if ( level < WATCHDOG_WHEEL_LEVEL_COUNT ) {
+        _Watchdog_Wheel_cascade(
+          wheel,
+          &wheel->Slots[ level ][
+            ( ticks >> ( level * WATCHDOG_WHEEL_LEVEL_BITS ) )
+              & WATCHDOG_WHEEL_SLOT_MASK
+          ]
+        );
+      } else {
+        _Watchdog_Wheel_cascade( wheel, &wheel->Far_future );
+      }
+    }
+
+    _Watchdog_Wheel_take(
+      &wheel->Slots[ 0 ][ ticks & WATCHDOG_WHEEL_SLOT_MASK ],
+      &expired
+    );
+    wheel->next = ticks + 1;
+
+    while ( ( node = _Chain_Get_unprotected( &expired ) ) != NULL ) {
+      Watchdog_Control               *the_watchdog;
+      Watchdog_Service_routine_entry  routine;
+
+      the_watchdog = (Watchdog_Control *) node;
+      _Watchdog_Set_state( the_watchdog, WATCHDOG_INACTIVE );
+      routine = the_watchdog->routine;
+
+      _ISR_lock_Release_and_ISR_enable( lock, lock_context );
+      ( *routine )( the_watchdog );
+      _ISR_lock_ISR_disable_and_acquire( lock, lock_context );
+    }
+  }
+}
+
+static uint64_t _Watchdog_Wheel_round_up( uint64_t ticks, uint32_t shift )
+{
+  return ( ticks + ( (uint64_t) 1 << shift ) - 1 ) >> shift;
+}
+
+uint64_t _Watchdog_Wheel_next_expire( const Watchdog_Wheel *wheel )
+{
+  uint64_t next;
+  uint64_t earliest;
+  uint32_t level;
+  uint32_t shift;
+
+  next = wheel->next;
+  earliest = WATCHDOG_MAXIMUM_TICKS;
+
+  /*
+   * The watchdogs of a slot expire not before the slot is processed.  For the
+   * higher levels this is the tick of the cascade of the slot.
+   */
+  for ( level = 0; level < WATCHDOG_WHEEL_LEVEL_COUNT; ++level ) {
+    uint64_t base;
+    uint32_t slot;
+
+    shift = level * WATCHDOG_WHEEL_LEVEL_BITS;
+    base = _Watchdog_Wheel_round_up( next, shift );
+
+    for ( slot = 0; slot < WATCHDOG_WHEEL_SLOT_COUNT; ++slot ) {
+      if ( !_Chain_Is_empty( &wheel->Slots[ level ][ slot ] ) ) {
+        uint64_t expire;
+
+        expire = base + ( ( slot - base ) & WATCHDOG_WHEEL_SLOT_MASK );
+        expire <<= shift;
+
+        if ( expire < earliest ) {
+          earliest = expire;
+        }
+      }
+    }
+  }
+
+  if ( !_Chain_Is_empty( &wheel->Far_future ) ) {
+    uint64_t expire;
+
+    shift = WATCHDOG_WHEEL_LEVEL_COUNT * WATCHDOG_WHEEL_LEVEL_BITS;
+    expire = _Watchdog_Wheel_round_up( next, shift ) << shift;
+
+    if ( expire < earliest ) {
+      earliest = expire;
+    }
+  }
+
+  return earliest;
+}
@@ -0,0 +1,292 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <fcntl.h>
+#include <sys/statvfs.h>
+#include <rtems/libio.h>
+#include <rtems/blkdev.h>
+#include <rtems/dosfs.h>
+#include <rtems/sparse-disk.h>
+
+#include <bsp.h>
+
+const char rtems_test_name[] = "FSDOSFSBITMAP 1";
+
+#define SECTOR_SIZE 512
+
+#define FAT12_MAX_CLN 4085
+
+static const char dev_name[] = "/dev/rda";
+
+static const char mount_dir[] = "/mnt";
+
+static char buf[4 * SECTOR_SIZE];
+
+static void mount_disk( bool free_cluster_bitmap )
+{
+  rtems_dosfs_mount_options mount_opts;
+  int                       rv;
+
+  memset( &mount_opts, 0, sizeof( mount_opts ) );
+  mount_opts.free_cluster_bitmap = free_cluster_bitmap;
+
+  rv = mount(
+    dev_name,
+    mount_dir,
+    RTEMS_FILESYSTEM_TYPE_DOSFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &mount_opts
+  );
+  rtems_test_assert( rv == 0 );
+}
+
+static void unmount_disk( void )
+{
+  int rv;
+
+  rv = unmount( mount_dir );
+  rtems_test_assert( rv == 0 );
+}
+
+static void wait_for_bitmap( void )
+{
+  rtems_status_code sc;
+  rtems_id          id;
+
+  /* The task which builds the bitmap exits once the bitmap is complete */
+  do {
+    sc = rtems_task_wake_after( 1 );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    sc = rtems_task_ident(
+      rtems_build_name( 'D', 'O', 'S', 'B' ),
+      RTEMS_SEARCH_LOCAL_NODE,
+      &id
+    );
+  } while ( sc == RTEMS_SUCCESSFUL );
+}
+
+static fsblkcnt_t get_free_clusters( void )
+{
+  struct statvfs sb;
+  int            rv;
+
+  rv = statvfs( mount_dir, &sb );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( sb.f_bfree == sb.f_bavail );
+
+  return sb.f_bfree;
+}
+
+static void write_file( const char *name, char c, size_t clusters )
+{
+  char    path[32];
+  int     fd;
+  int     rv;
+  size_t  i;
+  ssize_t n;
+
+  snprintf( path, sizeof( path ), "%s/%s", mount_dir, name );
+  memset( buf, c, SECTOR_SIZE );
+
+  fd = open( path, O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR );
+  rtems_test_assert( fd >= 0 );
+
+  for ( i = 0; i < clusters; ++i ) {
+    n = write( fd, buf, SECTOR_SIZE );
+    rtems_test_assert( n == SECTOR_SIZE );
+  }
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+}
+
+static void check_file( const char *name, char c, size_t clusters )
+{
+  char    path[32];
+  int     fd;
+  int     rv;
+  size_t  i;
+  ssize_t n;
+
+  snprintf( path, sizeof( path ), "%s/%s", mount_dir, name );
+
+  fd = open( path, O_RDONLY );
+  rtems_test_assert( fd >= 0 );
+
+  for ( i = 0; i < clusters; ++i ) {
+    size_t j;
+
+    n = read( fd, buf, SECTOR_SIZE );
+    rtems_test_assert( n == SECTOR_SIZE );
+
+    for ( j = 0; j < SECTOR_SIZE; ++j ) {
+      rtems_test_assert( buf[ j ] == c );
+    }
+  }
+
+  n = read( fd, buf, SECTOR_SIZE );
+  rtems_test_assert( n == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+}
+
+static void remove_file( const char *name )
+{
+  char path[32];
+  int  rv;
+
+  snprintf( path, sizeof( path ), "%s/%s", mount_dir, name );
+
+  rv = unlink( path );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_bitmap( rtems_blkdev_bnum media_block_count )
+{
+  msdos_format_request_param_t rqdata;
+  rtems_status_code            sc;
+  fsblkcnt_t                   free_cls;
+  int                          rv;
+
+  sc = rtems_sparse_disk_create_and_register(
+    dev_name,
+    SECTOR_SIZE,
+    1024,
+    media_block_count,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  memset( &rqdata, 0, sizeof( rqdata ) );
+  rqdata.sectors_per_cluster = 1;
+  rqdata.fat_num = 1;
+  rqdata.files_per_root_dir = 32;
+  rqdata.quick_format = true;
+  rqdata.skip_alignment = true;
+  rv = msdos_format( dev_name, &rqdata );
+  rtems_test_assert( rv == 0 );
+
+  /* Reference values from the FAT scan */
+  mount_disk( false );
+  free_cls = get_free_clusters();
+  write_file( "a", 'a', 4 );
+  rtems_test_assert( get_free_clusters() == free_cls - 4 );
+  unmount_disk();
+
+  /* Unmount while the bitmap is built */
+  mount_disk( true );
+  unmount_disk();
+
+  /* The bitmap must agree with the FAT */
+  mount_disk( true );
+  rtems_test_assert( get_free_clusters() == free_cls - 4 );
+  write_file( "b", 'b', 4 );
+  wait_for_bitmap();
+  rtems_test_assert( get_free_clusters() == free_cls - 8 );
+
+  /* Reuse the clusters of a removed file */
+  remove_file( "a" );
+  rtems_test_assert( get_free_clusters() == free_cls - 4 );
+  write_file( "c", 'c', 8 );
+  rtems_test_assert( get_free_clusters() == free_cls - 12 );
+  check_file( "b", 'b', 4 );
+  check_file( "c", 'c', 8 );
+  unmount_disk();
+
+  /* The FAT must agree with the bitmap */
+  mount_disk( false );
+  rtems_test_assert( get_free_clusters() == free_cls - 12 );
+  check_file( "b", 'b', 4 );
+  check_file( "c", 'c', 8 );
+  remove_file( "b" );
+  remove_file( "c" );
+  rtems_test_assert( get_free_clusters() == free_cls );
+  unmount_disk();
+
+  rv = unlink( dev_name );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test( void )
+{
+  int rv;
+
+  rv = mkdir( mount_dir, S_IRWXU | S_IRWXG | S_IRWXO );
+  rtems_test_assert( rv == 0 );
+
+  /* FAT12, the FAT chunk reads must stop at the end of the device */
+  test_bitmap( 32 );
+
+  /* FAT12 */
+  test_bitmap( 2880 );
+
+  /* FAT16 */
+  test_bitmap( 2 * FAT12_MAX_CLN );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+/* one active file + stdin + stdout + stderr + device file when mounted */
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_FILESYSTEM_DOSFS
+
+/* Init task + free cluster bitmap task */
+#define CONFIGURE_MAXIMUM_TASKS 2
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE ( 32 * 1024 )
+
+#define CONFIGURE_EXTRA_TASK_STACKS ( 2 * RTEMS_MINIMUM_STACK_SIZE )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
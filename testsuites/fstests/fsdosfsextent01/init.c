@@ -0,0 +1,577 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <rtems/libio.h>
+#include <rtems/blkdev.h>
+#include <rtems/dosfs.h>
+#include <rtems/sparse-disk.h>
+
+#include <bsp.h>
+
+const char rtems_test_name[] = "FSDOSFSEXTENT 1";
+
+#define SECTOR_SIZE 512
+
+#define CLUSTER_SIZE SECTOR_SIZE
+
+#define ROUNDS 16
+
+#define A_CLUSTERS_PER_ROUND 3
+
+#define B_CLUSTERS_PER_ROUND 2
+
+#define A_SIZE ( ROUNDS * A_CLUSTERS_PER_ROUND * CLUSTER_SIZE )
+
+#define B_SIZE ( ROUNDS * B_CLUSTERS_PER_ROUND * CLUSTER_SIZE )
+
+#define DIR_ENTRY_SIZE 32
+
+static const char dev_name[] = "/dev/rda";
+
+static const char mount_dir[] = "/mnt";
+
+static const char file_a[] = "/mnt/a";
+
+static const char file_b[] = "/mnt/b";
+
+static const char file_c[] = "/mnt/c";
+
+static const char file_fill[] = "/mnt/fill";
+
+static const char dir_d[] = "/mnt/d";
+
+static uint8_t buf[4 * CLUSTER_SIZE];
+
+static uint32_t random_state;
+
+static uint32_t next_random( void )
+{
+  random_state = random_state * 1664525 + 1013904223;
+
+  return random_state >> 8;
+}
+
+/*
+ * The pattern differs for the same offset within different clusters, so
+ * that a read from a wrong cluster is detected.
+ */
+static uint8_t pattern( int id, off_t offset )
+{
+  return (uint8_t) ( id + offset + ( offset / CLUSTER_SIZE ) * 13 );
+}
+
+static void fill( uint8_t *b, int id, off_t offset, size_t n )
+{
+  size_t i;
+
+  for ( i = 0; i < n; ++i ) {
+    b[ i ] = pattern( id, offset + (off_t) i );
+  }
+}
+
+static void check( const uint8_t *b, int id, off_t offset, size_t n )
+{
+  size_t i;
+
+  for ( i = 0; i < n; ++i ) {
+    rtems_test_assert( b[ i ] == pattern( id, offset + (off_t) i ) );
+  }
+}
+
+static void check_zero( const uint8_t *b, size_t n )
+{
+  size_t i;
+
+  for ( i = 0; i < n; ++i ) {
+    rtems_test_assert( b[ i ] == 0 );
+  }
+}
+
+static void write_at( int fd, int id, off_t offset, size_t n )
+{
+  off_t   off;
+  ssize_t m;
+
+  rtems_test_assert( n <= sizeof( buf ) );
+
+  off = lseek( fd, offset, SEEK_SET );
+  rtems_test_assert( off == offset );
+
+  fill( buf, id, offset, n );
+  m = write( fd, buf, n );
+  rtems_test_assert( m == (ssize_t) n );
+}
+
+static void read_at( int fd, off_t offset, size_t n )
+{
+  off_t   off;
+  ssize_t m;
+
+  rtems_test_assert( n <= sizeof( buf ) );
+
+  off = lseek( fd, offset, SEEK_SET );
+  rtems_test_assert( off == offset );
+
+  m = read( fd, buf, n );
+  rtems_test_assert( m == (ssize_t) n );
+}
+
+static off_t file_size( int fd )
+{
+  struct stat st;
+  int         rv;
+
+  rv = fstat( fd, &st );
+  rtems_test_assert( rv == 0 );
+
+  return st.st_size;
+}
+
+static fsblkcnt_t get_free_clusters( void )
+{
+  struct statvfs sb;
+  int            rv;
+
+  rv = statvfs( mount_dir, &sb );
+  rtems_test_assert( rv == 0 );
+
+  return sb.f_bfree;
+}
+
+/*
+ * Reads random ranges in random order, so that lookups hit, miss and evict
+ * entries of the extent cache.
+ */
+static void check_random( int fd, int id, off_t size )
+{
+  int i;
+
+  for ( i = 0; i < 256; ++i ) {
+    off_t  offset;
+    size_t n;
+
+    offset = (off_t) ( next_random() % (uint32_t) size );
+    n = 1 + next_random() % sizeof( buf );
+
+    if ( offset + (off_t) n > size ) {
+      n = (size_t) ( size - offset );
+    }
+
+    read_at( fd, offset, n );
+    check( buf, id, offset, n );
+  }
+}
+
+static void check_sequential( int fd, int id, off_t size )
+{
+  off_t offset;
+
+  for ( offset = 0; offset < size; offset += (off_t) sizeof( buf ) ) {
+    size_t n;
+
+    n = sizeof( buf );
+
+    if ( offset + (off_t) n > size ) {
+      n = (size_t) ( size - offset );
+    }
+
+    read_at( fd, offset, n );
+    check( buf, id, offset, n );
+  }
+
+  rtems_test_assert( file_size( fd ) == size );
+}
+
+/*
+ * Writes two files in alternation, so that each of them has more extents
+ * than the extent cache can hold.
+ */
+static void test_seek( int fd_a, int fd_b )
+{
+  int i;
+
+  for ( i = 0; i < ROUNDS; ++i ) {
+    int j;
+
+    for ( j = 0; j < A_CLUSTERS_PER_ROUND; ++j ) {
+      off_t offset;
+
+      offset = ( i * A_CLUSTERS_PER_ROUND + j ) * CLUSTER_SIZE;
+      write_at( fd_a, 'a', offset, CLUSTER_SIZE );
+    }
+
+    for ( j = 0; j < B_CLUSTERS_PER_ROUND; ++j ) {
+      off_t offset;
+
+      offset = ( i * B_CLUSTERS_PER_ROUND + j ) * CLUSTER_SIZE;
+      write_at( fd_b, 'b', offset, CLUSTER_SIZE );
+    }
+  }
+
+  check_random( fd_a, 'a', A_SIZE );
+  check_random( fd_b, 'b', B_SIZE );
+  check_sequential( fd_a, 'a', A_SIZE );
+  check_sequential( fd_b, 'b', B_SIZE );
+}
+
+static void test_extend( int fd_a, int fd_b )
+{
+  off_t hole;
+  off_t end;
+  int   rv;
+
+  /* Extend with a hole by a write beyond the end of file */
+  hole = A_SIZE + 5 * CLUSTER_SIZE + 100;
+  write_at( fd_a, 'a', hole, 10 );
+  rtems_test_assert( file_size( fd_a ) == hole + 10 );
+
+  read_at( fd_a, A_SIZE - 7, 7 );
+  check( buf, 'a', A_SIZE - 7, 7 );
+  read_at( fd_a, A_SIZE, sizeof( buf ) );
+  check_zero( buf, sizeof( buf ) );
+  read_at( fd_a, hole - 100, 110 );
+  check_zero( buf, 100 );
+  check( &buf[ 100 ], 'a', hole, 10 );
+
+  /* Extend by ftruncate() */
+  end = hole + 10 + 3 * CLUSTER_SIZE + 1;
+  rv = ftruncate( fd_a, end );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( file_size( fd_a ) == end );
+  read_at( fd_a, end - ( 3 * CLUSTER_SIZE + 1 ), 3 * CLUSTER_SIZE + 1 );
+  check_zero( buf, 3 * CLUSTER_SIZE + 1 );
+
+  /* Fill the hole and the extension with the pattern */
+  for ( hole = A_SIZE; hole < end; hole += CLUSTER_SIZE ) {
+    size_t n;
+
+    n = CLUSTER_SIZE;
+
+    if ( hole + (off_t) n > end ) {
+      n = (size_t) ( end - hole );
+    }
+
+    write_at( fd_a, 'a', hole, n );
+  }
+
+  check_random( fd_a, 'a', end );
+  check_sequential( fd_a, 'a', end );
+  check_sequential( fd_b, 'b', B_SIZE );
+}
+
+/*
+ * Truncates within an extent and lets another file reuse the released
+ * clusters.  A stale extent would map the truncated file into the other file.
+ */
+static void test_truncate( int fd_a, int fd_b )
+{
+  off_t   size;
+  off_t   offset;
+  int     fd_c;
+  int     rv;
+
+  size = file_size( fd_a );
+  check_random( fd_a, 'a', size );
+
+  rv = ftruncate( fd_a, A_CLUSTERS_PER_ROUND * CLUSTER_SIZE + 17 );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert(
+    file_size( fd_a ) == A_CLUSTERS_PER_ROUND * CLUSTER_SIZE + 17
+  );
+
+  fd_c = open( file_c, O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR );
+  rtems_test_assert( fd_c >= 0 );
+
+  for ( offset = 0; offset < size; offset += CLUSTER_SIZE ) {
+    write_at( fd_c, 'c', offset, CLUSTER_SIZE );
+  }
+
+  for (
+    offset = A_CLUSTERS_PER_ROUND * CLUSTER_SIZE + 17;
+    offset < size;
+    offset += CLUSTER_SIZE
+  ) {
+    size_t n;
+
+    n = CLUSTER_SIZE;
+
+    if ( offset + (off_t) n > size ) {
+      n = (size_t) ( size - offset );
+    }
+
+    write_at( fd_a, 'a', offset, n );
+  }
+
+  check_random( fd_a, 'a', size );
+  check_random( fd_c, 'c', ( size + CLUSTER_SIZE - 1 ) & ~( CLUSTER_SIZE - 1 ) );
+  check_sequential( fd_a, 'a', size );
+  check_sequential( fd_b, 'b', B_SIZE );
+
+  rv = close( fd_c );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( file_c );
+  rtems_test_assert( rv == 0 );
+
+  /* Truncate to zero and extend again */
+  rv = ftruncate( fd_b, 0 );
+  rtems_test_assert( rv == 0 );
+
+  for ( offset = 0; offset < B_SIZE; offset += CLUSTER_SIZE ) {
+    write_at( fd_b, 'b', offset, CLUSTER_SIZE );
+  }
+
+  check_random( fd_b, 'b', B_SIZE );
+  check_sequential( fd_a, 'a', size );
+}
+
+/*
+ * Extends a file and a directory on a full volume.  The failed and the
+ * partial extension must leave the cached extents consistent with the FAT.
+ */
+static void test_no_space( int fd_a, int fd_b )
+{
+  fsblkcnt_t free_cls;
+  fsblkcnt_t i;
+  off_t      size;
+  ssize_t    n;
+  char       path[32];
+  int        fd_fill;
+  int        files;
+  int        rv;
+
+  rv = mkdir( dir_d, S_IRWXU | S_IRWXG | S_IRWXO );
+  rtems_test_assert( rv == 0 );
+
+  free_cls = get_free_clusters();
+  rtems_test_assert( free_cls > 2 );
+
+  fd_fill = open( file_fill, O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR );
+  rtems_test_assert( fd_fill >= 0 );
+
+  for ( i = 0; i < free_cls - 2; ++i ) {
+    write_at( fd_fill, 'f', (off_t) i * CLUSTER_SIZE, CLUSTER_SIZE );
+  }
+
+  rtems_test_assert( get_free_clusters() == 2 );
+
+  /* Partial extension */
+  size = file_size( fd_a );
+  size = ( size + CLUSTER_SIZE - 1 ) & ~( CLUSTER_SIZE - 1 );
+  rv = ftruncate( fd_a, size );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( lseek( fd_a, size, SEEK_SET ) == size );
+  fill( buf, 'a', size, sizeof( buf ) );
+  n = write( fd_a, buf, sizeof( buf ) );
+  rtems_test_assert( n == 2 * CLUSTER_SIZE );
+  size += n;
+  rtems_test_assert( file_size( fd_a ) == size );
+  rtems_test_assert( get_free_clusters() == 0 );
+
+  /* Failed extension */
+  errno = 0;
+  n = write( fd_b, buf, 1 );
+  rtems_test_assert( n == -1 );
+  rtems_test_assert( errno == ENOSPC );
+  rtems_test_assert( file_size( fd_b ) == B_SIZE );
+
+  /* Failed directory extension */
+  rv = close( fd_fill );
+  rtems_test_assert( rv == 0 );
+
+  files = 0;
+
+  while ( true ) {
+    int fd;
+
+    snprintf( path, sizeof( path ), "%s/%i", dir_d, files );
+    errno = 0;
+    fd = open( path, O_RDWR | O_CREAT, S_IRUSR | S_IWUSR );
+
+    if ( fd < 0 ) {
+      rtems_test_assert( errno == ENOSPC );
+      break;
+    }
+
+    rv = close( fd );
+    rtems_test_assert( rv == 0 );
+
+    ++files;
+  }
+
+  rtems_test_assert( files > 0 );
+  rtems_test_assert( files <= CLUSTER_SIZE / DIR_ENTRY_SIZE );
+  rtems_test_assert( get_free_clusters() == 0 );
+
+  check_random( fd_a, 'a', size );
+  check_sequential( fd_a, 'a', size );
+  check_sequential( fd_b, 'b', B_SIZE );
+
+  /* Release the space and extend again */
+  rv = unlink( file_fill );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( get_free_clusters() == free_cls - 2 );
+
+  snprintf( path, sizeof( path ), "%s/%i", dir_d, files );
+  rv = open( path, O_RDWR | O_CREAT, S_IRUSR | S_IWUSR );
+  rtems_test_assert( rv >= 0 );
+  rv = close( rv );
+  rtems_test_assert( rv == 0 );
+
+  while ( files >= 0 ) {
+    snprintf( path, sizeof( path ), "%s/%i", dir_d, files );
+    rv = unlink( path );
+    rtems_test_assert( rv == 0 );
+    --files;
+  }
+
+  rv = rmdir( dir_d );
+  rtems_test_assert( rv == 0 );
+
+  write_at( fd_b, 'b', B_SIZE, CLUSTER_SIZE );
+  check_sequential( fd_b, 'b', B_SIZE + CLUSTER_SIZE );
+  check_sequential( fd_a, 'a', size );
+}
+
+static void test( void )
+{
+  msdos_format_request_param_t rqdata;
+  rtems_status_code            sc;
+  fsblkcnt_t                   free_cls;
+  int                          fd_a;
+  int                          fd_b;
+  int                          rv;
+
+  random_state = 1;
+
+  rv = mkdir( mount_dir, S_IRWXU | S_IRWXG | S_IRWXO );
+  rtems_test_assert( rv == 0 );
+
+  sc = rtems_sparse_disk_create_and_register(
+    dev_name,
+    SECTOR_SIZE,
+    1024,
+    2880,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  memset( &rqdata, 0, sizeof( rqdata ) );
+  rqdata.sectors_per_cluster = 1;
+  rqdata.fat_num = 1;
+  rqdata.files_per_root_dir = 32;
+  rqdata.quick_format = true;
+  rqdata.skip_alignment = true;
+  rv = msdos_format( dev_name, &rqdata );
+  rtems_test_assert( rv == 0 );
+
+  rv = mount(
+    dev_name,
+    mount_dir,
+    RTEMS_FILESYSTEM_TYPE_DOSFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert( rv == 0 );
+
+  free_cls = get_free_clusters();
+
+  fd_a = open( file_a, O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR );
+  rtems_test_assert( fd_a >= 0 );
+
+  fd_b = open( file_b, O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR );
+  rtems_test_assert( fd_b >= 0 );
+
+  test_seek( fd_a, fd_b );
+  test_extend( fd_a, fd_b );
+  test_truncate( fd_a, fd_b );
+  test_no_space( fd_a, fd_b );
+
+  rv = close( fd_a );
+  rtems_test_assert( rv == 0 );
+
+  rv = close( fd_b );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( file_a );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( file_b );
+  rtems_test_assert( rv == 0 );
+
+  rtems_test_assert( get_free_clusters() == free_cls );
+
+  rv = unmount( mount_dir );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( dev_name );
+  rtems_test_assert( rv == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+/*
+ * three active files + stdin + stdout + stderr + device file when mounted
+ */
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 7
+
+#define CONFIGURE_FILESYSTEM_DOSFS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE ( 32 * 1024 )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,287 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <rtems/libio.h>
+#include <rtems/blkdev.h>
+#include <rtems/dosfs.h>
+#include <rtems/sparse-disk.h>
+
+#include <bsp.h>
+
+const char rtems_test_name[] = "FSDOSFSNAMECACHE 1";
+
+#define SECTOR_SIZE 512
+
+#define FILE_COUNT 100
+
+static const char dev_name[] = "/dev/rda";
+
+static const char mount_dir[] = "/mnt";
+
+static void make_path( char *path, size_t size, const char *dir, int i )
+{
+  /* Even files get a short name, odd files get a long name */
+  if ( ( i % 2 ) == 0 ) {
+    snprintf( path, size, "%s/%s/f%d.txt", mount_dir, dir, i );
+  } else {
+    snprintf( path, size, "%s/%s/Log File %d.txt", mount_dir, dir, i );
+  }
+}
+
+static void create_file( const char *dir, int i )
+{
+  char path[64];
+  int  fd;
+  int  rv;
+
+  make_path( path, sizeof( path ), dir, i );
+
+  fd = open( path, O_WRONLY | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR );
+  rtems_test_assert( fd >= 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+}
+
+static void check_file( const char *dir, int i, bool exists )
+{
+  struct stat st;
+  char        path[64];
+  int         rv;
+
+  make_path( path, sizeof( path ), dir, i );
+
+  errno = 0;
+  rv = stat( path, &st );
+
+  if ( exists ) {
+    rtems_test_assert( rv == 0 );
+    rtems_test_assert( S_ISREG( st.st_mode ) );
+  } else {
+    rtems_test_assert( rv == -1 );
+    rtems_test_assert( errno == ENOENT );
+  }
+}
+
+static void remove_file( const char *dir, int i )
+{
+  char path[64];
+  int  rv;
+
+  make_path( path, sizeof( path ), dir, i );
+
+  rv = unlink( path );
+  rtems_test_assert( rv == 0 );
+}
+
+static void make_dir( const char *dir )
+{
+  char path[64];
+  int  rv;
+
+  snprintf( path, sizeof( path ), "%s/%s", mount_dir, dir );
+
+  rv = mkdir( path, S_IRWXU );
+  rtems_test_assert( rv == 0 );
+}
+
+static void remove_dir( const char *dir )
+{
+  char path[64];
+  int  rv;
+
+  snprintf( path, sizeof( path ), "%s/%s", mount_dir, dir );
+
+  rv = rmdir( path );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_name_cache( void )
+{
+  char old_path[64];
+  char new_path[64];
+  int  rv;
+  int  i;
+
+  make_dir( "logs" );
+
+  /* The name cache is built by the first lookup */
+  for ( i = 0; i < FILE_COUNT / 2; ++i ) {
+    create_file( "logs", i );
+  }
+
+  check_file( "logs", 0, true );
+
+  /* Created files are added to the name cache */
+  for ( i = FILE_COUNT / 2; i < FILE_COUNT; ++i ) {
+    create_file( "logs", i );
+  }
+
+  for ( i = 0; i < FILE_COUNT; ++i ) {
+    check_file( "logs", i, true );
+  }
+
+  check_file( "logs", FILE_COUNT, false );
+  check_file( "logs", FILE_COUNT + 1, false );
+
+  /* Lookups are case insensitive */
+  snprintf( old_path, sizeof( old_path ), "%s/logs/LOG FILE 1.TXT", mount_dir );
+  rv = access( old_path, F_OK );
+  rtems_test_assert( rv == 0 );
+
+  /* Removed files must not be found */
+  for ( i = 0; i < FILE_COUNT; i += 3 ) {
+    remove_file( "logs", i );
+  }
+
+  for ( i = 0; i < FILE_COUNT; ++i ) {
+    check_file( "logs", i, ( i % 3 ) != 0 );
+  }
+
+  /* Renamed files are found by the new name only */
+  make_path( old_path, sizeof( old_path ), "logs", 1 );
+  make_path( new_path, sizeof( new_path ), "logs", FILE_COUNT + 1 );
+  rv = rename( old_path, new_path );
+  rtems_test_assert( rv == 0 );
+  check_file( "logs", 1, false );
+  check_file( "logs", FILE_COUNT + 1, true );
+
+  /* A new directory may reuse the cluster of a removed directory */
+  make_dir( "tmp" );
+  create_file( "tmp", 1 );
+  check_file( "tmp", 1, true );
+  remove_file( "tmp", 1 );
+  remove_dir( "tmp" );
+  make_dir( "new" );
+  check_file( "new", 1, false );
+  create_file( "new", 2 );
+  check_file( "new", 2, true );
+}
+
+static void test( void )
+{
+  rtems_dosfs_mount_options    mount_opts;
+  msdos_format_request_param_t rqdata;
+  rtems_status_code            sc;
+  int                          rv;
+
+  rv = mkdir( mount_dir, S_IRWXU | S_IRWXG | S_IRWXO );
+  rtems_test_assert( rv == 0 );
+
+  sc = rtems_sparse_disk_create_and_register(
+    dev_name,
+    SECTOR_SIZE,
+    1024,
+    2880,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  memset( &rqdata, 0, sizeof( rqdata ) );
+  rqdata.sectors_per_cluster = 1;
+  rqdata.fat_num = 1;
+  rqdata.files_per_root_dir = 32;
+  rqdata.quick_format = true;
+  rqdata.skip_alignment = true;
+  rv = msdos_format( dev_name, &rqdata );
+  rtems_test_assert( rv == 0 );
+
+  memset( &mount_opts, 0, sizeof( mount_opts ) );
+  mount_opts.name_cache = true;
+
+  rv = mount(
+    dev_name,
+    mount_dir,
+    RTEMS_FILESYSTEM_TYPE_DOSFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &mount_opts
+  );
+  rtems_test_assert( rv == 0 );
+
+  test_name_cache();
+
+  rv = unmount( mount_dir );
+  rtems_test_assert( rv == 0 );
+
+  /* The directories must be the same without the name cache */
+  rv = mount(
+    dev_name,
+    mount_dir,
+    RTEMS_FILESYSTEM_TYPE_DOSFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert( rv == 0 );
+
+  check_file( "logs", 2, true );
+  check_file( "logs", 3, false );
+  check_file( "logs", FILE_COUNT + 1, true );
+  check_file( "new", 2, true );
+
+  rv = unmount( mount_dir );
+  rtems_test_assert( rv == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+/* one active file + stdin + stdout + stderr + device file when mounted */
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_FILESYSTEM_DOSFS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE ( 32 * 1024 )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,208 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/imfs.h>
+
+const char rtems_test_name[] = "FSIMFSCONFIG 4";
+
+#define INDEX_THRESHOLD 8
+
+#define FILE_COUNT 100
+
+static void make_name(char *name, size_t size, const char *prefix, int i)
+{
+  int n;
+
+  n = snprintf(name, size, "%s%03i", prefix, i);
+  rtems_test_assert(n > 0 && (size_t) n < size);
+}
+
+static void create_file(const char *name)
+{
+  int fd;
+  int rv;
+
+  fd = creat(name, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void check_exists(const char *name, bool exists)
+{
+  struct stat st;
+  int rv;
+
+  errno = 0;
+  rv = stat(name, &st);
+
+  if (exists) {
+    rtems_test_assert(rv == 0);
+  } else {
+    rtems_test_assert(rv == -1);
+    rtems_test_assert(errno == ENOENT);
+  }
+}
+
+static void check_read_order(const char *path, const char *prefix, int count)
+{
+  struct dirent *de;
+  DIR *dir;
+  int i;
+
+  dir = opendir(path);
+  rtems_test_assert(dir != NULL);
+
+  i = 0;
+
+  while ((de = readdir(dir)) != NULL) {
+    char name[16];
+
+    if (strcmp(de->d_name, ".") == 0 || strcmp(de->d_name, "..") == 0) {
+      continue;
+    }
+
+    make_name(name, sizeof(name), prefix, i);
+    rtems_test_assert(strcmp(de->d_name, name) == 0);
+    ++i;
+  }
+
+  rtems_test_assert(i == count);
+  closedir(dir);
+}
+
+static void test_directory_index(void)
+{
+  const IMFS_directory_t *dir;
+  struct stat st;
+  char name[16];
+  char new_name[16];
+  int rv;
+  int i;
+
+  rv = mkdir("dir", S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  rv = chdir("dir");
+  rtems_test_assert(rv == 0);
+
+  rv = stat(".", &st);
+  rtems_test_assert(rv == 0);
+  dir = (const IMFS_directory_t *) (uintptr_t) st.st_ino;
+
+  for (i = 0; i < INDEX_THRESHOLD - 1; ++i) {
+    make_name(name, sizeof(name), "f", i);
+    create_file(name);
+  }
+
+  rtems_test_assert(dir->entry_count == INDEX_THRESHOLD - 1);
+  rtems_test_assert(dir->Index == NULL);
+
+  for (i = INDEX_THRESHOLD - 1; i < FILE_COUNT; ++i) {
+    make_name(name, sizeof(name), "f", i);
+    create_file(name);
+  }
+
+  rtems_test_assert(dir->entry_count == FILE_COUNT);
+  rtems_test_assert(dir->Index != NULL);
+  rtems_test_assert(dir->index_size >= 2 * INDEX_THRESHOLD);
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    make_name(name, sizeof(name), "f", i);
+    check_exists(name, true);
+  }
+
+  check_exists("f", false);
+  check_exists("f1000", false);
+  check_read_order(".", "f", FILE_COUNT);
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    make_name(name, sizeof(name), "f", i);
+    make_name(new_name, sizeof(new_name), "g", i);
+    rv = rename(name, new_name);
+    rtems_test_assert(rv == 0);
+    check_exists(name, false);
+    check_exists(new_name, true);
+  }
+
+  check_read_order(".", "g", FILE_COUNT);
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    make_name(name, sizeof(name), "g", i);
+    rv = unlink(name);
+    rtems_test_assert(rv == 0);
+    check_exists(name, false);
+  }
+
+  rtems_test_assert(dir->entry_count == 0);
+  rtems_test_assert(dir->Index == NULL);
+
+  rv = chdir("..");
+  rtems_test_assert(rv == 0);
+
+  rv = rmdir("dir");
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+  test_directory_index();
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_IMFS_DIRECTORY_INDEX_THRESHOLD INDEX_THRESHOLD
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
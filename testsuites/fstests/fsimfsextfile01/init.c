@@ -0,0 +1,284 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/imfs.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSIMFSEXTFILE 1";
+
+#define GRANULE 4096
+
+#define CHUNK_SIZE 1000
+
+#define CHUNK_COUNT 100
+
+static uint8_t buf[CHUNK_SIZE];
+
+static uint8_t pattern(size_t offset)
+{
+  return (uint8_t) (offset * 7 + offset / 251);
+}
+
+static const IMFS_extfile_t *get_extfile(int fd)
+{
+  struct stat st;
+  int rv;
+
+  rv = fstat(fd, &st);
+  rtems_test_assert(rv == 0);
+
+  return (const IMFS_extfile_t *) (uintptr_t) st.st_ino;
+}
+
+static void write_chunks(int fd)
+{
+  size_t offset;
+  int i;
+
+  offset = 0;
+
+  for (i = 0; i < CHUNK_COUNT; ++i) {
+    ssize_t n;
+    size_t j;
+
+    for (j = 0; j < sizeof(buf); ++j) {
+      buf[j] = pattern(offset + j);
+    }
+
+    n = write(fd, buf, sizeof(buf));
+    rtems_test_assert(n == (ssize_t) sizeof(buf));
+    offset += sizeof(buf);
+  }
+}
+
+static void check_chunks(int fd, size_t size)
+{
+  size_t offset;
+  off_t pos;
+
+  pos = lseek(fd, 0, SEEK_SET);
+  rtems_test_assert(pos == 0);
+
+  offset = 0;
+
+  while (offset < size) {
+    ssize_t n;
+    size_t j;
+
+    n = read(fd, buf, sizeof(buf));
+    rtems_test_assert(n > 0);
+
+    for (j = 0; j < (size_t) n; ++j) {
+      rtems_test_assert(buf[j] == pattern(offset + j));
+    }
+
+    offset += (size_t) n;
+  }
+
+  rtems_test_assert(offset == size);
+  rtems_test_assert(read(fd, buf, sizeof(buf)) == 0);
+}
+
+static void check_zero(int fd, off_t offset, size_t count)
+{
+  off_t pos;
+  ssize_t n;
+  size_t i;
+
+  rtems_test_assert(count <= sizeof(buf));
+
+  pos = lseek(fd, offset, SEEK_SET);
+  rtems_test_assert(pos == offset);
+
+  n = read(fd, buf, count);
+  rtems_test_assert(n == (ssize_t) count);
+
+  for (i = 0; i < count; ++i) {
+    rtems_test_assert(buf[i] == 0);
+  }
+}
+
+static void test_extent_file(const char *path, size_t granule)
+{
+  const IMFS_extfile_t *extfile;
+  size_t size;
+  size_t i;
+  off_t pos;
+  ssize_t n;
+  int rv;
+  int fd;
+
+  fd = open(path, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  extfile = get_extfile(fd);
+  rtems_test_assert(extfile->extent_count == 0);
+
+  write_chunks(fd);
+  size = CHUNK_COUNT * CHUNK_SIZE;
+  rtems_test_assert(extfile->File.size == size);
+  rtems_test_assert(extfile->capacity >= size);
+
+  for (i = 0; i < extfile->extent_count; ++i) {
+    rtems_test_assert(extfile->extents[i].size % granule == 0);
+  }
+
+  /* Each extent at least doubles the capacity */
+  rtems_test_assert(extfile->extent_count <= 8);
+
+  check_chunks(fd, size);
+
+  /* Write across an extent boundary */
+  pos = lseek(fd, (off_t) extfile->extents[0].size - 10, SEEK_SET);
+  rtems_test_assert(pos == (off_t) extfile->extents[0].size - 10);
+  memset(buf, 0, 20);
+  n = write(fd, buf, 20);
+  rtems_test_assert(n == 20);
+  check_zero(fd, (off_t) extfile->extents[0].size - 10, 20);
+
+  /* Write after the end fills the gap with zeros */
+  pos = lseek(fd, (off_t) size + 100, SEEK_SET);
+  rtems_test_assert(pos == (off_t) size + 100);
+  buf[0] = 0xff;
+  n = write(fd, buf, 1);
+  rtems_test_assert(n == 1);
+  rtems_test_assert(extfile->File.size == size + 101);
+  check_zero(fd, (off_t) size, 100);
+
+  /* Shrink and grow again */
+  rv = ftruncate(fd, 10);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(extfile->File.size == 10);
+  rtems_test_assert(extfile->extent_count == 1);
+
+  rv = ftruncate(fd, 2 * GRANULE);
+  rtems_test_assert(rv == 0);
+  check_zero(fd, 10, CHUNK_SIZE);
+
+  rv = ftruncate(fd, 0);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(extfile->extent_count == 0);
+  rtems_test_assert(extfile->capacity == 0);
+
+  /* Append mode */
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  fd = open(path, O_RDWR | O_APPEND);
+  rtems_test_assert(fd >= 0);
+
+  write_chunks(fd);
+  check_chunks(fd, size);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(path);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  const char *mnt = "mnt";
+  int rv;
+
+  TEST_BEGIN();
+
+  test_extent_file("root", IMFS_EXTFILE_DEFAULT_GRANULE);
+
+  rv = mkdir(mnt, S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  errno = 0;
+  rv = mount(
+    "",
+    mnt,
+    RTEMS_FILESYSTEM_TYPE_IMFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    "extent-files,blocks"
+  );
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  errno = 0;
+  rv = mount(
+    "",
+    mnt,
+    RTEMS_FILESYSTEM_TYPE_IMFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    "extent-granule=4k"
+  );
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  rv = mount(
+    "",
+    mnt,
+    RTEMS_FILESYSTEM_TYPE_IMFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    "extent-files,extent-granule=" RTEMS_XSTRING(GRANULE)
+  );
+  rtems_test_assert(rv == 0);
+
+  test_extent_file("mnt/file", GRANULE);
+
+  rv = unmount(mnt);
+  rtems_test_assert(rv == 0);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_FILESYSTEM_IMFS
+
+#define CONFIGURE_IMFS_ENABLE_EXTENT_FILES
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
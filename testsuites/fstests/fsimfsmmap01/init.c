@@ -0,0 +1,311 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/imfs.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSIMFSMMAP 1";
+
+#define PROT_RW (PROT_READ | PROT_WRITE)
+
+static char linear_data[] = "Linear file image";
+
+static uint8_t buf[3000];
+
+static const IMFS_extfile_t *get_extfile(int fd)
+{
+  struct stat st;
+  int rv;
+
+  rv = fstat(fd, &st);
+  rtems_test_assert(rv == 0);
+
+  return (const IMFS_extfile_t *) (uintptr_t) st.st_ino;
+}
+
+static void test_linear_file(void)
+{
+  const char *path = "linear";
+  char *p;
+  int rv;
+  int fd;
+
+  rv = IMFS_make_linearfile(
+    path,
+    S_IRWXU,
+    linear_data,
+    sizeof(linear_data)
+  );
+  rtems_test_assert(rv == 0);
+
+  fd = open(path, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  /* The file image may be read-only */
+  errno = 0;
+  rtems_test_assert(
+    mmap(NULL, sizeof(linear_data), PROT_RW, MAP_SHARED, fd, 0) == MAP_FAILED
+  );
+  rtems_test_assert(errno == EACCES);
+
+  p = mmap(NULL, sizeof(linear_data), PROT_READ, MAP_SHARED, fd, 0);
+  rtems_test_assert(p == &linear_data[0]);
+
+  errno = 0;
+  rtems_test_assert(
+    mmap(NULL, sizeof(linear_data), PROT_READ, MAP_SHARED, fd, 1) == MAP_FAILED
+  );
+  rtems_test_assert(errno == EOVERFLOW);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  /* The copy on write of a writeable open is refused while mapped */
+  errno = 0;
+  fd = open(path, O_RDWR);
+  rtems_test_assert(fd == -1);
+  rtems_test_assert(errno == ETXTBSY);
+
+  rtems_test_assert(strcmp(p, "Linear file image") == 0);
+
+  rv = msync(p, sizeof(linear_data), MS_SYNC);
+  rtems_test_assert(rv == 0);
+
+  rv = msync(p + 1, sizeof(linear_data) - 1, MS_ASYNC | MS_INVALIDATE);
+  rtems_test_assert(rv == 0);
+
+  errno = 0;
+  rv = msync(p, sizeof(linear_data), MS_SYNC | MS_ASYNC);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  errno = 0;
+  rv = msync(p, sizeof(linear_data) + 1, MS_SYNC);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == ENOMEM);
+
+  rv = munmap(p, sizeof(linear_data));
+  rtems_test_assert(rv == 0);
+
+  errno = 0;
+  rv = msync(p, sizeof(linear_data), MS_SYNC);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == ENOMEM);
+
+  /* The copy on write is possible after the last unmap */
+  fd = open(path, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(path);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_extent_file(void)
+{
+  const IMFS_extfile_t *extfile;
+  const char *path = "extent";
+  uint8_t *p;
+  uint8_t *p2;
+  ssize_t n;
+  off_t pos;
+  int rv;
+  int fd;
+
+  fd = open(path, O_RDWR | O_CREAT, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  extfile = get_extfile(fd);
+
+  memset(buf, 0xaa, sizeof(buf));
+  n = write(fd, buf, sizeof(buf));
+  rtems_test_assert(n == (ssize_t) sizeof(buf));
+  rtems_test_assert(extfile->extent_count == 1);
+
+  p = mmap(NULL, sizeof(buf), PROT_RW, MAP_SHARED, fd, 0);
+  rtems_test_assert(p == extfile->extents[0].data);
+
+  /* Changes are visible through both the mapping and the file */
+  p[0] = 0x55;
+
+  pos = lseek(fd, 0, SEEK_SET);
+  rtems_test_assert(pos == 0);
+  n = read(fd, buf, 1);
+  rtems_test_assert(n == 1);
+  rtems_test_assert(buf[0] == 0x55);
+
+  buf[0] = 0x11;
+  n = write(fd, buf, 1);
+  rtems_test_assert(n == 1);
+  rtems_test_assert(p[1] == 0x11);
+
+  /* Growing the file does not move the mapped extent */
+  pos = lseek(fd, 0, SEEK_END);
+  rtems_test_assert(pos == (off_t) sizeof(buf));
+  n = write(fd, buf, sizeof(buf));
+  rtems_test_assert(n == (ssize_t) sizeof(buf));
+  rtems_test_assert(extfile->extent_count == 2);
+  rtems_test_assert(p == extfile->extents[0].data);
+
+  /* A range across two extents cannot be mapped without a copy */
+  errno = 0;
+  rtems_test_assert(
+    mmap(NULL, 2 * sizeof(buf), PROT_RW, MAP_SHARED, fd, 0) == MAP_FAILED
+  );
+  rtems_test_assert(errno == ENOTSUP);
+
+  /* Truncation keeps the extents of a mapped file */
+  rv = ftruncate(fd, 0);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(extfile->extent_count == 2);
+  rtems_test_assert(p[0] == 0x55);
+
+  /* The last unmap frees the extents beyond the end of file */
+  pos = lseek(fd, 0, SEEK_SET);
+  rtems_test_assert(pos == 0);
+  buf[0] = 0x55;
+  n = write(fd, buf, 1);
+  rtems_test_assert(n == 1);
+  p2 = mmap(NULL, 1, PROT_RW, MAP_SHARED, fd, 0);
+  rtems_test_assert(p2 == p);
+  rtems_test_assert(extfile->map_count == 2);
+
+  rv = munmap(p, sizeof(buf));
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(extfile->map_count == 1);
+  rtems_test_assert(extfile->extent_count == 2);
+
+  rv = munmap(p2, 1);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(extfile->map_count == 0);
+  rtems_test_assert(extfile->extent_count == 1);
+
+  p = mmap(NULL, 1, PROT_RW, MAP_SHARED, fd, 0);
+  rtems_test_assert(p == extfile->extents[0].data);
+
+  /* The mapping keeps the file after close() and unlink() */
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(path);
+  rtems_test_assert(rv == 0);
+
+  rtems_test_assert(extfile->File.Node.reference_count == 1);
+  rtems_test_assert(p[0] == 0x55);
+
+  rv = msync(p, 1, MS_SYNC);
+  rtems_test_assert(rv == 0);
+
+  rv = munmap(p, 1);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_memfile(void)
+{
+  const char *mnt = "mnt";
+  const char *path = "mnt/file";
+  ssize_t n;
+  int rv;
+  int fd;
+
+  rv = mkdir(mnt, S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  rv = mount(
+    "",
+    mnt,
+    RTEMS_FILESYSTEM_TYPE_IMFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+
+  fd = open(path, O_RDWR | O_CREAT, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  n = write(fd, buf, sizeof(buf));
+  rtems_test_assert(n == (ssize_t) sizeof(buf));
+
+  /* Block based memfiles are not contiguous */
+  errno = 0;
+  rtems_test_assert(
+    mmap(NULL, sizeof(buf), PROT_RW, MAP_SHARED, fd, 0) == MAP_FAILED
+  );
+  rtems_test_assert(errno == ENOTSUP);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(path);
+  rtems_test_assert(rv == 0);
+
+  rv = unmount(mnt);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+  test_linear_file();
+  test_extent_file();
+  test_memfile();
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_FILESYSTEM_IMFS
+
+#define CONFIGURE_IMFS_ENABLE_EXTENT_FILES
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -147,6 +147,7 @@ rtems_rfs_bitmap_ut_test_bitmap (size_t size)
   bool                     result;
   size_t                   bytes;
   size_t                   clear;
+  size_t                   count;
   int                      rc;
 
   bytes = (rtems_rfs_bitmap_elements (size) *
@@ -446,6 +447,25 @@ rtems_rfs_bitmap_ut_test_bitmap (size_t size)
   rtems_test_assert( rc == 0 );
   rtems_test_assert( control.free == control.size - 1);
 
+  /* Allocate runs of bits, a run stops at a set bit or the end of the map */
+  printf (" 36. Allocate runs of bits.\n");
+  rc = rtems_rfs_bitmap_map_set(&control, 40);
+  rtems_test_assert( rc == 0 );
+  rc = rtems_rfs_bitmap_map_alloc_run(&control, 0, 64, &count, &bit);
+  rtems_test_assert( rc == 0 );
+  rtems_test_assert( bit == 1 && count == 39 );
+  rc = rtems_rfs_bitmap_map_alloc_run(&control, 0, 64, &count, &bit);
+  rtems_test_assert( rc == 0 );
+  rtems_test_assert( bit == 41 && count == 64 );
+  rc = rtems_rfs_bitmap_map_alloc_run(&control, size - 10, 64, &count, &bit);
+  rtems_test_assert( rc == 0 );
+  rtems_test_assert( bit == size - 10 && count == 10 );
+  rtems_test_assert( control.free == control.size - 1 - 1 - 39 - 64 - 10);
+  rtems_test_assert( rtems_rfs_bitmap_ut_test_range (&control, 36, true,
+                                                     0, 105) );
+  rc = rtems_rfs_bitmap_map_test(&control, 105, &result);
+  rtems_test_assert( rc == 0 && !result );
+
   rtems_rfs_bitmap_close (&control);
   free (buffer.buffer);
 }
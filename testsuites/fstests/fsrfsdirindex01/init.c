@@ -0,0 +1,310 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <rtems/libio.h>
+#include <rtems/rtems-rfs-format.h>
+#include <rtems/sparse-disk.h>
+
+#include <bsp.h>
+
+const char rtems_test_name[] = "FSRFSDIRINDEX 1";
+
+#define BLOCK_SIZE 512
+
+#define BLOCK_COUNT 8192
+
+#define FILE_COUNT 1000
+
+/*
+ * More entries than the index of a directory with 512 byte blocks can hold.
+ */
+#define LINK_COUNT 4000
+
+static const char dev_name[] = "/dev/rda";
+
+static const char mount_dir[] = "/mnt";
+
+static const char dir_path[] = "/mnt/dir";
+
+static const char file_path[] = "/mnt/file";
+
+static void format_and_mount( bool dir_index )
+{
+  rtems_rfs_format_config config;
+  rtems_status_code       sc;
+  int                     rv;
+
+  sc = rtems_sparse_disk_create_and_register(
+    dev_name,
+    BLOCK_SIZE,
+    1024,
+    BLOCK_COUNT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  memset( &config, 0, sizeof( config ) );
+  config.block_size = BLOCK_SIZE;
+  config.group_inodes = 1024;
+  config.dir_index = dir_index;
+  rv = rtems_rfs_format( dev_name, &config );
+  rtems_test_assert( rv == 0 );
+
+  rv = mount(
+    dev_name,
+    mount_dir,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert( rv == 0 );
+}
+
+static void unmount_and_remove( void )
+{
+  int rv;
+
+  rv = unmount( mount_dir );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( dev_name );
+  rtems_test_assert( rv == 0 );
+}
+
+static void remount( void )
+{
+  int rv;
+
+  rv = unmount( mount_dir );
+  rtems_test_assert( rv == 0 );
+
+  rv = mount(
+    dev_name,
+    mount_dir,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert( rv == 0 );
+}
+
+static void make_path( char *path, size_t size, size_t i )
+{
+  snprintf( path, size, "%s/f%05zu", dir_path, i );
+}
+
+static size_t count_entries( void )
+{
+  struct dirent *de;
+  DIR           *dir;
+  size_t         count;
+  int            rv;
+
+  dir = opendir( dir_path );
+  rtems_test_assert( dir != NULL );
+
+  count = 0;
+
+  while ( ( de = readdir( dir ) ) != NULL ) {
+    if ( strcmp( de->d_name, "." ) != 0 && strcmp( de->d_name, ".." ) != 0 ) {
+      ++count;
+    }
+  }
+
+  rv = closedir( dir );
+  rtems_test_assert( rv == 0 );
+
+  return count;
+}
+
+static void test_files( void )
+{
+  char        path[32];
+  struct stat st;
+  size_t      i;
+  int         rv;
+  int         fd;
+
+  rv = mkdir( dir_path, S_IRWXU );
+  rtems_test_assert( rv == 0 );
+
+  for ( i = 0; i < FILE_COUNT; ++i ) {
+    make_path( path, sizeof( path ), i );
+    fd = open( path, O_WRONLY | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR );
+    rtems_test_assert( fd >= 0 );
+    rv = close( fd );
+    rtems_test_assert( rv == 0 );
+  }
+
+  remount();
+
+  for ( i = 0; i < FILE_COUNT; ++i ) {
+    make_path( path, sizeof( path ), i );
+    rv = stat( path, &st );
+    rtems_test_assert( rv == 0 );
+    rtems_test_assert( S_ISREG( st.st_mode ) );
+  }
+
+  make_path( path, sizeof( path ), FILE_COUNT );
+  errno = 0;
+  rv = stat( path, &st );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == ENOENT );
+
+  rtems_test_assert( count_entries() == FILE_COUNT );
+
+  errno = 0;
+  rv = rmdir( dir_path );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == ENOTEMPTY );
+
+  /* Remove every second file first to delete within partially used blocks */
+  for ( i = 0; i < FILE_COUNT; i += 2 ) {
+    make_path( path, sizeof( path ), i );
+    rv = unlink( path );
+    rtems_test_assert( rv == 0 );
+  }
+
+  rtems_test_assert( count_entries() == FILE_COUNT / 2 );
+
+  for ( i = 1; i < FILE_COUNT; i += 2 ) {
+    make_path( path, sizeof( path ), i );
+    rv = stat( path, &st );
+    rtems_test_assert( rv == 0 );
+    rv = unlink( path );
+    rtems_test_assert( rv == 0 );
+  }
+
+  rtems_test_assert( count_entries() == 0 );
+
+  rv = rmdir( dir_path );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_links( void )
+{
+  char        path[32];
+  struct stat st;
+  size_t      i;
+  int         rv;
+  int         fd;
+
+  rv = mkdir( dir_path, S_IRWXU );
+  rtems_test_assert( rv == 0 );
+
+  fd = open( file_path, O_WRONLY | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR );
+  rtems_test_assert( fd >= 0 );
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  for ( i = 0; i < LINK_COUNT; ++i ) {
+    make_path( path, sizeof( path ), i );
+    rv = link( file_path, path );
+    rtems_test_assert( rv == 0 );
+  }
+
+  remount();
+
+  for ( i = 0; i < LINK_COUNT; ++i ) {
+    make_path( path, sizeof( path ), i );
+    rv = stat( path, &st );
+    rtems_test_assert( rv == 0 );
+    rtems_test_assert( st.st_nlink == LINK_COUNT + 1 );
+  }
+
+  rtems_test_assert( count_entries() == LINK_COUNT );
+
+  for ( i = 0; i < LINK_COUNT; ++i ) {
+    make_path( path, sizeof( path ), i );
+    rv = unlink( path );
+    rtems_test_assert( rv == 0 );
+  }
+
+  rtems_test_assert( count_entries() == 0 );
+
+  rv = rmdir( dir_path );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( file_path );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test( bool dir_index )
+{
+  format_and_mount( dir_index );
+  test_files();
+  test_links();
+  unmount_and_remove();
+}
+
+static void Init( rtems_task_argument arg )
+{
+  int rv;
+
+  TEST_BEGIN();
+
+  rv = mkdir( mount_dir, S_IRWXU | S_IRWXG | S_IRWXO );
+  rtems_test_assert( rv == 0 );
+
+  test( false );
+  test( true );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+/* one active file + stdin + stdout + stderr + device file when mounted */
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE ( 32 * 1024 )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,278 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <rtems/libio.h>
+#include <rtems/rtems-rfs-format.h>
+#include <rtems/sparse-disk.h>
+
+#include <bsp.h>
+
+const char rtems_test_name[] = "FSRFSINODECACHE 1";
+
+#define BLOCK_SIZE 512
+
+#define BLOCK_COUNT 4096
+
+#define FILE_COUNT 32
+
+#define OPEN_COUNT 8
+
+static const char dev_name[] = "/dev/rda";
+
+static const char mount_dir[] = "/mnt";
+
+static void mount_disk( const char *options )
+{
+  int rv;
+
+  rv = mount(
+    dev_name,
+    mount_dir,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    options
+  );
+  rtems_test_assert( rv == 0 );
+}
+
+static void unmount_disk( void )
+{
+  int rv;
+
+  rv = unmount( mount_dir );
+  rtems_test_assert( rv == 0 );
+}
+
+static void make_path( char *path, size_t size, size_t i )
+{
+  snprintf( path, size, "%s/f%02zu", mount_dir, i );
+}
+
+static void create_files( void )
+{
+  char    path[32];
+  size_t  i;
+  ssize_t n;
+  int     fd;
+  int     rv;
+
+  for ( i = 0; i < FILE_COUNT; ++i ) {
+    make_path( path, sizeof( path ), i );
+    fd = open( path, O_WRONLY | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR );
+    rtems_test_assert( fd >= 0 );
+    n = write( fd, path, i );
+    rtems_test_assert( n == (ssize_t) i );
+    rv = close( fd );
+    rtems_test_assert( rv == 0 );
+  }
+}
+
+static void check_files( size_t offset )
+{
+  char        path[32];
+  struct stat st;
+  size_t      i;
+  int         rv;
+
+  for ( i = 0; i < FILE_COUNT; ++i ) {
+    make_path( path, sizeof( path ), i );
+    rv = stat( path, &st );
+    rtems_test_assert( rv == 0 );
+    rtems_test_assert( S_ISREG( st.st_mode ) );
+    rtems_test_assert( st.st_size == (off_t) ( i + offset ) );
+  }
+}
+
+static void append_files( void )
+{
+  char    path[32];
+  size_t  i;
+  ssize_t n;
+  int     fd;
+  int     rv;
+
+  for ( i = 0; i < FILE_COUNT; ++i ) {
+    make_path( path, sizeof( path ), i );
+    fd = open( path, O_WRONLY | O_APPEND );
+    rtems_test_assert( fd >= 0 );
+    n = write( fd, "x", 1 );
+    rtems_test_assert( n == 1 );
+    rv = close( fd );
+    rtems_test_assert( rv == 0 );
+  }
+}
+
+static void check_open_files( void )
+{
+  char        path[32];
+  struct stat st;
+  int         fds[ OPEN_COUNT ];
+  size_t      i;
+  ssize_t     n;
+  int         rv;
+
+  /* More referenced inodes than the cache holds unreferenced ones */
+  for ( i = 0; i < OPEN_COUNT; ++i ) {
+    make_path( path, sizeof( path ), i );
+    fds[ i ] = open( path, O_RDWR );
+    rtems_test_assert( fds[ i ] >= 0 );
+  }
+
+  for ( i = 0; i < OPEN_COUNT; ++i ) {
+    n = write( fds[ i ], "y", 1 );
+    rtems_test_assert( n == 1 );
+
+    /* The inode is shared with the open file */
+    make_path( path, sizeof( path ), i );
+    rv = stat( path, &st );
+    rtems_test_assert( rv == 0 );
+    rtems_test_assert( st.st_size == (off_t) ( i + 2 ) );
+  }
+
+  for ( i = 0; i < OPEN_COUNT; ++i ) {
+    rv = ftruncate( fds[ i ], (off_t) ( i + 1 ) );
+    rtems_test_assert( rv == 0 );
+    rv = close( fds[ i ] );
+    rtems_test_assert( rv == 0 );
+  }
+}
+
+static void remove_files( void )
+{
+  char        path[32];
+  struct stat st;
+  size_t      i;
+  int         rv;
+
+  for ( i = 0; i < FILE_COUNT; ++i ) {
+    make_path( path, sizeof( path ), i );
+    rv = unlink( path );
+    rtems_test_assert( rv == 0 );
+
+    errno = 0;
+    rv = stat( path, &st );
+    rtems_test_assert( rv == -1 );
+    rtems_test_assert( errno == ENOENT );
+  }
+}
+
+static void test( const char *options )
+{
+  rtems_rfs_format_config config;
+  rtems_status_code       sc;
+  int                     rv;
+
+  sc = rtems_sparse_disk_create_and_register(
+    dev_name,
+    BLOCK_SIZE,
+    1024,
+    BLOCK_COUNT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  memset( &config, 0, sizeof( config ) );
+  config.block_size = BLOCK_SIZE;
+  rv = rtems_rfs_format( dev_name, &config );
+  rtems_test_assert( rv == 0 );
+
+  mount_disk( options );
+  create_files();
+  check_files( 0 );
+  unmount_disk();
+
+  /* The modified inodes must be written back */
+  mount_disk( NULL );
+  check_files( 0 );
+  unmount_disk();
+
+  mount_disk( options );
+  append_files();
+  check_files( 1 );
+  check_open_files();
+  check_files( 1 );
+  unmount_disk();
+
+  mount_disk( NULL );
+  check_files( 1 );
+  unmount_disk();
+
+  mount_disk( options );
+  remove_files();
+  unmount_disk();
+
+  rv = unlink( dev_name );
+  rtems_test_assert( rv == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  int rv;
+
+  TEST_BEGIN();
+
+  rv = mkdir( mount_dir, S_IRWXU | S_IRWXG | S_IRWXO );
+  rtems_test_assert( rv == 0 );
+
+  test( NULL );
+  test( "inode-cache=4" );
+  test( "inode-cache=64" );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+/* open files + stdin + stdout + stderr + device file when mounted */
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS ( OPEN_COUNT + 4 )
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE ( 32 * 1024 )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
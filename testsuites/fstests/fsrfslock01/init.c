@@ -0,0 +1,291 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <string.h>
+#include <unistd.h>
+#include <rtems/libio.h>
+#include <rtems/rtems-rfs-format.h>
+#include <rtems/sparse-disk.h>
+
+#include <bsp.h>
+
+const char rtems_test_name[] = "FSRFSLOCK 1";
+
+#define BLOCK_SIZE 512
+
+#define BLOCK_COUNT 4096
+
+#define WORKER_COUNT 4
+
+#define CHUNK_SIZE 100
+
+#define CHUNK_COUNT 64
+
+#define FILE_SIZE ( CHUNK_SIZE * CHUNK_COUNT )
+
+#define EVENT_DONE RTEMS_EVENT_0
+
+static const char dev_name[] = "/dev/rda";
+
+static const char mount_dir[] = "/mnt";
+
+static rtems_id init_task;
+
+static uint8_t chunk[ WORKER_COUNT ][ CHUNK_SIZE ];
+
+static uint8_t check[ CHUNK_SIZE ];
+
+static void make_path( char *path, size_t size, size_t i )
+{
+  snprintf( path, size, "%s/f%zu", mount_dir, i );
+}
+
+static uint8_t pattern( size_t w, size_t c, size_t i )
+{
+  return (uint8_t) ( w * 31 + c * 7 + i );
+}
+
+/*
+ * Each worker writes its own file and every second chunk of a common file.
+ * The workers yield after each chunk so the data paths interleave.
+ */
+static void worker( rtems_task_argument arg )
+{
+  size_t      w = arg;
+  char        path[32];
+  struct stat st;
+  size_t      c;
+  size_t      i;
+  ssize_t     n;
+  off_t       off;
+  int         fd;
+  int         shared_fd;
+  int         rv;
+
+  make_path( path, sizeof( path ), w );
+  fd = open( path, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR );
+  rtems_test_assert( fd >= 0 );
+
+  make_path( path, sizeof( path ), WORKER_COUNT + w / 2 );
+  shared_fd = open( path, O_RDWR );
+  rtems_test_assert( shared_fd >= 0 );
+
+  for ( c = 0; c < CHUNK_COUNT; ++c ) {
+    for ( i = 0; i < CHUNK_SIZE; ++i ) {
+      chunk[ w ][ i ] = pattern( w, c, i );
+    }
+
+    n = write( fd, &chunk[ w ][ 0 ], CHUNK_SIZE );
+    rtems_test_assert( n == CHUNK_SIZE );
+
+    if ( c % 2 == w % 2 ) {
+      off = (off_t) ( c * CHUNK_SIZE );
+      off = lseek( shared_fd, off, SEEK_SET );
+      rtems_test_assert( off == (off_t) ( c * CHUNK_SIZE ) );
+      n = write( shared_fd, &chunk[ w ][ 0 ], CHUNK_SIZE );
+      rtems_test_assert( n == CHUNK_SIZE );
+    }
+
+    rv = fstat( fd, &st );
+    rtems_test_assert( rv == 0 );
+    rtems_test_assert( st.st_size == (off_t) ( ( c + 1 ) * CHUNK_SIZE ) );
+
+    sched_yield();
+  }
+
+  rv = close( shared_fd );
+  rtems_test_assert( rv == 0 );
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rtems_event_transient_send( init_task );
+  rtems_task_exit();
+}
+
+static void check_file( size_t file, bool common )
+{
+  char    path[32];
+  size_t  c;
+  size_t  i;
+  size_t  w;
+  ssize_t n;
+  int     fd;
+  int     rv;
+
+  make_path( path, sizeof( path ), file );
+  fd = open( path, O_RDONLY );
+  rtems_test_assert( fd >= 0 );
+
+  for ( c = 0; c < CHUNK_COUNT; ++c ) {
+    if ( common ) {
+      w = ( file - WORKER_COUNT ) * 2 + ( c % 2 );
+    } else {
+      w = file;
+    }
+
+    n = read( fd, &check[ 0 ], CHUNK_SIZE );
+    rtems_test_assert( n == CHUNK_SIZE );
+
+    for ( i = 0; i < CHUNK_SIZE; ++i ) {
+      rtems_test_assert( check[ i ] == pattern( w, c, i ) );
+    }
+  }
+
+  n = read( fd, &check[ 0 ], CHUNK_SIZE );
+  rtems_test_assert( n == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test( void )
+{
+  rtems_rfs_format_config config;
+  rtems_status_code       sc;
+  char                    path[32];
+  size_t                  i;
+  int                     fd;
+  int                     rv;
+
+  sc = rtems_sparse_disk_create_and_register(
+    dev_name,
+    BLOCK_SIZE,
+    1024,
+    BLOCK_COUNT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  memset( &config, 0, sizeof( config ) );
+  config.block_size = BLOCK_SIZE;
+  config.group_blocks = BLOCK_COUNT / 4;
+  rv = rtems_rfs_format( dev_name, &config );
+  rtems_test_assert( rv == 0 );
+
+  rv = mount(
+    dev_name,
+    mount_dir,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert( rv == 0 );
+
+  for ( i = 0; i < WORKER_COUNT / 2; ++i ) {
+    make_path( path, sizeof( path ), WORKER_COUNT + i );
+    fd = open( path, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR );
+    rtems_test_assert( fd >= 0 );
+    rv = ftruncate( fd, FILE_SIZE );
+    rtems_test_assert( rv == 0 );
+    rv = close( fd );
+    rtems_test_assert( rv == 0 );
+  }
+
+  init_task = rtems_task_self();
+
+  for ( i = 0; i < WORKER_COUNT; ++i ) {
+    rtems_id id;
+
+    sc = rtems_task_create(
+      rtems_build_name( 'W', 'O', 'R', 'K' ),
+      2,
+      RTEMS_MINIMUM_STACK_SIZE * 4,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &id
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    sc = rtems_task_start( id, worker, i );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  for ( i = 0; i < WORKER_COUNT; ++i ) {
+    sc = rtems_event_transient_receive( RTEMS_WAIT, RTEMS_NO_TIMEOUT );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  for ( i = 0; i < WORKER_COUNT; ++i ) {
+    check_file( i, false );
+  }
+
+  for ( i = 0; i < WORKER_COUNT / 2; ++i ) {
+    check_file( WORKER_COUNT + i, true );
+  }
+
+  rv = unmount( mount_dir );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( dev_name );
+  rtems_test_assert( rv == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  int rv;
+
+  TEST_BEGIN();
+
+  rv = mkdir( mount_dir, S_IRWXU | S_IRWXG | S_IRWXO );
+  rtems_test_assert( rv == 0 );
+
+  test();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+/* two files per worker + stdin + stdout + stderr + device file when mounted */
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS ( 2 * WORKER_COUNT + 4 )
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_TASKS ( 1 + WORKER_COUNT )
+
+#define CONFIGURE_INIT_TASK_PRIORITY 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE ( 32 * 1024 )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,354 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <rtems/blkdev.h>
+#include <rtems/libio.h>
+#include <rtems/ramdisk.h>
+#include <rtems/rtems-rfs-format.h>
+
+#include <bsp.h>
+
+const char rtems_test_name[] = "FSRFSLOCK 2";
+
+#define BLOCK_SIZE 512
+
+#define BLOCK_COUNT 1024
+
+#define FILE_COUNT 2
+
+#define FILE_SIZE ( 4 * BLOCK_SIZE )
+
+#define EVENT_DONE RTEMS_EVENT_0
+
+#define EVENT_RESUME RTEMS_EVENT_1
+
+static const char dev_name[] = "/dev/rda";
+
+static const char mount_dir[] = "/mnt";
+
+static rtems_id init_task;
+
+static rtems_id blocked_task;
+
+static volatile bool block_next_read;
+
+static int fds[ FILE_COUNT ];
+
+static uint8_t buf[ FILE_COUNT ][ BLOCK_SIZE ];
+
+static void make_path( char *path, size_t size, size_t i )
+{
+  snprintf( path, size, "%s/f%zu", mount_dir, i );
+}
+
+static uint8_t pattern( size_t f, size_t i )
+{
+  return (uint8_t) ( f * 31 + i );
+}
+
+/*
+ * Block the next read request in the context of the requesting task until
+ * the Init task resumes it.
+ */
+static int blocking_ioctl( rtems_disk_device *dd, uint32_t req, void *arg )
+{
+  if ( req == RTEMS_BLKIO_REQUEST && block_next_read ) {
+    rtems_blkdev_request *r = arg;
+
+    if ( r->req == RTEMS_BLKDEV_REQ_READ ) {
+      rtems_status_code sc;
+      rtems_event_set   events;
+
+      block_next_read = false;
+      blocked_task = rtems_task_self();
+
+      sc = rtems_event_transient_send( init_task );
+      rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+      sc = rtems_event_receive(
+        EVENT_RESUME,
+        RTEMS_EVENT_ALL | RTEMS_WAIT,
+        RTEMS_NO_TIMEOUT,
+        &events
+      );
+      rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+    }
+  }
+
+  return ramdisk_ioctl( dd, req, arg );
+}
+
+static void check_file( size_t f )
+{
+  size_t  i;
+  ssize_t n;
+
+  for ( i = 0; i < FILE_SIZE; ++i ) {
+    if ( i % BLOCK_SIZE == 0 ) {
+      n = read( fds[ f ], &buf[ f ][ 0 ], BLOCK_SIZE );
+      rtems_test_assert( n == BLOCK_SIZE );
+    }
+
+    rtems_test_assert( buf[ f ][ i % BLOCK_SIZE ] == pattern( f, i ) );
+  }
+
+  n = read( fds[ f ], &buf[ f ][ 0 ], BLOCK_SIZE );
+  rtems_test_assert( n == 0 );
+}
+
+static void reader( rtems_task_argument arg )
+{
+  rtems_status_code sc;
+
+  check_file( arg );
+
+  sc = rtems_event_send( init_task, EVENT_DONE );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_task_exit();
+}
+
+static void start_reader( size_t f )
+{
+  rtems_status_code sc;
+  rtems_id          id;
+
+  sc = rtems_task_create(
+    rtems_build_name( 'R', 'E', 'A', 'D' ),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE * 4,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_start( id, reader, f );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void wait_for_done( rtems_interval timeout )
+{
+  rtems_status_code sc;
+  rtems_event_set   events;
+
+  sc = rtems_event_receive(
+    EVENT_DONE,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    timeout,
+    &events
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void write_files( void )
+{
+  char    path[32];
+  size_t  f;
+  size_t  i;
+  ssize_t n;
+  int     fd;
+  int     rv;
+
+  for ( f = 0; f < FILE_COUNT; ++f ) {
+    make_path( path, sizeof( path ), f );
+    fd = open( path, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR );
+    rtems_test_assert( fd >= 0 );
+
+    for ( i = 0; i < FILE_SIZE; ++i ) {
+      buf[ f ][ i % BLOCK_SIZE ] = pattern( f, i );
+
+      if ( i % BLOCK_SIZE == BLOCK_SIZE - 1 ) {
+        n = write( fd, &buf[ f ][ 0 ], BLOCK_SIZE );
+        rtems_test_assert( n == BLOCK_SIZE );
+      }
+    }
+
+    rv = close( fd );
+    rtems_test_assert( rv == 0 );
+  }
+}
+
+/*
+ * Drop the cached blocks of the device, so that the reads of the file data
+ * must go to the driver.
+ */
+static void purge_device( void )
+{
+  int fd;
+  int rv;
+
+  fd = open( dev_name, O_RDWR );
+  rtems_test_assert( fd >= 0 );
+
+  rv = rtems_disk_fd_purge( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test( void )
+{
+  rtems_rfs_format_config config;
+  rtems_status_code       sc;
+  ramdisk                *rd;
+  char                    path[32];
+  size_t                  f;
+  int                     rv;
+
+  rd = ramdisk_allocate( NULL, BLOCK_SIZE, BLOCK_COUNT, false );
+  rtems_test_assert( rd != NULL );
+
+  sc = rtems_blkdev_create(
+    dev_name,
+    BLOCK_SIZE,
+    BLOCK_COUNT,
+    blocking_ioctl,
+    rd
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  memset( &config, 0, sizeof( config ) );
+  config.block_size = BLOCK_SIZE;
+  config.group_blocks = BLOCK_COUNT / 2;
+  rv = rtems_rfs_format( dev_name, &config );
+  rtems_test_assert( rv == 0 );
+
+  rv = mount(
+    dev_name,
+    mount_dir,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert( rv == 0 );
+
+  write_files();
+
+  rv = unmount( mount_dir );
+  rtems_test_assert( rv == 0 );
+
+  purge_device();
+
+  rv = mount(
+    dev_name,
+    mount_dir,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert( rv == 0 );
+
+  for ( f = 0; f < FILE_COUNT; ++f ) {
+    make_path( path, sizeof( path ), f );
+    fds[ f ] = open( path, O_RDONLY );
+    rtems_test_assert( fds[ f ] >= 0 );
+  }
+
+  init_task = rtems_task_self();
+
+  /*
+   * The first reader blocks in the driver while it reads the first data
+   * block of its file.
+   */
+  block_next_read = true;
+  start_reader( 0 );
+
+  sc = rtems_event_transient_receive( RTEMS_WAIT, RTEMS_NO_TIMEOUT );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /*
+   * The second reader must complete while the I/O of the first reader is
+   * still in progress.
+   */
+  start_reader( 1 );
+  wait_for_done( rtems_clock_get_ticks_per_second() );
+
+  sc = rtems_event_send( blocked_task, EVENT_RESUME );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  wait_for_done( RTEMS_NO_TIMEOUT );
+
+  for ( f = 0; f < FILE_COUNT; ++f ) {
+    rv = close( fds[ f ] );
+    rtems_test_assert( rv == 0 );
+  }
+
+  rv = unmount( mount_dir );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( dev_name );
+  rtems_test_assert( rv == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  int rv;
+
+  TEST_BEGIN();
+
+  rv = mkdir( mount_dir, S_IRWXU | S_IRWXG | S_IRWXO );
+  rtems_test_assert( rv == 0 );
+
+  test();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+/* files + stdin + stdout + stderr + device file when mounted + purge */
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS ( FILE_COUNT + 5 )
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_TASKS ( 1 + FILE_COUNT )
+
+#define CONFIGURE_INIT_TASK_PRIORITY 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE ( 32 * 1024 )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
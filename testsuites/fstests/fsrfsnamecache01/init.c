@@ -0,0 +1,443 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <rtems/libio_.h>
+#include <rtems/rtems-rfs-format.h>
+#include <rtems/sparse-disk.h>
+
+#include <bsp.h>
+
+const char rtems_test_name[] = "FSRFSNAMECACHE 1";
+
+#define NAME_CACHE_ENTRIES ( 2 * RTEMS_FILESYSTEM_NAME_CACHE_WAYS )
+
+#define FILE_COUNT 32
+
+static const char dev_name[] = "/dev/rda";
+
+static const char mount_dir[] = "/mnt";
+
+static const char long_name[] = "0123456789abcdef0123456789abcdef";
+
+static ino_t file_ino[ FILE_COUNT ];
+
+static void make_file( const char *path )
+{
+  int fd;
+  int rv;
+
+  fd = open( path, O_WRONLY | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR );
+  rtems_test_assert( fd >= 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+}
+
+static ino_t get_ino( const char *path )
+{
+  struct stat st;
+  int         rv;
+
+  rv = stat( path, &st );
+  rtems_test_assert( rv == 0 );
+
+  return st.st_ino;
+}
+
+/* Reads the directory entries without the name cache */
+static bool has_dir_entry( const char *path, const char *name )
+{
+  DIR           *dir;
+  struct dirent *de;
+  bool           found;
+  int            rv;
+
+  dir = opendir( path );
+  rtems_test_assert( dir != NULL );
+
+  found = false;
+
+  while ( ( de = readdir( dir ) ) != NULL ) {
+    if ( strcmp( de->d_name, name ) == 0 ) {
+      found = true;
+    }
+  }
+
+  rv = closedir( dir );
+  rtems_test_assert( rv == 0 );
+
+  return found;
+}
+
+static void assert_no_entry( const char *path )
+{
+  struct stat st;
+  int         rv;
+
+  errno = 0;
+  rv = stat( path, &st );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == ENOENT );
+}
+
+static void make_file_path( char *path, size_t size, size_t i )
+{
+  snprintf( path, size, "%s/a/file-%zu", mount_dir, i );
+}
+
+static void test_cache( void )
+{
+  rtems_filesystem_mount_table_entry_t mt_entry;
+  rtems_filesystem_location_info_t     dir;
+  rtems_filesystem_location_info_t     other_dir;
+  rtems_filesystem_location_info_t     node;
+  rtems_filesystem_name_cache_status   status;
+  void                                *found;
+  char                                 name[ 8 ];
+  size_t                               i;
+
+  memset( &mt_entry, 0, sizeof( mt_entry ) );
+  memset( &dir, 0, sizeof( dir ) );
+  dir.mt_entry = &mt_entry;
+  dir.node_access = (void *) 1;
+  other_dir = dir;
+  other_dir.node_access = (void *) 2;
+  node = dir;
+  node.node_access = (void *) 3;
+
+  status = rtems_filesystem_name_cache_lookup( &dir, "x", 1, &found );
+  rtems_test_assert( status == RTEMS_FILESYSTEM_NAME_CACHE_MISS );
+
+  rtems_filesystem_name_cache_enter( &dir, "x", 1, node.node_access );
+  found = NULL;
+  status = rtems_filesystem_name_cache_lookup( &dir, "x", 1, &found );
+  rtems_test_assert( status == RTEMS_FILESYSTEM_NAME_CACHE_HIT );
+  rtems_test_assert( found == node.node_access );
+
+  status = rtems_filesystem_name_cache_lookup( &other_dir, "x", 1, &found );
+  rtems_test_assert( status == RTEMS_FILESYSTEM_NAME_CACHE_MISS );
+
+  rtems_filesystem_name_cache_enter_no_entry( &other_dir, "x", 1 );
+  status = rtems_filesystem_name_cache_lookup( &other_dir, "x", 1, &found );
+  rtems_test_assert( status == RTEMS_FILESYSTEM_NAME_CACHE_NO_ENTRY );
+
+  rtems_filesystem_name_cache_remove( &other_dir, "x", 1 );
+  status = rtems_filesystem_name_cache_lookup( &other_dir, "x", 1, &found );
+  rtems_test_assert( status == RTEMS_FILESYSTEM_NAME_CACHE_MISS );
+
+  /* Entries of the node and of entries referring to the node are purged */
+  rtems_filesystem_name_cache_enter( &node, "y", 1, dir.node_access );
+  rtems_filesystem_name_cache_purge_node( &node );
+  status = rtems_filesystem_name_cache_lookup( &dir, "x", 1, &found );
+  rtems_test_assert( status == RTEMS_FILESYSTEM_NAME_CACHE_MISS );
+  status = rtems_filesystem_name_cache_lookup( &node, "y", 1, &found );
+  rtems_test_assert( status == RTEMS_FILESYSTEM_NAME_CACHE_MISS );
+
+  /* The current and parent directory and too long names are not cached */
+  rtems_filesystem_name_cache_enter( &dir, ".", 1, node.node_access );
+  status = rtems_filesystem_name_cache_lookup( &dir, ".", 1, &found );
+  rtems_test_assert( status == RTEMS_FILESYSTEM_NAME_CACHE_MISS );
+  rtems_filesystem_name_cache_enter( &dir, "..", 2, node.node_access );
+  status = rtems_filesystem_name_cache_lookup( &dir, "..", 2, &found );
+  rtems_test_assert( status == RTEMS_FILESYSTEM_NAME_CACHE_MISS );
+  i = RTEMS_FILESYSTEM_NAME_CACHE_NAME_MAX + 1;
+  rtems_test_assert( i < sizeof( long_name ) );
+  rtems_filesystem_name_cache_enter( &dir, long_name, i, node.node_access );
+  status = rtems_filesystem_name_cache_lookup( &dir, long_name, i, &found );
+  rtems_test_assert( status == RTEMS_FILESYSTEM_NAME_CACHE_MISS );
+
+  /* The cache holds at most the configured count of entries */
+  for ( i = 0; i < 4 * NAME_CACHE_ENTRIES; ++i ) {
+    snprintf( name, sizeof( name ), "%zu", i );
+    rtems_filesystem_name_cache_enter(
+      &dir,
+      name,
+      strlen( name ),
+      (void *) ( i + 1 )
+    );
+  }
+
+  for ( i = 0; i < 4 * NAME_CACHE_ENTRIES; ++i ) {
+    snprintf( name, sizeof( name ), "%zu", i );
+    found = NULL;
+    status = rtems_filesystem_name_cache_lookup(
+      &dir,
+      name,
+      strlen( name ),
+      &found
+    );
+    rtems_test_assert(
+      status == RTEMS_FILESYSTEM_NAME_CACHE_MISS
+        || ( status == RTEMS_FILESYSTEM_NAME_CACHE_HIT
+          && found == (void *) ( i + 1 ) )
+    );
+  }
+
+  rtems_filesystem_name_cache_purge_instance( &mt_entry );
+
+  for ( i = 0; i < 4 * NAME_CACHE_ENTRIES; ++i ) {
+    snprintf( name, sizeof( name ), "%zu", i );
+    status = rtems_filesystem_name_cache_lookup(
+      &dir,
+      name,
+      strlen( name ),
+      &found
+    );
+    rtems_test_assert( status == RTEMS_FILESYSTEM_NAME_CACHE_MISS );
+  }
+}
+
+static void test_file_system( void )
+{
+  char   path[ 64 ];
+  ino_t  ino;
+  size_t i;
+  int    rv;
+
+  rv = mkdir( "/mnt/a", S_IRWXU );
+  rtems_test_assert( rv == 0 );
+
+  rv = mkdir( "/mnt/a/b", S_IRWXU );
+  rtems_test_assert( rv == 0 );
+
+  /* A negative entry is invalidated by the creation of the name */
+  assert_no_entry( "/mnt/a/b/f" );
+  assert_no_entry( "/mnt/a/b/f" );
+  make_file( "/mnt/a/b/f" );
+  ino = get_ino( "/mnt/a/b/f" );
+  rtems_test_assert( get_ino( "/mnt/a/b/f" ) == ino );
+
+  assert_no_entry( "/mnt/a/b/d" );
+  rv = mkdir( "/mnt/a/b/d", S_IRWXU );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( get_ino( "/mnt/a/b/d" ) != ino );
+
+  assert_no_entry( "/mnt/a/b/l" );
+  rv = link( "/mnt/a/b/f", "/mnt/a/b/l" );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( get_ino( "/mnt/a/b/l" ) == ino );
+
+  assert_no_entry( "/mnt/a/b/s" );
+  rv = symlink( "f", "/mnt/a/b/s" );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( get_ino( "/mnt/a/b/s" ) == ino );
+
+  /* Rename invalidates the old and the new name */
+  assert_no_entry( "/mnt/a/b/g" );
+  rv = rename( "/mnt/a/b/f", "/mnt/a/b/g" );
+  rtems_test_assert( rv == 0 );
+  assert_no_entry( "/mnt/a/b/f" );
+  rtems_test_assert( get_ino( "/mnt/a/b/g" ) == ino );
+  assert_no_entry( "/mnt/a/b/s" );
+
+  rv = rename( "/mnt/a/b/g", "/mnt/a/b/f" );
+  rtems_test_assert( rv == 0 );
+  assert_no_entry( "/mnt/a/b/g" );
+  rtems_test_assert( get_ino( "/mnt/a/b/f" ) == ino );
+  rtems_test_assert( get_ino( "/mnt/a/b/s" ) == ino );
+
+  /* Unlink invalidates the name */
+  rv = unlink( "/mnt/a/b/s" );
+  rtems_test_assert( rv == 0 );
+  assert_no_entry( "/mnt/a/b/s" );
+
+  /*
+   * A cached hard link must be removed by name and not as the first entry of
+   * the inode.
+   */
+  rv = link( "/mnt/a/b/f", "/mnt/a/b/m" );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( get_ino( "/mnt/a/b/m" ) == ino );
+  rv = rename( "/mnt/a/b/m", "/mnt/a/b/n" );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( has_dir_entry( "/mnt/a/b", "f" ) );
+  rtems_test_assert( has_dir_entry( "/mnt/a/b", "l" ) );
+  rtems_test_assert( !has_dir_entry( "/mnt/a/b", "m" ) );
+  rtems_test_assert( has_dir_entry( "/mnt/a/b", "n" ) );
+  rtems_test_assert( get_ino( "/mnt/a/b/n" ) == ino );
+  rv = unlink( "/mnt/a/b/n" );
+  rtems_test_assert( rv == 0 );
+  assert_no_entry( "/mnt/a/b/n" );
+
+  rtems_test_assert( get_ino( "/mnt/a/b/l" ) == ino );
+  rv = unlink( "/mnt/a/b/l" );
+  rtems_test_assert( rv == 0 );
+  assert_no_entry( "/mnt/a/b/l" );
+  rtems_test_assert( has_dir_entry( "/mnt/a/b", "f" ) );
+  rtems_test_assert( !has_dir_entry( "/mnt/a/b", "l" ) );
+  rtems_test_assert( get_ino( "/mnt/a/b/f" ) == ino );
+  rv = unlink( "/mnt/a/b/f" );
+  rtems_test_assert( rv == 0 );
+  assert_no_entry( "/mnt/a/b/f" );
+
+  /* A directory created again with the same name has no stale entries */
+  assert_no_entry( "/mnt/a/b/d/x" );
+  ino = get_ino( "/mnt/a/b/d" );
+  rv = rmdir( "/mnt/a/b/d" );
+  rtems_test_assert( rv == 0 );
+  assert_no_entry( "/mnt/a/b/d" );
+  assert_no_entry( "/mnt/a/b/d/x" );
+  rv = mkdir( "/mnt/a/b/d", S_IRWXU );
+  rtems_test_assert( rv == 0 );
+  make_file( "/mnt/a/b/d/x" );
+  rtems_test_assert( get_ino( "/mnt/a/b/d/x" ) != 0 );
+
+  /* More names than cache entries */
+  for ( i = 0; i < FILE_COUNT; ++i ) {
+    make_file_path( path, sizeof( path ), i );
+    make_file( path );
+    file_ino[ i ] = get_ino( path );
+  }
+
+  for ( i = 0; i < FILE_COUNT; ++i ) {
+    make_file_path( path, sizeof( path ), i );
+    rtems_test_assert( get_ino( path ) == file_ino[ i ] );
+  }
+}
+
+static void test_remount( void )
+{
+  char   path[ 64 ];
+  size_t i;
+  int    rv;
+
+  for ( i = 0; i < FILE_COUNT; ++i ) {
+    make_file_path( path, sizeof( path ), i );
+    rtems_test_assert( get_ino( path ) == file_ino[ i ] );
+    rv = unlink( path );
+    rtems_test_assert( rv == 0 );
+    assert_no_entry( path );
+  }
+
+  rv = unlink( "/mnt/a/b/d/x" );
+  rtems_test_assert( rv == 0 );
+  rv = rmdir( "/mnt/a/b/d" );
+  rtems_test_assert( rv == 0 );
+  rv = rmdir( "/mnt/a/b" );
+  rtems_test_assert( rv == 0 );
+  rv = rmdir( "/mnt/a" );
+  rtems_test_assert( rv == 0 );
+  assert_no_entry( "/mnt/a" );
+}
+
+static void mount_file_system( void )
+{
+  int rv;
+
+  rv = mount(
+    dev_name,
+    mount_dir,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert( rv == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  rtems_rfs_format_config config;
+  rtems_status_code       sc;
+  int                     rv;
+
+  TEST_BEGIN();
+
+  test_cache();
+
+  rv = mkdir( mount_dir, S_IRWXU | S_IRWXG | S_IRWXO );
+  rtems_test_assert( rv == 0 );
+
+  sc = rtems_sparse_disk_create_and_register(
+    dev_name,
+    512,
+    1024,
+    2048,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  memset( &config, 0, sizeof( config ) );
+  config.block_size = 512;
+  rv = rtems_rfs_format( dev_name, &config );
+  rtems_test_assert( rv == 0 );
+
+  mount_file_system();
+  test_file_system();
+
+  rv = unmount( mount_dir );
+  rtems_test_assert( rv == 0 );
+
+  /* The entries of the unmounted instance are gone */
+  assert_no_entry( "/mnt/a" );
+
+  mount_file_system();
+  test_remount();
+
+  rv = unmount( mount_dir );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( dev_name );
+  rtems_test_assert( rv == 0 );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+/* stdin + stdout + stderr + file + device file when mounted */
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_FILESYSTEM_NAME_CACHE_ENTRIES NAME_CACHE_ENTRIES
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE ( 32 * 1024 )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,296 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <rtems/libio.h>
+#include <rtems/rtems-rfs-format.h>
+#include <rtems/sparse-disk.h>
+
+#include <bsp.h>
+
+const char rtems_test_name[] = "FSRFSRESERVE 1";
+
+#define BLOCK_SIZE 512
+
+#define BLOCK_COUNT 4096
+
+#define FILE_COUNT 2
+
+#define CHUNK_BLOCKS 4
+
+#define FILE_BLOCKS 32
+
+#define MAGIC 0x52535631
+
+static const char dev_name[] = "/dev/rda";
+
+static const char mount_dir[] = "/mnt";
+
+static uint32_t block[ BLOCK_SIZE / sizeof( uint32_t ) ];
+
+static uint32_t chunk[ CHUNK_BLOCKS ][ BLOCK_SIZE / sizeof( uint32_t ) ];
+
+static uint32_t position[ FILE_COUNT ][ FILE_BLOCKS ];
+
+static void make_path( char *path, size_t size, size_t i )
+{
+  snprintf( path, size, "%s/f%zu", mount_dir, i );
+}
+
+static fsblkcnt_t free_blocks( void )
+{
+  struct statvfs buf;
+  int            rv;
+
+  rv = statvfs( mount_dir, &buf );
+  rtems_test_assert( rv == 0 );
+
+  return buf.f_bfree;
+}
+
+/*
+ * Write the files in chunks taking turns so the allocations of the files
+ * interleave. Each block starts with a tag of the file and the block.
+ */
+static void write_files( void )
+{
+  char    path[ 32 ];
+  int     fds[ FILE_COUNT ];
+  size_t  f;
+  size_t  b;
+  size_t  c;
+  ssize_t n;
+  int     rv;
+
+  for ( f = 0; f < FILE_COUNT; ++f ) {
+    make_path( path, sizeof( path ), f );
+    fds[ f ] = open( path, O_WRONLY | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR );
+    rtems_test_assert( fds[ f ] >= 0 );
+  }
+
+  for ( b = 0; b < FILE_BLOCKS; b += CHUNK_BLOCKS ) {
+    for ( f = 0; f < FILE_COUNT; ++f ) {
+      for ( c = 0; c < CHUNK_BLOCKS; ++c ) {
+        memset( &chunk[ c ][ 0 ], 0, sizeof( chunk[ c ] ) );
+        chunk[ c ][ 0 ] = MAGIC;
+        chunk[ c ][ 1 ] = f;
+        chunk[ c ][ 2 ] = b + c;
+      }
+
+      n = write( fds[ f ], &chunk[ 0 ][ 0 ], sizeof( chunk ) );
+      rtems_test_assert( n == (ssize_t) sizeof( chunk ) );
+    }
+  }
+
+  for ( f = 0; f < FILE_COUNT; ++f ) {
+    rv = close( fds[ f ] );
+    rtems_test_assert( rv == 0 );
+  }
+}
+
+static void remove_files( void )
+{
+  char   path[ 32 ];
+  size_t f;
+  int    rv;
+
+  for ( f = 0; f < FILE_COUNT; ++f ) {
+    make_path( path, sizeof( path ), f );
+    rv = unlink( path );
+    rtems_test_assert( rv == 0 );
+  }
+}
+
+/*
+ * Locate the blocks of the files on the device by the tags.
+ */
+static void locate_blocks( void )
+{
+  uint32_t i;
+  ssize_t  n;
+  int      fd;
+  int      rv;
+
+  memset( position, 0, sizeof( position ) );
+
+  fd = open( dev_name, O_RDONLY );
+  rtems_test_assert( fd >= 0 );
+
+  for ( i = 0; i < BLOCK_COUNT; ++i ) {
+    n = read( fd, &block[ 0 ], sizeof( block ) );
+    rtems_test_assert( n == (ssize_t) sizeof( block ) );
+
+    if (
+      block[ 0 ] == MAGIC
+        && block[ 1 ] < FILE_COUNT
+        && block[ 2 ] < FILE_BLOCKS
+    ) {
+      rtems_test_assert( position[ block[ 1 ] ][ block[ 2 ] ] == 0 );
+      position[ block[ 1 ] ][ block[ 2 ] ] = i;
+    }
+  }
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+}
+
+static size_t count_runs( size_t f )
+{
+  size_t runs;
+  size_t b;
+
+  runs = 1;
+
+  for ( b = 1; b < FILE_BLOCKS; ++b ) {
+    rtems_test_assert( position[ f ][ b ] != 0 );
+
+    if ( position[ f ][ b ] != position[ f ][ b - 1 ] + 1 ) {
+      ++runs;
+    }
+  }
+
+  return runs;
+}
+
+static void test( const char *options, size_t max_runs )
+{
+  rtems_rfs_format_config config;
+  rtems_status_code       sc;
+  fsblkcnt_t              before;
+  size_t                  f;
+  int                     rv;
+
+  sc = rtems_sparse_disk_create_and_register(
+    dev_name,
+    BLOCK_SIZE,
+    1024,
+    BLOCK_COUNT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  memset( &config, 0, sizeof( config ) );
+  config.block_size = BLOCK_SIZE;
+  rv = rtems_rfs_format( dev_name, &config );
+  rtems_test_assert( rv == 0 );
+
+  rv = mount(
+    dev_name,
+    mount_dir,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    options
+  );
+  rtems_test_assert( rv == 0 );
+
+  before = free_blocks();
+  write_files();
+
+  /* The blocks still reserved are freed by the close */
+  rtems_test_assert(
+    before - free_blocks() >= FILE_COUNT * FILE_BLOCKS
+  );
+  rtems_test_assert(
+    before - free_blocks() <= FILE_COUNT * ( FILE_BLOCKS + 1 )
+  );
+
+  rv = unmount( mount_dir );
+  rtems_test_assert( rv == 0 );
+
+  locate_blocks();
+
+  for ( f = 0; f < FILE_COUNT; ++f ) {
+    rtems_test_assert( count_runs( f ) <= max_runs );
+  }
+
+  rv = mount(
+    dev_name,
+    mount_dir,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    options
+  );
+  rtems_test_assert( rv == 0 );
+
+  remove_files();
+  rtems_test_assert( free_blocks() == before );
+
+  rv = unmount( mount_dir );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( dev_name );
+  rtems_test_assert( rv == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  int rv;
+
+  TEST_BEGIN();
+
+  rv = mkdir( mount_dir, S_IRWXU | S_IRWXG | S_IRWXO );
+  rtems_test_assert( rv == 0 );
+
+  /* Each write is contiguous */
+  test( NULL, FILE_BLOCKS / CHUNK_BLOCKS );
+
+  /* The reserve covers the whole file */
+  test( "file-reserve=64", 1 );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+/* files + stdin + stdout + stderr + device file when mounted */
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS ( FILE_COUNT + 5 )
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE ( 32 * 1024 )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -141,12 +141,33 @@ static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
   return rv;
 }
 
+static const rtems_blkdev_read_ahead_stream *get_last_stream(
+  const rtems_disk_device *dd
+)
+{
+  const rtems_blkdev_read_ahead_stream *last = NULL;
+  size_t i;
+
+  for (i = 0; i < RTEMS_DISK_READ_AHEAD_STREAM_COUNT; ++i) {
+    const rtems_blkdev_read_ahead_stream *stream = &dd->read_ahead.streams [i];
+
+    if (stream->age == dd->read_ahead.clock) {
+      last = stream;
+    }
+  }
+
+  rtems_test_assert(last != NULL);
+
+  return last;
+}
+
 static void test_read_ahead(rtems_disk_device *dd)
 {
   int i;
 
   for (i = 0; i < READ_COUNT; ++i) {
     int action = action_sequence [i];
+    const rtems_blkdev_read_ahead_stream *stream;
 
     if (action != RESET_CACHE) {
       rtems_blkdev_bnum block = (rtems_blkdev_bnum) action;
@@ -175,8 +196,9 @@ static void test_read_ahead(rtems_disk_device *dd)
       memset(&block_access_counts, 0, sizeof(block_access_counts));
     }
 
-    rtems_test_assert(trigger [i] == dd->read_ahead.trigger);
-    rtems_test_assert(next [i] == dd->read_ahead.next);
+    stream = get_last_stream(dd);
+    rtems_test_assert(trigger [i] == stream->trigger);
+    rtems_test_assert(next [i] == stream->next);
   }
 
   printf("\n");
@@ -56,26 +56,29 @@ static const test_action actions [ACTION_COUNT] = {
   { 5, rtems_bdbuf_get, RTEMS_SUCCESSFUL, rtems_bdbuf_sync }
 };
 
-#define STATS(a, b, c, d, e, f, g, h) \
+#define STATS(a, b, c, d, e, f, g, h, i, j, k) \
   { \
     .read_hits = a, \
     .read_misses = b, \
     .read_ahead_transfers = c, \
-    .read_blocks = d, \
-    .read_errors = e, \
-    .write_transfers = f, \
-    .write_blocks = g, \
-    .write_errors = h \
+    .read_ahead_streams = d, \
+    .read_ahead_hits = e, \
+    .read_ahead_misses = f, \
+    .read_blocks = g, \
+    .read_errors = h, \
+    .write_transfers = i, \
+    .write_blocks = j, \
+    .write_errors = k \
   }
 
 static const rtems_blkdev_stats expected_stats [ACTION_COUNT] = {
-  STATS(0, 1, 0, 1, 0, 0, 0, 0),
-  STATS(0, 2, 1, 3, 0, 0, 0, 0),
-  STATS(1, 2, 2, 4, 0, 0, 0, 0),
-  STATS(2, 2, 2, 4, 0, 0, 0, 0),
-  STATS(2, 2, 2, 4, 0, 1, 1, 0),
-  STATS(2, 3, 2, 5, 1, 1, 1, 0),
-  STATS(2, 3, 2, 5, 1, 2, 2, 1)
+  STATS(0, 1, 0, 1, 0, 0, 1, 0, 0, 0, 0),
+  STATS(0, 2, 1, 1, 0, 0, 3, 0, 0, 0, 0),
+  STATS(1, 2, 2, 1, 1, 0, 4, 0, 0, 0, 0),
+  STATS(2, 2, 2, 1, 1, 0, 4, 0, 0, 0, 0),
+  STATS(2, 2, 2, 1, 1, 0, 4, 0, 1, 1, 0),
+  STATS(2, 3, 2, 2, 1, 0, 5, 1, 1, 1, 0),
+  STATS(2, 3, 2, 2, 1, 0, 5, 1, 2, 2, 1)
 };
 
 static const int expected_block_access_counts [ACTION_COUNT] [BLOCK_COUNT] = {
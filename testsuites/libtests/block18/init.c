@@ -0,0 +1,252 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <rtems/bdbuf.h>
+
+const char rtems_test_name[] = "BLOCK 18";
+
+#define BLOCK_COUNT 64
+
+#define CACHE_BLOCK_COUNT 8
+
+#define SCAN_BEGIN 16
+
+#define HOLD_BEGIN 8
+
+#define HOLD_COUNT 6
+
+#define DISK_PATH "/disk"
+
+static int block_access_counts [BLOCK_COUNT];
+
+static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *breq = arg;
+    rtems_blkdev_sg_buffer *sg = breq->bufs;
+    uint32_t i;
+
+    for (i = 0; i < breq->bufnum; ++i) {
+      rtems_blkdev_bnum block = sg [i].block;
+
+      rtems_test_assert(block < BLOCK_COUNT);
+
+      ++block_access_counts [block];
+    }
+
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else {
+    rv = rtems_blkdev_ioctl(dd, req, arg);
+  }
+
+  return rv;
+}
+
+static void read_block(rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_read(dd, block, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_release(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_scan_resistance(rtems_disk_device *dd)
+{
+  rtems_blkdev_stats stats;
+  rtems_blkdev_bnum block;
+
+  /*
+   * Two metadata blocks are used repeatedly.  The re-references are outside
+   * the correlated reference window of two blocks.
+   */
+  read_block(dd, 0);
+  read_block(dd, 1);
+  read_block(dd, 2);
+  read_block(dd, 3);
+  read_block(dd, 0);
+  read_block(dd, 1);
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_misses == 4);
+  rtems_test_assert(stats.read_hits == 2);
+  rtems_test_assert(stats.recent_hits == 2);
+  rtems_test_assert(stats.frequent_hits == 0);
+  rtems_test_assert(stats.recent_misses == 4);
+  rtems_test_assert(stats.frequent_misses == 0);
+
+  /* A correlated re-reference does not promote the block */
+  read_block(dd, 4);
+  read_block(dd, 4);
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_misses == 5);
+  rtems_test_assert(stats.read_hits == 3);
+  rtems_test_assert(stats.recent_hits == 3);
+  rtems_test_assert(stats.frequent_hits == 0);
+  rtems_test_assert(stats.recent_misses == 5);
+  rtems_test_assert(stats.frequent_misses == 0);
+
+  /* A sequential scan reads much more blocks than the cache can hold */
+  for (block = SCAN_BEGIN; block < BLOCK_COUNT; ++block) {
+    read_block(dd, block);
+  }
+
+  for (block = SCAN_BEGIN; block < BLOCK_COUNT; ++block) {
+    rtems_test_assert(block_access_counts [block] == 1);
+  }
+
+  /* The metadata blocks are still in the cache */
+  read_block(dd, 0);
+  read_block(dd, 1);
+
+  rtems_test_assert(block_access_counts [0] == 1);
+  rtems_test_assert(block_access_counts [1] == 1);
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_misses == 5 + BLOCK_COUNT - SCAN_BEGIN);
+  rtems_test_assert(stats.read_hits == 5);
+  rtems_test_assert(stats.recent_hits == 3);
+  rtems_test_assert(stats.frequent_hits == 2);
+  rtems_test_assert(stats.recent_misses == 5 + BLOCK_COUNT - SCAN_BEGIN);
+  rtems_test_assert(stats.frequent_misses == 0);
+
+  /* The first scan blocks and the correlated block were evicted */
+  read_block(dd, SCAN_BEGIN);
+  rtems_test_assert(block_access_counts [SCAN_BEGIN] == 2);
+  read_block(dd, 4);
+  rtems_test_assert(block_access_counts [4] == 2);
+}
+
+static void test_frequent_miss(rtems_disk_device *dd)
+{
+  rtems_status_code sc;
+  rtems_blkdev_stats stats;
+  rtems_bdbuf_buffer *bd [HOLD_COUNT];
+  int i;
+
+  /* Use all buffers of the recent queue */
+  for (i = 0; i < HOLD_COUNT; ++i) {
+    sc = rtems_bdbuf_read(dd, HOLD_BEGIN + i, &bd [i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  /* A miss recycles the least recently used buffer of the frequent queue */
+  read_block(dd, HOLD_BEGIN + HOLD_COUNT);
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.frequent_misses == 1);
+
+  for (i = 0; i < HOLD_COUNT; ++i) {
+    sc = rtems_bdbuf_release(bd [i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  read_block(dd, 1);
+  rtems_test_assert(block_access_counts [1] == 1);
+  read_block(dd, 0);
+  rtems_test_assert(block_access_counts [0] == 2);
+}
+
+static void test(void)
+{
+  rtems_status_code sc;
+  rtems_disk_device *dd;
+  int fd;
+  int rv;
+
+  sc = rtems_blkdev_create(
+    DISK_PATH,
+    1,
+    BLOCK_COUNT,
+    test_disk_ioctl,
+    NULL
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fd = open(DISK_PATH, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &dd);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  test_scan_resistance(dd);
+  test_frequent_miss(dd);
+
+  rv = unlink(DISK_PATH);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE 1
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE 1
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE CACHE_BLOCK_COUNT
+#define CONFIGURE_BDBUF_REPLACEMENT_POLICY RTEMS_BDBUF_REPLACEMENT_POLICY_2Q
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
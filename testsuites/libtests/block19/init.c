@@ -0,0 +1,245 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/bdbuf.h>
+
+const char rtems_test_name[] = "BLOCK 19";
+
+#define BLOCK_COUNT 32
+
+#define MAX_WRITE_GAP_BLOCKS 2
+
+#define DISK_PATH "/disk"
+
+static int block_write_counts [BLOCK_COUNT];
+
+static uint32_t read_requests;
+
+static uint32_t write_requests;
+
+static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *breq = arg;
+    rtems_blkdev_sg_buffer *sg = breq->bufs;
+    uint32_t i;
+
+    if (breq->req == RTEMS_BLKDEV_REQ_READ) {
+      ++read_requests;
+    } else {
+      ++write_requests;
+
+      for (i = 0; i < breq->bufnum; ++i) {
+        rtems_blkdev_bnum block = sg [i].block;
+
+        rtems_test_assert(block < BLOCK_COUNT);
+        rtems_test_assert(i == 0 || block == sg [i - 1].block + 1);
+
+        ++block_write_counts [block];
+      }
+    }
+
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else if (req == RTEMS_BLKIO_CAPABILITIES) {
+    *(uint32_t *) arg = RTEMS_BLKDEV_CAP_MULTISECTOR_CONT;
+  } else {
+    rv = rtems_blkdev_ioctl(dd, req, arg);
+  }
+
+  return rv;
+}
+
+static void read_block(rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_read(dd, block, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_release(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void modify_block(rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_get(dd, block, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_release_modified(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void sync_and_check(
+  rtems_disk_device *dd,
+  uint32_t expected_write_requests,
+  const int *expected_block_write_counts,
+  uint32_t expected_write_gap_blocks
+)
+{
+  rtems_status_code sc;
+  rtems_blkdev_stats stats;
+
+  write_requests = 0;
+  memset(block_write_counts, 0, sizeof(block_write_counts));
+
+  sc = rtems_bdbuf_syncdev(dd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(write_requests == expected_write_requests);
+  rtems_test_assert(
+    memcmp(
+      block_write_counts,
+      expected_block_write_counts,
+      sizeof(block_write_counts)
+    ) == 0
+  );
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.write_gap_blocks == expected_write_gap_blocks);
+}
+
+static void test_write_gaps(rtems_disk_device *dd)
+{
+  static const int filled [BLOCK_COUNT] = {
+    1, 1, 1, 1, 1, 1, 1
+  };
+  static const int too_large [BLOCK_COUNT] = {
+    [10] = 1, [14] = 1
+  };
+  static const int not_cached [BLOCK_COUNT] = {
+    [20] = 1, [22] = 1
+  };
+  rtems_blkdev_bnum block;
+
+  for (block = 0; block < 20; ++block) {
+    read_block(dd, block);
+  }
+
+  /* The gaps 1 and 4 to 5 are filled with cached blocks */
+  modify_block(dd, 0);
+  modify_block(dd, 2);
+  modify_block(dd, 3);
+  modify_block(dd, 6);
+  sync_and_check(dd, 1, filled, 3);
+
+  /* The gap 11 to 13 is larger than the maximum write gap */
+  modify_block(dd, 10);
+  modify_block(dd, 14);
+  sync_and_check(dd, 2, too_large, 3);
+
+  /* The block 21 is not cached */
+  modify_block(dd, 20);
+  modify_block(dd, 22);
+  sync_and_check(dd, 2, not_cached, 3);
+
+  /* The written gap blocks are still cached */
+  read_requests = 0;
+  read_block(dd, 1);
+  read_block(dd, 4);
+  read_block(dd, 5);
+  rtems_test_assert(read_requests == 0);
+}
+
+static void test(void)
+{
+  rtems_status_code sc;
+  rtems_disk_device *dd;
+  int fd;
+  int rv;
+
+  sc = rtems_blkdev_create(
+    DISK_PATH,
+    1,
+    BLOCK_COUNT,
+    test_disk_ioctl,
+    NULL
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fd = open(DISK_PATH, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &dd);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  test_write_gaps(dd);
+
+  rv = unlink(DISK_PATH);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE 1
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE 1
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE BLOCK_COUNT
+#define CONFIGURE_BDBUF_MAX_WRITE_GAP_BLOCKS MAX_WRITE_GAP_BLOCKS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
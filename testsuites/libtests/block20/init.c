@@ -0,0 +1,198 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/bdbuf.h>
+
+const char rtems_test_name[] = "BLOCK 20";
+
+#define BLOCK_SIZE 4
+
+#define BLOCK_COUNT 16
+
+#define MODIFIED_BLOCK 3
+
+#define MODIFIED_DATA 0xff
+
+#define DISK_PATH "/disk"
+
+static uint32_t read_requests;
+
+static uint32_t read_blocks;
+
+static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *breq = arg;
+    rtems_blkdev_sg_buffer *sg = breq->bufs;
+    uint32_t i;
+
+    if (breq->req == RTEMS_BLKDEV_REQ_READ) {
+      ++read_requests;
+
+      for (i = 0; i < breq->bufnum; ++i) {
+        rtems_blkdev_bnum block = sg [i].block;
+
+        rtems_test_assert(block < BLOCK_COUNT);
+        rtems_test_assert(sg [i].length == BLOCK_SIZE);
+
+        memset(sg [i].buffer, (int) block, BLOCK_SIZE);
+        ++read_blocks;
+      }
+    }
+
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else {
+    rv = rtems_blkdev_ioctl(dd, req, arg);
+  }
+
+  return rv;
+}
+
+static void test_read_direct(rtems_disk_device *dd)
+{
+  static uint8_t buf [BLOCK_COUNT * BLOCK_SIZE];
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+  rtems_blkdev_stats stats;
+  rtems_blkdev_bnum block;
+
+  /* The cached block has modifications not yet written to the device */
+  sc = rtems_bdbuf_get(dd, MODIFIED_BLOCK, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  memset(bd->buffer, MODIFIED_DATA, BLOCK_SIZE);
+
+  sc = rtems_bdbuf_release_modified(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_read_direct(dd, 0, BLOCK_COUNT, buf);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (block = 0; block < BLOCK_COUNT; ++block) {
+    uint8_t expected = block == MODIFIED_BLOCK ? MODIFIED_DATA : block;
+    size_t i;
+
+    for (i = 0; i < BLOCK_SIZE; ++i) {
+      rtems_test_assert(buf [block * BLOCK_SIZE + i] == expected);
+    }
+  }
+
+  rtems_test_assert(read_requests == 2);
+  rtems_test_assert(read_blocks == BLOCK_COUNT - 1);
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_direct_transfers == 2);
+  rtems_test_assert(stats.read_blocks == BLOCK_COUNT - 1);
+  rtems_test_assert(stats.read_hits == 1);
+  rtems_test_assert(stats.read_misses == 0);
+
+  /* The blocks read directly were not added to the cache */
+  sc = rtems_bdbuf_read(dd, 0, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(read_requests == 3);
+
+  sc = rtems_bdbuf_release(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_read_direct(dd, BLOCK_COUNT - 1, 2, buf);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+}
+
+static void test(void)
+{
+  rtems_status_code sc;
+  rtems_disk_device *dd;
+  int fd;
+  int rv;
+
+  sc = rtems_blkdev_create(
+    DISK_PATH,
+    BLOCK_SIZE,
+    BLOCK_COUNT,
+    test_disk_ioctl,
+    NULL
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fd = open(DISK_PATH, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &dd);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  test_read_direct(dd);
+
+  rv = unlink(DISK_PATH);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE BLOCK_SIZE
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE BLOCK_SIZE
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE (BLOCK_COUNT * BLOCK_SIZE)
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
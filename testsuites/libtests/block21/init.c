@@ -0,0 +1,300 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/bdbuf.h>
+
+const char rtems_test_name[] = "BLOCK 21";
+
+#define BLOCK_COUNT 128
+
+#define CACHE_BLOCK_COUNT 64
+
+#define MAX_READ_AHEAD 8
+
+#define STREAM_A 0
+
+#define STREAM_B 64
+
+#define STREAM_LENGTH 24
+
+#define DISK_PATH "/disk"
+
+static int block_access_counts [BLOCK_COUNT];
+
+static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *breq = arg;
+    rtems_blkdev_sg_buffer *sg = breq->bufs;
+    uint32_t i;
+
+    rtems_test_assert(breq->req == RTEMS_BLKDEV_REQ_READ);
+
+    for (i = 0; i < breq->bufnum; ++i) {
+      rtems_blkdev_bnum block = sg [i].block;
+
+      rtems_test_assert(block < BLOCK_COUNT);
+
+      ++block_access_counts [block];
+    }
+
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else {
+    rv = rtems_blkdev_ioctl(dd, req, arg);
+  }
+
+  return rv;
+}
+
+static void read_block(rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_read(dd, block, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_release(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static const rtems_blkdev_read_ahead_stream *find_stream(
+  const rtems_disk_device *dd,
+  rtems_blkdev_bnum begin,
+  rtems_blkdev_bnum end
+)
+{
+  const rtems_blkdev_read_ahead_stream *found = NULL;
+  size_t i;
+
+  for (i = 0; i < RTEMS_DISK_READ_AHEAD_STREAM_COUNT; ++i) {
+    const rtems_blkdev_read_ahead_stream *stream = &dd->read_ahead.streams [i];
+
+    if (
+      stream->trigger != RTEMS_DISK_READ_AHEAD_NO_TRIGGER
+        && begin <= stream->trigger
+        && stream->trigger < end
+    ) {
+      rtems_test_assert(found == NULL);
+      found = stream;
+    }
+  }
+
+  rtems_test_assert(found != NULL);
+
+  return found;
+}
+
+static void reset(rtems_disk_device *dd)
+{
+  rtems_bdbuf_purge_dev(dd);
+  rtems_bdbuf_reset_device_stats(dd);
+  memset(&block_access_counts, 0, sizeof(block_access_counts));
+}
+
+static void test_interleaved_streams(rtems_disk_device *dd)
+{
+  rtems_blkdev_stats stats;
+  rtems_blkdev_bnum i;
+
+  reset(dd);
+
+  for (i = 0; i < STREAM_LENGTH; ++i) {
+    read_block(dd, STREAM_A + i);
+    read_block(dd, STREAM_B + i);
+  }
+
+  /* Each block was transferred exactly once */
+  for (i = 0; i < STREAM_LENGTH; ++i) {
+    rtems_test_assert(block_access_counts [STREAM_A + i] == 1);
+    rtems_test_assert(block_access_counts [STREAM_B + i] == 1);
+  }
+
+  /* Only the first two blocks of each stream were not read ahead */
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_misses == 4);
+  rtems_test_assert(stats.read_hits == 2 * STREAM_LENGTH - 4);
+  rtems_test_assert(stats.read_ahead_streams == 2);
+  rtems_test_assert(stats.read_ahead_misses == 0);
+  rtems_test_assert(stats.read_ahead_hits > 0);
+
+  /* Both streams are still active */
+  find_stream(dd, STREAM_A, STREAM_B);
+  find_stream(dd, STREAM_B, BLOCK_COUNT);
+}
+
+static void evict_all(rtems_disk_device *dd)
+{
+  rtems_bdbuf_buffer *bds [CACHE_BLOCK_COUNT];
+  rtems_status_code sc;
+  size_t i;
+
+  for (i = 0; i < CACHE_BLOCK_COUNT; ++i) {
+    sc = rtems_bdbuf_get(dd, BLOCK_COUNT - CACHE_BLOCK_COUNT + i, &bds [i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  for (i = 0; i < CACHE_BLOCK_COUNT; ++i) {
+    sc = rtems_bdbuf_release(bds [i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void test_window_shrink_and_growth(rtems_disk_device *dd)
+{
+  const rtems_blkdev_read_ahead_stream *stream;
+  rtems_blkdev_stats stats;
+  rtems_blkdev_bnum i;
+
+  reset(dd);
+
+  read_block(dd, 0);
+  read_block(dd, 1);
+
+  stream = find_stream(dd, 0, BLOCK_COUNT);
+  rtems_test_assert(stream->window == MAX_READ_AHEAD);
+  rtems_test_assert(stream->begin == 2);
+  rtems_test_assert(stream->trigger == 2 + MAX_READ_AHEAD / 2);
+  rtems_test_assert(stream->next == 2 + MAX_READ_AHEAD);
+
+  /*
+   * The blocks read ahead are evicted before use.  A miss before the trigger
+   * block shrinks the window and restarts the stream.
+   */
+  evict_all(dd);
+  read_block(dd, 2);
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_ahead_misses == 1);
+  rtems_test_assert(stream->window == MAX_READ_AHEAD / 2);
+  rtems_test_assert(stream->trigger == 3);
+
+  read_block(dd, 3);
+  rtems_test_assert(stream->begin == 4);
+  rtems_test_assert(stream->trigger == 4 + MAX_READ_AHEAD / 4);
+  rtems_test_assert(stream->next == 4 + MAX_READ_AHEAD / 2);
+
+  for (i = 2; i < 4 + MAX_READ_AHEAD / 2; ++i) {
+    rtems_test_assert(block_access_counts [i] == 2);
+  }
+
+  /* A hit on the trigger block grows the window */
+  for (i = 4; i <= 4 + MAX_READ_AHEAD / 4; ++i) {
+    read_block(dd, i);
+  }
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_ahead_hits == 1);
+  rtems_test_assert(stream->window == MAX_READ_AHEAD);
+  rtems_test_assert(stream->begin == 4 + MAX_READ_AHEAD / 2);
+  rtems_test_assert(stream->next == 4 + MAX_READ_AHEAD / 2 + MAX_READ_AHEAD);
+
+  for (i = 2 + MAX_READ_AHEAD; i < stream->next; ++i) {
+    rtems_test_assert(block_access_counts [i] == 1);
+  }
+}
+
+static void test(void)
+{
+  rtems_status_code sc;
+  rtems_disk_device *dd;
+  int fd;
+  int rv;
+
+  sc = rtems_blkdev_create(
+    DISK_PATH,
+    1,
+    BLOCK_COUNT,
+    test_disk_ioctl,
+    NULL
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fd = open(DISK_PATH, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &dd);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  test_interleaved_streams(dd);
+  test_window_shrink_and_growth(dd);
+
+  rv = unlink(DISK_PATH);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE 1
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE 1
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE CACHE_BLOCK_COUNT
+#define CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS MAX_READ_AHEAD
+#define CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY 1
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
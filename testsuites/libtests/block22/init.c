@@ -0,0 +1,313 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <rtems/bdbuf.h>
+
+const char rtems_test_name[] = "BLOCK 22";
+
+#define DISK_COUNT 3
+
+#define BLOCK_COUNT 8
+
+#define CACHE_BLOCK_COUNT 12
+
+typedef struct {
+  uint8_t data [BLOCK_COUNT];
+  int read_counts [BLOCK_COUNT];
+  int write_counts [BLOCK_COUNT];
+  rtems_disk_device *dd;
+} test_disk;
+
+static test_disk test_disks [DISK_COUNT];
+
+static const char disk_paths [DISK_COUNT] [sizeof("/disk0")] = {
+  "/disk0",
+  "/disk1",
+  "/disk2"
+};
+
+static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    test_disk *disk = rtems_disk_get_driver_data(dd);
+    rtems_blkdev_request *breq = arg;
+    rtems_blkdev_sg_buffer *sg = breq->bufs;
+    uint32_t i;
+
+    for (i = 0; i < breq->bufnum; ++i) {
+      rtems_blkdev_bnum block = sg [i].block;
+      uint8_t *buffer = sg [i].buffer;
+
+      rtems_test_assert(block < BLOCK_COUNT);
+      rtems_test_assert(sg [i].length == 1);
+
+      if (breq->req == RTEMS_BLKDEV_REQ_READ) {
+        ++disk->read_counts [block];
+        buffer [0] = disk->data [block];
+      } else {
+        ++disk->write_counts [block];
+        disk->data [block] = buffer [0];
+      }
+    }
+
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else {
+    rv = rtems_blkdev_ioctl(dd, req, arg);
+  }
+
+  return rv;
+}
+
+static uint8_t block_data(int disk, rtems_blkdev_bnum block)
+{
+  return (uint8_t) ((disk << 4) | block);
+}
+
+static void read_block(
+  int disk,
+  rtems_blkdev_bnum block,
+  int expected_read_count
+)
+{
+  test_disk *td = &test_disks [disk];
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_read(td->dd, block, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(bd->block == block);
+  rtems_test_assert(bd->dd == td->dd);
+  rtems_test_assert(bd->buffer [0] == td->data [block]);
+
+  sc = rtems_bdbuf_release(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(td->read_counts [block] == expected_read_count);
+}
+
+static void check_stats(int disk, uint32_t hits, uint32_t misses)
+{
+  rtems_blkdev_stats stats;
+
+  rtems_bdbuf_get_device_stats(test_disks [disk].dd, &stats);
+  rtems_test_assert(stats.read_hits == hits);
+  rtems_test_assert(stats.read_misses == misses);
+  rtems_test_assert(stats.read_ahead_transfers == 0);
+}
+
+static void test_lookup(void)
+{
+  int disk;
+
+  /* The same block number is a distinct buffer on each device */
+  for (disk = 0; disk < DISK_COUNT; ++disk) {
+    read_block(disk, 0, 1);
+    read_block(disk, 1, 1);
+  }
+
+  for (disk = 0; disk < DISK_COUNT; ++disk) {
+    read_block(disk, 0, 1);
+    read_block(disk, 1, 1);
+    check_stats(disk, 2, 2);
+  }
+}
+
+static void test_insert(void)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd [DISK_COUNT];
+  int disk;
+
+  /* Hold the same block number on all devices at the same time */
+  for (disk = 0; disk < DISK_COUNT; ++disk) {
+    sc = rtems_bdbuf_get(test_disks [disk].dd, 2, &bd [disk]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    bd [disk]->buffer [0] = block_data(disk, 2);
+  }
+
+  /* Hits on other devices work while the buffers are held */
+  for (disk = 0; disk < DISK_COUNT; ++disk) {
+    read_block(disk, 0, 1);
+  }
+
+  for (disk = 0; disk < DISK_COUNT; ++disk) {
+    rtems_test_assert(bd [disk]->buffer [0] == block_data(disk, 2));
+
+    sc = rtems_bdbuf_sync(bd [disk]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  for (disk = 0; disk < DISK_COUNT; ++disk) {
+    test_disk *td = &test_disks [disk];
+
+    rtems_test_assert(td->data [2] == block_data(disk, 2));
+    rtems_test_assert(td->write_counts [2] == 1);
+
+    read_block(disk, 2, 0);
+    check_stats(disk, 4, 2);
+  }
+}
+
+static void test_purge(void)
+{
+  /* A purge discards only the buffers of the purged device */
+  rtems_bdbuf_purge_dev(test_disks [1].dd);
+
+  read_block(0, 2, 0);
+  read_block(2, 2, 0);
+  read_block(1, 2, 1);
+  read_block(1, 0, 2);
+
+  check_stats(0, 5, 2);
+  check_stats(1, 4, 4);
+  check_stats(2, 5, 2);
+}
+
+static void test_recycle(void)
+{
+  rtems_blkdev_stats stats;
+  rtems_blkdev_bnum block;
+  int disk;
+
+  /* Buffers are recycled across devices and keep their device data */
+  for (block = 0; block < BLOCK_COUNT; ++block) {
+    read_block(2, block, test_disks [2].read_counts [block] + (block > 2));
+  }
+
+  for (disk = 0; disk < DISK_COUNT; ++disk) {
+    test_disk *td = &test_disks [disk];
+    int read_count = 0;
+
+    for (block = 0; block < BLOCK_COUNT; ++block) {
+      rtems_status_code sc;
+      rtems_bdbuf_buffer *bd;
+
+      sc = rtems_bdbuf_read(td->dd, block, &bd);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+      rtems_test_assert(bd->buffer [0] == td->data [block]);
+
+      sc = rtems_bdbuf_release(bd);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+      read_count += td->read_counts [block];
+    }
+
+    rtems_bdbuf_get_device_stats(td->dd, &stats);
+    rtems_test_assert(stats.read_misses == (uint32_t) read_count);
+  }
+}
+
+static void test(void)
+{
+  int disk;
+
+  for (disk = 0; disk < DISK_COUNT; ++disk) {
+    test_disk *td = &test_disks [disk];
+    rtems_status_code sc;
+    rtems_blkdev_bnum block;
+    int fd;
+    int rv;
+
+    for (block = 0; block < BLOCK_COUNT; ++block) {
+      td->data [block] = block_data(disk, block);
+    }
+
+    sc = rtems_blkdev_create(
+      disk_paths [disk],
+      1,
+      BLOCK_COUNT,
+      test_disk_ioctl,
+      td
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    fd = open(disk_paths [disk], O_RDWR);
+    rtems_test_assert(fd >= 0);
+
+    rv = rtems_disk_fd_get_disk_device(fd, &td->dd);
+    rtems_test_assert(rv == 0);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+
+  test_lookup();
+  test_insert();
+  test_purge();
+  test_recycle();
+
+  for (disk = 0; disk < DISK_COUNT; ++disk) {
+    int rv;
+
+    rv = unlink(disk_paths [disk]);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE 1
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE 1
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE CACHE_BLOCK_COUNT
+#define CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS 0
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
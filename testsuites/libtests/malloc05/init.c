@@ -0,0 +1,275 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/malloc.h>
+#include <rtems/libcsupport.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <tmacros.h>
+
+const char rtems_test_name[] = "MALLOC 5";
+
+#define SMALL_COUNT 64
+
+static void *small[SMALL_COUNT];
+
+static void *double_free;
+
+static void get_statistics(rtems_malloc_cache_statistics *stats)
+{
+  bool ok;
+
+  ok = rtems_malloc_cache_get_statistics(stats);
+  rtems_test_assert(ok);
+}
+
+static void test_hit_after_free(void)
+{
+  rtems_malloc_cache_statistics before;
+  rtems_malloc_cache_statistics after;
+  void *p;
+  void *q;
+
+  p = malloc(24);
+  rtems_test_assert(p != NULL);
+  memset(p, 0xaa, 24);
+
+  get_statistics(&before);
+  free(p);
+  get_statistics(&after);
+  rtems_test_assert(after.frees == before.frees + 1);
+  rtems_test_assert(after.cached_blocks == before.cached_blocks + 1);
+
+  q = malloc(20);
+  rtems_test_assert(q == p);
+  get_statistics(&before);
+  rtems_test_assert(before.hits == after.hits + 1);
+  rtems_test_assert(before.cached_blocks == after.cached_blocks - 1);
+
+  free(q);
+}
+
+static void test_large_bypasses_cache(void)
+{
+  rtems_malloc_cache_statistics before;
+  rtems_malloc_cache_statistics after;
+  void *p;
+
+  get_statistics(&before);
+  p = malloc(4096);
+  rtems_test_assert(p != NULL);
+  free(p);
+  get_statistics(&after);
+  rtems_test_assert(after.hits == before.hits);
+  rtems_test_assert(after.misses == before.misses);
+  rtems_test_assert(after.frees == before.frees);
+}
+
+static void test_refill_and_drain(void)
+{
+  rtems_malloc_cache_statistics before;
+  rtems_malloc_cache_statistics after;
+  size_t i;
+
+  get_statistics(&before);
+
+  for (i = 0; i < SMALL_COUNT; ++i) {
+    small[i] = malloc(100);
+    rtems_test_assert(small[i] != NULL);
+  }
+
+  get_statistics(&after);
+  rtems_test_assert(after.refills > before.refills);
+  rtems_test_assert(after.misses > before.misses);
+
+  for (i = 0; i < SMALL_COUNT; ++i) {
+    free(small[i]);
+  }
+
+  get_statistics(&before);
+  rtems_test_assert(before.drains > after.drains);
+  rtems_test_assert(before.frees == after.frees + SMALL_COUNT);
+}
+
+static void test_realloc_cached_block(void)
+{
+  char *p;
+  char *q;
+
+  p = malloc(32);
+  rtems_test_assert(p != NULL);
+  memset(p, 0x55, 32);
+
+  q = realloc(p, 1000);
+  rtems_test_assert(q != NULL);
+  rtems_test_assert(q[0] == 0x55);
+  rtems_test_assert(q[31] == 0x55);
+
+  free(q);
+}
+
+static void test_malloc_info(void)
+{
+  Heap_Information_block info;
+  rtems_malloc_cache_statistics stats;
+  uintptr_t used;
+  void *p;
+  int rv;
+
+  p = malloc(48);
+  rtems_test_assert(p != NULL);
+
+  rv = malloc_info(&info);
+  rtems_test_assert(rv == 0);
+  used = info.Used.number;
+
+  free(p);
+
+  get_statistics(&stats);
+  rtems_test_assert(stats.cached_blocks > 0);
+  rtems_test_assert(stats.cached_bytes >= 48);
+
+  rv = malloc_info(&info);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(info.Used.number == used - 1);
+}
+
+static void test_drain_on_exhaustion(void)
+{
+  rtems_malloc_cache_statistics stats;
+  void **blocks;
+  void *greedy;
+  void *p;
+  uintptr_t size;
+  size_t count;
+  size_t max;
+  size_t i;
+
+  max = 4096;
+  blocks = calloc(max, sizeof(*blocks));
+  rtems_test_assert(blocks != NULL);
+
+  greedy = rtems_heap_greedy_allocate_all_except_largest(&size);
+  rtems_test_assert(size > 4096);
+  count = 0;
+
+  while (count < max) {
+    p = malloc(200);
+
+    if (p == NULL) {
+      break;
+    }
+
+    blocks[count] = p;
+    ++count;
+  }
+
+  rtems_test_assert(count < max);
+
+  for (i = 0; i < count; ++i) {
+    free(blocks[i]);
+  }
+
+  get_statistics(&stats);
+  rtems_test_assert(stats.cached_bytes > 1024);
+
+  /*
+   * This allocation is only satisfiable if the cached blocks are returned to
+   * the heap.
+   */
+  p = malloc(size - 1024);
+  rtems_test_assert(p != NULL);
+
+  get_statistics(&stats);
+  rtems_test_assert(stats.cached_blocks == 0);
+  rtems_test_assert(stats.cached_bytes == 0);
+
+  free(p);
+  rtems_heap_greedy_free(greedy);
+  free(blocks);
+}
+
+static void test_double_free(void)
+{
+  double_free = malloc(32);
+  rtems_test_assert(double_free != NULL);
+  free(double_free);
+  free(double_free);
+  rtems_test_assert(0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test_hit_after_free();
+  test_large_bypasses_cache();
+  test_refill_and_drain();
+  test_realloc_cached_block();
+  test_malloc_info();
+  test_drain_on_exhaustion();
+  test_double_free();
+}
+
+static void fatal_extension(
+  rtems_fatal_source source,
+  bool always_set_to_false,
+  rtems_fatal_code error
+)
+{
+  if (
+    source == RTEMS_FATAL_SOURCE_INVALID_HEAP_FREE
+      && !always_set_to_false
+      && error == (rtems_fatal_code) double_free
+  ) {
+    TEST_END();
+  }
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MALLOC_PER_CPU_CACHE
+
+#define CONFIGURE_INITIAL_EXTENSIONS \
+  { .fatal = fatal_extension }, \
+  RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
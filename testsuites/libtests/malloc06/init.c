@@ -0,0 +1,248 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/malloc.h>
+#include <rtems/score/heapimpl.h>
+
+#include <stdlib.h>
+
+#include <tmacros.h>
+
+const char rtems_test_name[] = "MALLOC 6";
+
+#define BLOCK_COUNT 64
+
+static char area[ 64 * 1024 ] RTEMS_ALIGNED( CPU_HEAP_ALIGNMENT );
+
+static char extend_area[ 16 * 1024 ] RTEMS_ALIGNED( CPU_HEAP_ALIGNMENT );
+
+static Heap_Control heap;
+
+static Heap_Free_index free_index;
+
+static void *blocks[ BLOCK_COUNT ];
+
+static void check_heap( void )
+{
+  bool ok;
+
+  ok = _Heap_Walk( &heap, 0, false );
+  rtems_test_assert( ok );
+}
+
+static void *allocate( uintptr_t size )
+{
+  void *p;
+
+  p = _Heap_Allocate( &heap, size );
+  rtems_test_assert( p != NULL );
+
+  return p;
+}
+
+static void release( void *p )
+{
+  bool ok;
+
+  ok = _Heap_Free( &heap, p );
+  rtems_test_assert( ok );
+}
+
+static void test_initialize( void )
+{
+  uintptr_t size;
+
+  size = _Heap_Initialize( &heap, area, sizeof( area ), 0 );
+  rtems_test_assert( size > 0 );
+  rtems_test_assert( heap.free_index == NULL );
+
+  _Heap_Initialize_free_index( &heap, &free_index );
+  rtems_test_assert( heap.free_index == &free_index );
+  rtems_test_assert( free_index.first_level_bitmap != 0 );
+  check_heap();
+}
+
+static void test_fragmented_good_fit( void )
+{
+  Heap_Statistics *stats;
+  uint32_t searches;
+  size_t i;
+  void *p;
+
+  stats = &heap.stats;
+
+  for ( i = 0; i < BLOCK_COUNT; ++i ) {
+    blocks[ i ] = allocate( 16 + 8 * i );
+  }
+
+  check_heap();
+
+  /* Free every other block to get free blocks of many size classes */
+  for ( i = 0; i < BLOCK_COUNT; i += 2 ) {
+    release( blocks[ i ] );
+    blocks[ i ] = NULL;
+  }
+
+  check_heap();
+
+  /* A large enough block must be found without a linear search */
+  searches = stats->searches;
+  p = allocate( 300 );
+  rtems_test_assert( stats->searches == searches + 1 );
+  check_heap();
+  release( p );
+
+  searches = stats->searches;
+  p = allocate( 24 );
+  rtems_test_assert( stats->searches == searches + 1 );
+  check_heap();
+  release( p );
+
+  for ( i = 1; i < BLOCK_COUNT; i += 2 ) {
+    release( blocks[ i ] );
+    blocks[ i ] = NULL;
+  }
+
+  check_heap();
+  rtems_test_assert( stats->free_blocks == 1 );
+}
+
+static void test_aligned( void )
+{
+  void *p;
+  void *q;
+  void *r;
+
+  p = allocate( 100 );
+  q = _Heap_Allocate_aligned_with_boundary( &heap, 200, 256, 0 );
+  rtems_test_assert( q != NULL );
+  rtems_test_assert( ( (uintptr_t) q & 255 ) == 0 );
+  check_heap();
+
+  r = _Heap_Allocate_aligned_with_boundary( &heap, 64, 0, 128 );
+  rtems_test_assert( r != NULL );
+  rtems_test_assert(
+    ( (uintptr_t) r & ~(uintptr_t) 127 )
+      == ( ( (uintptr_t) r + 63 ) & ~(uintptr_t) 127 )
+  );
+  check_heap();
+
+  release( p );
+  check_heap();
+  release( q );
+  check_heap();
+  release( r );
+  check_heap();
+  rtems_test_assert( heap.stats.free_blocks == 1 );
+}
+
+static void test_resize( void )
+{
+  Heap_Resize_status status;
+  uintptr_t old_size;
+  uintptr_t new_size;
+  void *p;
+  void *q;
+
+  p = allocate( 64 );
+  q = allocate( 512 );
+  release( q );
+
+  status = _Heap_Resize_block( &heap, p, 256, &old_size, &new_size );
+  rtems_test_assert( status == HEAP_RESIZE_SUCCESSFUL );
+  rtems_test_assert( new_size >= 256 );
+  check_heap();
+
+  release( p );
+  check_heap();
+}
+
+static void test_extend( void )
+{
+  uintptr_t size;
+  void *p;
+
+  size = _Heap_Extend( &heap, extend_area, sizeof( extend_area ), 0 );
+  rtems_test_assert( size > 0 );
+  check_heap();
+
+  p = allocate( sizeof( area ) / 2 );
+  check_heap();
+  release( p );
+  check_heap();
+}
+
+static void test_malloc( void )
+{
+  void *p;
+  bool ok;
+
+  rtems_test_assert( rtems_malloc_free_index != NULL );
+  rtems_test_assert( RTEMS_Malloc_Heap->free_index == rtems_malloc_free_index );
+
+  p = malloc( 123 );
+  rtems_test_assert( p != NULL );
+  free( p );
+
+  ok = malloc_walk( 0, false );
+  rtems_test_assert( ok );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+
+  test_initialize();
+  test_fragmented_good_fit();
+  test_aligned();
+  test_resize();
+  test_extend();
+  test_malloc();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MALLOC_SEGREGATED_FIT
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -56,6 +56,7 @@ static const rtems_filesystem_file_handlers_r node_handlers = {
   .poll_h = rtems_filesystem_default_poll,
   .kqfilter_h = rtems_filesystem_default_kqfilter,
   .mmap_h = handler_mmap,
+  .munmap_h = rtems_filesystem_default_munmap,
   .readv_h = rtems_filesystem_default_readv,
   .writev_h = rtems_filesystem_default_writev
 };
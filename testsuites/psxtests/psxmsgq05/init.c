@@ -0,0 +1,249 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <mqueue.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <tmacros.h>
+
+const char rtems_test_name[] = "PSXMSGQ 5";
+
+#define MESSAGE_COUNT 4
+
+#define MESSAGE_SIZE 8
+
+static char buffer[2 * MESSAGE_COUNT][MESSAGE_SIZE];
+
+static size_t lens[2 * MESSAGE_COUNT];
+
+static unsigned int prios[2 * MESSAGE_COUNT];
+
+static void prepare(unsigned int count)
+{
+  unsigned int i;
+
+  for (i = 0; i < count; ++i) {
+    memset(buffer[i], 'a' + (int) i, MESSAGE_SIZE);
+    lens[i] = i + 1;
+  }
+}
+
+static const char blocked_message[MESSAGE_SIZE] = "blocked";
+
+static volatile bool sender_done;
+
+static void *sender(void *arg)
+{
+  mqd_t mq;
+  int rv;
+
+  mq = *(mqd_t *) arg;
+  rv = mq_send(mq, blocked_message, sizeof(blocked_message), 1);
+  rtems_test_assert(rv == 0);
+  sender_done = true;
+
+  return NULL;
+}
+
+static void *POSIX_Init(void *arg)
+{
+  struct mq_attr attr;
+  pthread_t th;
+  mqd_t mq;
+  unsigned int i;
+  int n;
+  int rv;
+
+  TEST_BEGIN();
+
+  memset(&attr, 0, sizeof(attr));
+  attr.mq_maxmsg = MESSAGE_COUNT;
+  attr.mq_msgsize = MESSAGE_SIZE;
+  mq = mq_open("/batch", O_CREAT | O_RDWR | O_NONBLOCK, 0777, &attr);
+  rtems_test_assert(mq != (mqd_t) -1);
+
+  prepare(2);
+  n = mq_send_batch_np(mq, &buffer[0][0], MESSAGE_SIZE, lens, 2, 1);
+  rtems_test_assert(n == 2);
+
+  prepare(2);
+  n = mq_send_batch_np(mq, &buffer[0][0], MESSAGE_SIZE, lens, 2, 3);
+  rtems_test_assert(n == 2);
+
+  /* Higher priority messages are received first */
+  memset(buffer, 0, sizeof(buffer));
+  n = mq_receive_batch_np(
+    mq,
+    &buffer[0][0],
+    MESSAGE_SIZE,
+    lens,
+    prios,
+    2 * MESSAGE_COUNT
+  );
+  rtems_test_assert(n == 4);
+  rtems_test_assert(prios[0] == 3 && prios[1] == 3);
+  rtems_test_assert(prios[2] == 1 && prios[3] == 1);
+  rtems_test_assert(lens[0] == 1 && buffer[0][0] == 'a');
+  rtems_test_assert(lens[1] == 2 && buffer[1][1] == 'b');
+  rtems_test_assert(lens[2] == 1 && buffer[2][0] == 'a');
+  rtems_test_assert(lens[3] == 2 && buffer[3][1] == 'b');
+
+  errno = 0;
+  n = mq_receive_batch_np(mq, &buffer[0][0], MESSAGE_SIZE, lens, NULL, 1);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EAGAIN);
+
+  /* A full message queue stops the batch */
+  prepare(MESSAGE_COUNT + 1);
+  n = mq_send_batch_np(
+    mq,
+    &buffer[0][0],
+    MESSAGE_SIZE,
+    lens,
+    MESSAGE_COUNT + 1,
+    0
+  );
+  rtems_test_assert(n == MESSAGE_COUNT);
+
+  errno = 0;
+  n = mq_send_batch_np(mq, &buffer[0][0], MESSAGE_SIZE, lens, 1, 0);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EAGAIN);
+
+  n = mq_receive_batch_np(mq, &buffer[0][0], MESSAGE_SIZE, lens, NULL, 3);
+  rtems_test_assert(n == 3);
+  n = mq_receive_batch_np(mq, &buffer[0][0], MESSAGE_SIZE, lens, NULL, 3);
+  rtems_test_assert(n == 1);
+  rtems_test_assert(lens[0] == MESSAGE_COUNT);
+
+  errno = 0;
+  n = mq_receive_batch_np(mq, &buffer[0][0], MESSAGE_SIZE - 1, lens, NULL, 1);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EMSGSIZE);
+
+  errno = 0;
+  n = mq_receive_batch_np(mq, &buffer[0][0], MESSAGE_SIZE, lens, NULL, 0);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EINVAL);
+
+  errno = 0;
+  lens[0] = MESSAGE_SIZE + 1;
+  n = mq_send_batch_np(mq, &buffer[0][0], 2 * MESSAGE_SIZE, lens, 1, 0);
+  rtems_test_assert(n == -1);
+  rtems_test_assert(errno == EMSGSIZE);
+
+  /* A blocked sender refills the message queue during the batch */
+  memset(&attr, 0, sizeof(attr));
+  attr.mq_flags = O_RDWR;
+  rv = mq_setattr(mq, &attr, NULL);
+  rtems_test_assert(rv == 0);
+
+  prepare(MESSAGE_COUNT);
+  n = mq_send_batch_np(
+    mq,
+    &buffer[0][0],
+    MESSAGE_SIZE,
+    lens,
+    MESSAGE_COUNT,
+    1
+  );
+  rtems_test_assert(n == MESSAGE_COUNT);
+
+  rv = pthread_create(&th, NULL, sender, &mq);
+  rtems_test_assert(rv == 0);
+
+  rv = sched_yield();
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(!sender_done);
+
+  memset(buffer, 0, sizeof(buffer));
+  n = mq_receive_batch_np(
+    mq,
+    &buffer[0][0],
+    MESSAGE_SIZE,
+    lens,
+    prios,
+    2 * MESSAGE_COUNT
+  );
+  rtems_test_assert(n == MESSAGE_COUNT + 1);
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    rtems_test_assert(prios[i] == 1);
+    rtems_test_assert(lens[i] == i + 1);
+    rtems_test_assert(buffer[i][0] == 'a' + (int) i);
+  }
+
+  rtems_test_assert(prios[MESSAGE_COUNT] == 1);
+  rtems_test_assert(lens[MESSAGE_COUNT] == sizeof(blocked_message));
+  rtems_test_assert(
+    memcmp(buffer[MESSAGE_COUNT], blocked_message, sizeof(blocked_message))
+      == 0
+  );
+
+  rv = pthread_join(th, NULL);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(sender_done);
+
+  rv = mq_getattr(mq, &attr);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(attr.mq_curmsgs == 0);
+
+  rv = mq_close(mq);
+  rtems_test_assert(rv == 0);
+
+  rv = mq_unlink("/batch");
+  rtems_test_assert(rv == 0);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_POSIX_THREADS 2
+#define CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES 1
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE(MESSAGE_COUNT, MESSAGE_SIZE)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_POSIX_INIT_THREAD_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
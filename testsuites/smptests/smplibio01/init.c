@@ -0,0 +1,258 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/libio_.h>
+#include <rtems/score/atomic.h>
+#include <rtems/test.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPLIBIO 1";
+
+#define CPU_COUNT 32
+
+#define FILE_DESCRIPTOR_COUNT (3 + 8)
+
+#define OPEN_PER_WORKER 4
+
+#define WORKER_PRIORITY 2
+
+typedef struct {
+  rtems_test_parallel_context base;
+  uint32_t used_iops;
+  Atomic_Uint owner[FILE_DESCRIPTOR_COUNT];
+  Atomic_Uint double_allocations;
+  unsigned long open_count[CPU_COUNT];
+  unsigned long exhausted_count[CPU_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static const char file_path[] = "/file";
+
+static rtems_interval test_duration(void)
+{
+  return rtems_clock_get_ticks_per_second();
+}
+
+static void take_fd(test_context *ctx, int fd)
+{
+  unsigned int owners;
+
+  rtems_test_assert(fd >= 0 && fd < FILE_DESCRIPTOR_COUNT);
+
+  owners = _Atomic_Fetch_add_uint(&ctx->owner[fd], 1, ATOMIC_ORDER_RELAXED);
+
+  if (owners != 0) {
+    _Atomic_Fetch_add_uint(&ctx->double_allocations, 1, ATOMIC_ORDER_RELAXED);
+  }
+}
+
+static void give_fd(test_context *ctx, int fd)
+{
+  int rv;
+
+  _Atomic_Fetch_sub_uint(&ctx->owner[fd], 1, ATOMIC_ORDER_RELAXED);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static rtems_interval open_close_init(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t i;
+
+  for (i = 0; i < FILE_DESCRIPTOR_COUNT; ++i) {
+    _Atomic_Init_uint(&ctx->owner[i], 0);
+  }
+
+  _Atomic_Init_uint(&ctx->double_allocations, 0);
+
+  for (i = 0; i < active_workers; ++i) {
+    ctx->open_count[i] = 0;
+    ctx->exhausted_count[i] = 0;
+  }
+
+  return test_duration();
+}
+
+static void open_close_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  unsigned long open_count = 0;
+  unsigned long exhausted_count = 0;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    int fds[OPEN_PER_WORKER];
+    size_t n;
+    size_t i;
+
+    for (n = 0; n < OPEN_PER_WORKER; ++n) {
+      int fd;
+
+      fd = open(file_path, O_RDONLY);
+
+      if (fd < 0) {
+        rtems_test_assert(errno == ENFILE);
+        ++exhausted_count;
+        break;
+      }
+
+      take_fd(ctx, fd);
+      fds[n] = fd;
+      ++open_count;
+    }
+
+    for (i = 0; i < n; ++i) {
+      give_fd(ctx, fds[i]);
+    }
+  }
+
+  ctx->open_count[worker_index] = open_count;
+  ctx->exhausted_count[worker_index] = exhausted_count;
+}
+
+static void open_close_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t i;
+
+  printf("=== open and close test case, %zu workers ===\n", active_workers);
+
+  for (i = 0; i < active_workers; ++i) {
+    printf(
+      "worker %zu: open count %lu, exhausted count %lu\n",
+      i,
+      ctx->open_count[i],
+      ctx->exhausted_count[i]
+    );
+    rtems_test_assert(ctx->open_count[i] > 0);
+  }
+
+  rtems_test_assert(
+    _Atomic_Load_uint(&ctx->double_allocations, ATOMIC_ORDER_RELAXED) == 0
+  );
+  rtems_test_assert(rtems_libio_count_used_iops() == ctx->used_iops);
+}
+
+static const rtems_test_parallel_job test_jobs[] = {
+  {
+    .init = open_close_init,
+    .body = open_close_body,
+    .fini = open_close_fini,
+    .cascade = true
+  }
+};
+
+static void setup_worker(
+  rtems_test_parallel_context *base,
+  size_t worker_index,
+  rtems_id worker_id
+)
+{
+  rtems_status_code sc;
+  rtems_task_priority prio;
+
+  sc = rtems_task_set_priority(worker_id, WORKER_PRIORITY, &prio);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  int fd;
+  int rv;
+
+  TEST_BEGIN();
+
+  fd = open(file_path, O_WRONLY | O_CREAT, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  ctx->used_iops = rtems_libio_count_used_iops();
+
+  rtems_test_parallel(
+    &ctx->base,
+    setup_worker,
+    &test_jobs[0],
+    RTEMS_ARRAY_SIZE(test_jobs)
+  );
+
+  rtems_test_assert(rtems_libio_count_used_iops() == ctx->used_iops);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS FILE_DESCRIPTOR_COUNT
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY 1
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,388 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <time.h>
+
+#include <rtems.h>
+#include <rtems/libcsupport.h>
+#include <rtems/score/percpu.h>
+#include <rtems/score/smpimpl.h>
+
+#define CPU_COUNT 2
+
+#define SCHEDULER_A rtems_build_name(' ', ' ', ' ', 'A')
+
+#define SCHEDULER_B rtems_build_name(' ', ' ', ' ', 'B')
+
+/*
+ * The processor of scheduler B is idle for this count of ticks in the long
+ * idle periods.  This is far beyond one tick, so that a clock driver in the
+ * tickless idle mode programs the clock interrupt to a later tick boundary.
+ */
+#define LONG_TICKS 100
+
+/* The ticks to let the processor of scheduler B enter its idle period */
+#define SHORT_TICKS 5
+
+const char rtems_test_name[] = "SMPTICKLESS 1";
+
+typedef struct {
+  rtems_id main_task;
+  rtems_id worker_task;
+  rtems_id timer;
+  uint64_t timer_uptime;
+  uint32_t timer_cpu_index;
+  uint32_t irq_cpu_index;
+  uint64_t irq_ticks[CPU_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static void assert_elapsed(uint64_t begin, uint64_t end, rtems_interval ticks)
+{
+  uint64_t nanoseconds_per_tick;
+  uint64_t elapsed;
+
+  nanoseconds_per_tick = rtems_configuration_get_nanoseconds_per_tick();
+  elapsed = end - begin;
+
+  /* A delay of n ticks expires at the n-th tick boundary from now on */
+  rtems_test_assert(
+    elapsed + nanoseconds_per_tick >= ticks * nanoseconds_per_tick
+  );
+  rtems_test_assert(elapsed < (ticks + 2) * nanoseconds_per_tick);
+}
+
+static void wait_for_event(rtems_interval timeout)
+{
+  rtems_status_code sc;
+
+  sc = rtems_event_transient_receive(RTEMS_WAIT, timeout);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void start_worker(test_context *ctx, rtems_task_entry entry)
+{
+  rtems_status_code sc;
+  rtems_id scheduler_b_id;
+
+  sc = rtems_scheduler_ident(SCHEDULER_B, &scheduler_b_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->worker_task
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_set_scheduler(ctx->worker_task, scheduler_b_id, 1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(ctx->worker_task, entry, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void worker_done(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_event_transient_send(ctx->main_task);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* Wait for deletion */
+  (void) rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static void delete_worker(test_context *ctx, rtems_interval timeout)
+{
+  rtems_status_code sc;
+
+  wait_for_event(timeout);
+
+  sc = rtems_task_delete(ctx->worker_task);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void timer_wake_up_task(rtems_id id, void *arg)
+{
+  test_context *ctx = arg;
+  rtems_status_code sc;
+
+  ctx->timer_uptime = rtems_clock_get_uptime_nanoseconds();
+  ctx->timer_cpu_index = rtems_scheduler_get_processor();
+
+  sc = rtems_event_transient_send(ctx->worker_task);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void timer_wake_up_main(rtems_id id, void *arg)
+{
+  test_context *ctx = arg;
+  rtems_status_code sc;
+
+  ctx->timer_uptime = rtems_clock_get_uptime_nanoseconds();
+  ctx->timer_cpu_index = rtems_scheduler_get_processor();
+
+  sc = rtems_event_transient_send(ctx->main_task);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void long_idle_worker(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+  rtems_status_code sc;
+  struct timespec delay;
+  uint64_t nanoseconds;
+  uint64_t begin;
+  uint64_t end;
+  int rv;
+
+  rtems_test_assert(rtems_scheduler_get_processor() == 1);
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+  sc = rtems_task_wake_after(LONG_TICKS);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  end = rtems_clock_get_uptime_nanoseconds();
+  assert_elapsed(begin, end, LONG_TICKS);
+
+  nanoseconds = LONG_TICKS * rtems_configuration_get_nanoseconds_per_tick();
+  delay.tv_sec = (time_t) (nanoseconds / 1000000000);
+  delay.tv_nsec = (long) (nanoseconds % 1000000000);
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+  rv = nanosleep(&delay, NULL);
+  rtems_test_assert(rv == 0);
+  end = rtems_clock_get_uptime_nanoseconds();
+  assert_elapsed(begin, end, LONG_TICKS);
+
+  sc = rtems_timer_create(rtems_build_name('T', 'I', 'M', 'E'), &ctx->timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+  sc = rtems_timer_fire_after(ctx->timer, LONG_TICKS, timer_wake_up_task, ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  wait_for_event(2 * LONG_TICKS);
+  rtems_test_assert(ctx->timer_cpu_index == 1);
+  assert_elapsed(begin, ctx->timer_uptime, LONG_TICKS);
+
+  sc = rtems_timer_delete(ctx->timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  worker_done(ctx);
+}
+
+
+static void test_long_idle(test_context *ctx)
+{
+  start_worker(ctx, long_idle_worker);
+  delete_worker(ctx, 4 * LONG_TICKS);
+}
+
+static void cross_processor_worker(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+  rtems_status_code sc;
+
+  rtems_test_assert(rtems_scheduler_get_processor() == 1);
+
+  /* The timer is bound to the processor of scheduler B */
+  sc = rtems_timer_create(rtems_build_name('T', 'I', 'M', 'E'), &ctx->timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_transient_send(ctx->main_task);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* Leave the processor idle without a watchdog */
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_timer_delete(ctx->timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  worker_done(ctx);
+}
+
+static void test_cross_processor_timer(test_context *ctx)
+{
+  rtems_status_code sc;
+  uint64_t begin;
+
+  start_worker(ctx, cross_processor_worker);
+  wait_for_event(LONG_TICKS);
+
+  sc = rtems_task_wake_after(SHORT_TICKS);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /*
+   * The timer expires on the idle processor of scheduler B long before its
+   * next clock interrupt in the tickless idle mode.
+   */
+  begin = rtems_clock_get_uptime_nanoseconds();
+  sc = rtems_timer_fire_after(ctx->timer, SHORT_TICKS, timer_wake_up_main, ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  wait_for_event(LONG_TICKS);
+  rtems_test_assert(ctx->timer_cpu_index == 1);
+  assert_elapsed(begin, ctx->timer_uptime, SHORT_TICKS);
+
+  sc = rtems_event_transient_send(ctx->worker_task);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  delete_worker(ctx, LONG_TICKS);
+}
+
+static void interrupt_worker(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+  rtems_status_code sc;
+  uint64_t begin;
+  uint64_t end;
+
+  rtems_test_assert(rtems_scheduler_get_processor() == 1);
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+  sc = rtems_task_wake_after(LONG_TICKS);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  end = rtems_clock_get_uptime_nanoseconds();
+  assert_elapsed(begin, end, LONG_TICKS);
+
+  worker_done(ctx);
+}
+
+static void interrupt_action(void *arg)
+{
+  test_context *ctx = arg;
+  uint32_t cpu_index;
+
+  ctx->irq_cpu_index = rtems_scheduler_get_processor();
+
+  for (cpu_index = 0; cpu_index < CPU_COUNT; ++cpu_index) {
+    ctx->irq_ticks[cpu_index] =
+      _Per_CPU_Get_by_index(cpu_index)->Watchdog.ticks;
+  }
+}
+
+static void test_interrupt_wake_up(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  start_worker(ctx, interrupt_worker);
+
+  sc = rtems_task_wake_after(LONG_TICKS / 2);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /*
+   * The inter-processor interrupt wakes up the idle processor of scheduler B
+   * in the middle of the delay of the worker.  The interrupt observes the
+   * watchdog ticks which elapsed while the processor was idle.
+   */
+  _SMP_Unicast_action(1, interrupt_action, ctx);
+  rtems_test_assert(ctx->irq_cpu_index == 1);
+  rtems_test_assert(ctx->irq_ticks[1] + 2 >= ctx->irq_ticks[0]);
+  rtems_test_assert(ctx->irq_ticks[1] <= ctx->irq_ticks[0] + 1);
+
+  delete_worker(ctx, LONG_TICKS);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+
+  ctx->main_task = rtems_task_self();
+
+  test_long_idle(ctx);
+  test_cross_processor_timer(ctx);
+  test_interrupt_wake_up(ctx);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  rtems_resource_snapshot snapshot;
+
+  TEST_BEGIN();
+
+  rtems_resource_snapshot_take(&snapshot);
+
+  if (rtems_scheduler_get_processor_maximum() == CPU_COUNT) {
+    test();
+  }
+
+  rtems_test_assert(rtems_resource_snapshot_check(&snapshot));
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_SCHEDULER_SIMPLE_SMP
+
+#include <rtems/scheduler.h>
+
+RTEMS_SCHEDULER_SIMPLE_SMP(a);
+RTEMS_SCHEDULER_SIMPLE_SMP(b);
+
+#define CONFIGURE_SCHEDULER_TABLE_ENTRIES \
+  RTEMS_SCHEDULER_TABLE_SIMPLE_SMP(a, SCHEDULER_A), \
+  RTEMS_SCHEDULER_TABLE_SIMPLE_SMP(b, SCHEDULER_B)
+
+#define CONFIGURE_SCHEDULER_ASSIGNMENTS \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_MANDATORY), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL)
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#if defined(CLOCK_DRIVER_USE_TICKLESS_IDLE)
+#include <rtems/clockdrv.h>
+
+#define CONFIGURE_IDLE_TASK_BODY _Clock_Tickless_idle_body
+#endif
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
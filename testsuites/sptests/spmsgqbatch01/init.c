@@ -0,0 +1,293 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPMSGQBATCH 1";
+
+#define MESSAGE_COUNT 4
+
+#define MESSAGE_SIZE 16
+
+typedef struct {
+  rtems_id queue;
+  rtems_id receiver;
+  char buffer[2 * MESSAGE_COUNT][MESSAGE_SIZE];
+  size_t sizes[2 * MESSAGE_COUNT];
+  char receiver_buffer[MESSAGE_COUNT][MESSAGE_SIZE];
+  size_t receiver_sizes[MESSAGE_COUNT];
+  uint32_t count;
+} test_context;
+
+static test_context test_instance;
+
+static void prepare(test_context *ctx, uint32_t count)
+{
+  uint32_t i;
+
+  for (i = 0; i < count; ++i) {
+    memset(ctx->buffer[i], 'a' + (int) i, MESSAGE_SIZE);
+    ctx->sizes[i] = i + 1;
+  }
+}
+
+static void send_batch(
+  test_context *ctx,
+  uint32_t count,
+  rtems_status_code expected_sc,
+  uint32_t expected_sent
+)
+{
+  rtems_status_code sc;
+  uint32_t sent;
+
+  sent = UINT32_MAX;
+  sc = rtems_message_queue_send_batch(
+    ctx->queue,
+    ctx->buffer,
+    ctx->sizes,
+    count,
+    &sent
+  );
+  rtems_test_assert(sc == expected_sc);
+  rtems_test_assert(sent == expected_sent);
+}
+
+static void receive_batch(
+  test_context *ctx,
+  uint32_t maximum_count,
+  uint32_t expected_count,
+  char first
+)
+{
+  rtems_status_code sc;
+  uint32_t count;
+  uint32_t i;
+
+  memset(ctx->buffer, 0, sizeof(ctx->buffer));
+  count = UINT32_MAX;
+  sc = rtems_message_queue_receive_batch(
+    ctx->queue,
+    ctx->buffer,
+    ctx->sizes,
+    maximum_count,
+    &count,
+    RTEMS_NO_WAIT,
+    0
+  );
+
+  if (expected_count > 0) {
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  } else {
+    rtems_test_assert(sc == RTEMS_UNSATISFIED);
+  }
+
+  rtems_test_assert(count == expected_count);
+
+  for (i = 0; i < count; ++i) {
+    size_t size = (size_t) (first - 'a') + i + 1;
+
+    rtems_test_assert(ctx->sizes[i] == size);
+    rtems_test_assert(ctx->buffer[i][0] == first + (char) i);
+    rtems_test_assert(ctx->buffer[i][size - 1] == first + (char) i);
+  }
+}
+
+static void receiver(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+  rtems_status_code sc;
+
+  sc = rtems_message_queue_receive_batch(
+    ctx->queue,
+    ctx->receiver_buffer,
+    ctx->receiver_sizes,
+    MESSAGE_COUNT,
+    &ctx->count,
+    RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  (void) rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static void test_send_and_receive(test_context *ctx)
+{
+  prepare(ctx, 3);
+  send_batch(ctx, 3, RTEMS_SUCCESSFUL, 3);
+  receive_batch(ctx, 2, 2, 'a');
+  receive_batch(ctx, MESSAGE_COUNT, 1, 'c');
+  receive_batch(ctx, MESSAGE_COUNT, 0, 'a');
+
+  prepare(ctx, MESSAGE_COUNT + 1);
+  send_batch(ctx, MESSAGE_COUNT + 1, RTEMS_TOO_MANY, MESSAGE_COUNT);
+  receive_batch(ctx, 2 * MESSAGE_COUNT, MESSAGE_COUNT, 'a');
+
+  prepare(ctx, 2);
+  ctx->sizes[1] = MESSAGE_SIZE + 1;
+  send_batch(ctx, 2, RTEMS_INVALID_SIZE, 1);
+  receive_batch(ctx, MESSAGE_COUNT, 1, 'a');
+
+  send_batch(ctx, 0, RTEMS_SUCCESSFUL, 0);
+}
+
+static void test_waiting_receiver(test_context *ctx)
+{
+  rtems_status_code sc;
+  uint32_t pending;
+
+  ctx->count = 0;
+
+  sc = rtems_task_create(
+    rtems_build_name('R', 'E', 'C', 'V'),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->receiver
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(ctx->receiver, receiver, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* The waiting receiver gets exactly one message */
+  prepare(ctx, 3);
+  send_batch(ctx, 3, RTEMS_SUCCESSFUL, 3);
+  rtems_test_assert(ctx->count == 1);
+  rtems_test_assert(ctx->receiver_sizes[0] == 1);
+  rtems_test_assert(ctx->receiver_buffer[0][0] == 'a');
+
+  sc = rtems_message_queue_get_number_pending(ctx->queue, &pending);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(pending == 2);
+
+  receive_batch(ctx, MESSAGE_COUNT, 2, 'b');
+
+  sc = rtems_task_delete(ctx->receiver);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_invalid(test_context *ctx)
+{
+  rtems_status_code sc;
+  uint32_t count;
+
+  sc = rtems_message_queue_receive_batch(
+    ctx->queue,
+    ctx->buffer,
+    ctx->sizes,
+    0,
+    &count,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  sc = rtems_message_queue_receive_batch(
+    ctx->queue,
+    NULL,
+    ctx->sizes,
+    1,
+    &count,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_receive_batch(
+    ctx->queue,
+    ctx->buffer,
+    ctx->sizes,
+    1,
+    NULL,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_send_batch(ctx->queue, ctx->buffer, NULL, 1, &count);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_send_batch(0, ctx->buffer, ctx->sizes, 1, &count);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+
+  TEST_BEGIN();
+
+  sc = rtems_message_queue_create(
+    rtems_build_name('B', 'A', 'T', 'C'),
+    MESSAGE_COUNT,
+    MESSAGE_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->queue
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  test_send_and_receive(ctx);
+  test_waiting_receiver(ctx);
+  test_invalid(ctx);
+
+  sc = rtems_message_queue_delete(ctx->queue);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 1
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE(MESSAGE_COUNT, MESSAGE_SIZE)
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
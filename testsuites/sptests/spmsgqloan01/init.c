@@ -0,0 +1,386 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPMSGQLOAN 1";
+
+#define MESSAGE_COUNT 2
+
+#define MESSAGE_SIZE 4096
+
+typedef struct {
+  rtems_id queue;
+  rtems_id receiver;
+  void *buffer;
+  size_t size;
+  char copy[MESSAGE_SIZE];
+} test_context;
+
+static test_context test_instance;
+
+static void fill(void *buffer, size_t size, char c)
+{
+  memset(buffer, c, size);
+}
+
+static bool is_filled(const void *buffer, size_t size, char c)
+{
+  const char *p = buffer;
+  size_t i;
+
+  for (i = 0; i < size; ++i) {
+    if (p[i] != c) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static void *get_buffer(test_context *ctx)
+{
+  rtems_status_code sc;
+  void *buffer;
+
+  buffer = NULL;
+  sc = rtems_message_queue_get_buffer(ctx->queue, &buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(buffer != NULL);
+
+  return buffer;
+}
+
+static void release_buffer(test_context *ctx, void *buffer)
+{
+  rtems_status_code sc;
+
+  sc = rtems_message_queue_release_buffer(ctx->queue, buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void assert_all_buffers_available(test_context *ctx)
+{
+  rtems_status_code sc;
+  void *buffers[MESSAGE_COUNT];
+  void *buffer;
+  size_t i;
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    buffers[i] = get_buffer(ctx);
+  }
+
+  sc = rtems_message_queue_get_buffer(ctx->queue, &buffer);
+  rtems_test_assert(sc == RTEMS_TOO_MANY);
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    release_buffer(ctx, buffers[i]);
+  }
+}
+
+static void loan_receiver(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+  rtems_status_code sc;
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    &ctx->buffer,
+    &ctx->size,
+    RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  (void) rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static void copy_receiver(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+  rtems_status_code sc;
+
+  sc = rtems_message_queue_receive(
+    ctx->queue,
+    ctx->copy,
+    &ctx->size,
+    RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  (void) rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static void start_receiver(test_context *ctx, rtems_task_entry entry)
+{
+  rtems_status_code sc;
+
+  ctx->buffer = NULL;
+  ctx->size = 0;
+
+  sc = rtems_task_create(
+    rtems_build_name('R', 'E', 'C', 'V'),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->receiver
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(ctx->receiver, entry, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void delete_receiver(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_delete(ctx->receiver);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_pending(test_context *ctx)
+{
+  rtems_status_code sc;
+  char copy[MESSAGE_SIZE];
+  void *buffer;
+  void *received;
+  size_t size;
+
+  buffer = get_buffer(ctx);
+  fill(buffer, MESSAGE_SIZE, 'a');
+  sc = rtems_message_queue_send_buffer(ctx->queue, buffer, MESSAGE_SIZE);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  received = NULL;
+  size = 0;
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    &received,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(received == buffer);
+  rtems_test_assert(size == MESSAGE_SIZE);
+  rtems_test_assert(is_filled(received, size, 'a'));
+
+  /* Forward the received buffer without a copy */
+  sc = rtems_message_queue_send_buffer(ctx->queue, received, 1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  size = 0;
+  sc = rtems_message_queue_receive(
+    ctx->queue,
+    copy,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(size == 1);
+  rtems_test_assert(copy[0] == 'a');
+
+  fill(copy, MESSAGE_SIZE, 'b');
+  sc = rtems_message_queue_send(ctx->queue, copy, MESSAGE_SIZE);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    &received,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(size == MESSAGE_SIZE);
+  rtems_test_assert(is_filled(received, size, 'b'));
+  release_buffer(ctx, received);
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    &received,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+
+  assert_all_buffers_available(ctx);
+}
+
+static void test_waiting_receiver(test_context *ctx)
+{
+  rtems_status_code sc;
+  char copy[MESSAGE_SIZE];
+  void *buffer;
+
+  start_receiver(ctx, loan_receiver);
+  buffer = get_buffer(ctx);
+  fill(buffer, MESSAGE_SIZE, 'c');
+  sc = rtems_message_queue_send_buffer(ctx->queue, buffer, MESSAGE_SIZE);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->buffer == buffer);
+  rtems_test_assert(ctx->size == MESSAGE_SIZE);
+  release_buffer(ctx, ctx->buffer);
+  delete_receiver(ctx);
+
+  start_receiver(ctx, loan_receiver);
+  fill(copy, MESSAGE_SIZE, 'd');
+  sc = rtems_message_queue_send(ctx->queue, copy, 2);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->buffer != NULL);
+  rtems_test_assert(ctx->size == 2);
+  rtems_test_assert(is_filled(ctx->buffer, ctx->size, 'd'));
+  release_buffer(ctx, ctx->buffer);
+  delete_receiver(ctx);
+
+  start_receiver(ctx, copy_receiver);
+  buffer = get_buffer(ctx);
+  fill(buffer, MESSAGE_SIZE, 'e');
+  sc = rtems_message_queue_send_buffer(ctx->queue, buffer, MESSAGE_SIZE);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->size == MESSAGE_SIZE);
+  rtems_test_assert(is_filled(ctx->copy, ctx->size, 'e'));
+  delete_receiver(ctx);
+
+  assert_all_buffers_available(ctx);
+}
+
+static void test_invalid(test_context *ctx)
+{
+  rtems_status_code sc;
+  char *buffer;
+  void *other;
+  size_t size;
+
+  sc = rtems_message_queue_get_buffer(ctx->queue, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_get_buffer(0, &other);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    NULL,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    &other,
+    NULL,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  buffer = get_buffer(ctx);
+
+  sc = rtems_message_queue_send_buffer(ctx->queue, buffer, MESSAGE_SIZE + 1);
+  rtems_test_assert(sc == RTEMS_INVALID_SIZE);
+
+  sc = rtems_message_queue_send_buffer(ctx->queue, NULL, 1);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_send_buffer(ctx->queue, buffer + 1, 1);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_release_buffer(ctx->queue, ctx->copy);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  release_buffer(ctx, buffer);
+
+  sc = rtems_message_queue_release_buffer(ctx->queue, buffer);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_send_buffer(ctx->queue, buffer, 1);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  assert_all_buffers_available(ctx);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+
+  TEST_BEGIN();
+
+  sc = rtems_message_queue_create(
+    rtems_build_name('L', 'O', 'A', 'N'),
+    MESSAGE_COUNT,
+    MESSAGE_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->queue
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  test_pending(ctx);
+  test_waiting_receiver(ctx);
+  test_invalid(ctx);
+
+  sc = rtems_message_queue_delete(ctx->queue);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 1
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE(MESSAGE_COUNT, MESSAGE_SIZE)
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
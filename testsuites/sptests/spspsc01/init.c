@@ -0,0 +1,211 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/spsc.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPSPSC 1";
+
+#define MESSAGE_COUNT 4
+
+typedef struct {
+  rtems_spsc_channel channel;
+  uint32_t storage[MESSAGE_COUNT];
+  rtems_id timer;
+  uint32_t next;
+} test_context;
+
+static test_context test_instance;
+
+static void send(test_context *ctx, uint32_t value, bool expected)
+{
+  bool sent;
+
+  sent = rtems_spsc_channel_send(&ctx->channel, &value);
+  rtems_test_assert(sent == expected);
+}
+
+static void receive(
+  test_context *ctx,
+  rtems_option option_set,
+  rtems_interval timeout,
+  rtems_status_code expected_sc,
+  uint32_t expected_value
+)
+{
+  rtems_status_code sc;
+  uint32_t value;
+
+  value = UINT32_MAX;
+  sc = rtems_spsc_channel_receive(&ctx->channel, &value, option_set, timeout);
+  rtems_test_assert(sc == expected_sc);
+
+  if (sc == RTEMS_SUCCESSFUL) {
+    rtems_test_assert(value == expected_value);
+  }
+}
+
+static void timer_routine(rtems_id timer, void *arg)
+{
+  test_context *ctx = arg;
+
+  send(ctx, ctx->next, true);
+  ++ctx->next;
+}
+
+static void fire_timer(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_timer_fire_after(ctx->timer, 1, timer_routine, ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_initialize(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_spsc_channel_initialize(
+    NULL,
+    ctx->storage,
+    MESSAGE_COUNT,
+    sizeof(ctx->storage[0])
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_spsc_channel_initialize(
+    &ctx->channel,
+    ctx->storage,
+    MESSAGE_COUNT - 1,
+    sizeof(ctx->storage[0])
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  sc = rtems_spsc_channel_initialize(
+    &ctx->channel,
+    ctx->storage,
+    MESSAGE_COUNT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_SIZE);
+
+  sc = rtems_spsc_channel_initialize(
+    &ctx->channel,
+    ctx->storage,
+    MESSAGE_COUNT,
+    sizeof(ctx->storage[0])
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_send_and_receive(test_context *ctx)
+{
+  uint32_t value;
+  uint32_t i;
+
+  rtems_test_assert(!rtems_spsc_channel_try_receive(&ctx->channel, &value));
+  receive(ctx, RTEMS_NO_WAIT, 0, RTEMS_UNSATISFIED, 0);
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    send(ctx, i, true);
+  }
+
+  send(ctx, MESSAGE_COUNT, false);
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    receive(ctx, RTEMS_NO_WAIT, 0, RTEMS_SUCCESSFUL, i);
+  }
+
+  /* Wrap around the ring several times */
+  for (i = 0; i < 3 * MESSAGE_COUNT; ++i) {
+    send(ctx, i, true);
+    rtems_test_assert(rtems_spsc_channel_try_receive(&ctx->channel, &value));
+    rtems_test_assert(value == i);
+  }
+
+  rtems_test_assert(!rtems_spsc_channel_try_receive(&ctx->channel, &value));
+}
+
+static void test_wait(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_timer_create(rtems_build_name('S', 'P', 'S', 'C'), &ctx->timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* The interrupt handler of the timer wakes up the waiting consumer */
+  ctx->next = 123;
+  fire_timer(ctx);
+  receive(ctx, RTEMS_WAIT, RTEMS_NO_TIMEOUT, RTEMS_SUCCESSFUL, 123);
+
+  fire_timer(ctx);
+  receive(ctx, RTEMS_WAIT, 10, RTEMS_SUCCESSFUL, 124);
+
+  receive(ctx, RTEMS_WAIT, 1, RTEMS_TIMEOUT, 0);
+
+  /* A send after a timeout must not wake up anyone */
+  send(ctx, 125, true);
+  receive(ctx, RTEMS_NO_WAIT, 0, RTEMS_SUCCESSFUL, 125);
+
+  sc = rtems_timer_delete(ctx->timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  TEST_BEGIN();
+
+  test_initialize(ctx);
+  test_send_and_receive(ctx);
+  test_wait(ctx);
+  rtems_spsc_channel_destroy(&ctx->channel);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
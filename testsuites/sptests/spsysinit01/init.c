@@ -533,13 +533,18 @@ LAST(RTEMS_SYSINIT_IDLE_THREADS)
 
 FIRST(RTEMS_SYSINIT_LIBIO)
 {
-  assert(rtems_libio_iop_free_head == NULL);
+  assert(
+    _Atomic_Load_uint(&rtems_libio_iop_free_head, ATOMIC_ORDER_RELAXED) == 0
+  );
   next_step(LIBIO_PRE);
 }
 
 LAST(RTEMS_SYSINIT_LIBIO)
 {
-  assert(rtems_libio_iop_free_head == &rtems_libio_iops[0]);
+  assert(
+    (_Atomic_Load_uint(&rtems_libio_iop_free_head, ATOMIC_ORDER_RELAXED)
+      & rtems_libio_iop_free_index_mask()) == 1
+  );
   next_step(LIBIO_POST);
 }
 
@@ -0,0 +1,406 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/score/watchdogimpl.h>
+
+#include <tmacros.h>
+
+const char rtems_test_name[] = "SPWATCHDOGWHEEL 1";
+
+#define LEVEL_NONE ( -1 )
+
+#define LEVEL_FAR_FUTURE WATCHDOG_WHEEL_LEVEL_COUNT
+
+typedef struct {
+  Watchdog_Control Base;
+  uint64_t fired;
+  int counter;
+} test_watchdog;
+
+typedef struct {
+  uint64_t interval;
+  int level;
+} test_interval;
+
+typedef struct {
+  Watchdog_Header header;
+  Watchdog_Wheel wheel;
+  uint64_t now;
+  bool skip;
+  rtems_id task;
+  rtems_interval timer_fired;
+} test_context;
+
+static test_context test_instance;
+
+/*
+ * The level of a watchdog depends only on its interval, since the expiration
+ * time is relative to the next tick to process.
+ */
+static const test_interval test_intervals[] = {
+  { 1, 0 },
+  { 63, 0 },
+  { 64, 0 },
+  { 65, 1 },
+  { 4095, 1 },
+  { 4096, 1 },
+  { 4097, 2 },
+  { UINT64_C( 1 ) << 18, 2 },
+  { ( UINT64_C( 1 ) << 18 ) + 1, 3 },
+  { UINT64_C( 1 ) << 24, 3 },
+  { ( UINT64_C( 1 ) << 24 ) + 1, LEVEL_FAR_FUTURE },
+  { ( UINT64_C( 1 ) << 25 ) + 12345, LEVEL_FAR_FUTURE }
+};
+
+#define INTERVAL_COUNT RTEMS_ARRAY_SIZE( test_intervals )
+
+/* The intervals which are processed tick by tick */
+#define SHORT_INTERVAL_COUNT 8
+
+/* A start tick close to a carry into the far future range */
+#define FAST_FORWARD_START ( ( UINT64_C( 1 ) << 36 ) - 3000 )
+
+static test_watchdog test_watchdogs[ INTERVAL_COUNT ];
+
+static void test_watchdog_routine( Watchdog_Control *base )
+{
+  test_watchdog *watchdog;
+
+  watchdog = (test_watchdog *) base;
+  watchdog->fired = test_instance.now;
+  ++watchdog->counter;
+}
+
+static void test_watchdog_init( test_watchdog *watchdog )
+{
+  _Watchdog_Preinitialize( &watchdog->Base, _Per_CPU_Get_snapshot() );
+  _Watchdog_Initialize( &watchdog->Base, test_watchdog_routine );
+  watchdog->fired = 0;
+  watchdog->counter = 0;
+}
+
+static bool test_watchdog_is_inactive( const test_watchdog *watchdog )
+{
+  return _Watchdog_Get_state( &watchdog->Base ) == WATCHDOG_INACTIVE;
+}
+
+static int test_level_of(
+  const test_context  *ctx,
+  const test_watchdog *watchdog
+)
+{
+  const Chain_Node *node;
+  uint32_t level;
+  uint32_t slot;
+
+  if ( test_watchdog_is_inactive( watchdog ) ) {
+    return LEVEL_NONE;
+  }
+
+  /* Find the tail of the chain which contains the watchdog */
+  node = &watchdog->Base.Node.Chain;
+
+  while ( node->next != NULL ) {
+    node = node->next;
+  }
+
+  for ( level = 0; level < WATCHDOG_WHEEL_LEVEL_COUNT; ++level ) {
+    for ( slot = 0; slot < WATCHDOG_WHEEL_SLOT_COUNT; ++slot ) {
+      const Chain_Control *chain;
+
+      chain = &ctx->wheel.Slots[ level ][ slot ];
+
+      if ( node == _Chain_Immutable_tail( chain ) ) {
+        return (int) level;
+      }
+    }
+  }
+
+  rtems_test_assert( node == _Chain_Immutable_tail( &ctx->wheel.Far_future ) );
+  return LEVEL_FAR_FUTURE;
+}
+
+static void test_init( test_context *ctx, uint64_t now, bool skip )
+{
+  ctx->now = now;
+  ctx->skip = skip;
+  _Watchdog_Header_initialize_wheel( &ctx->header, &ctx->wheel, now );
+  rtems_test_assert( ctx->header.wheel == &ctx->wheel );
+  rtems_test_assert(
+    _Watchdog_Wheel_next_expire( &ctx->wheel ) == WATCHDOG_MAXIMUM_TICKS
+  );
+}
+
+static void test_tick( test_context *ctx )
+{
+  ISR_LOCK_DEFINE( , lock, "Test" )
+  ISR_lock_Context lock_context;
+
+  _ISR_lock_ISR_disable_and_acquire( &lock, &lock_context );
+  ++ctx->now;
+  _Watchdog_Wheel_tickle( &ctx->wheel, ctx->now, &lock, &lock_context );
+  rtems_test_assert( ctx->wheel.next == ctx->now + 1 );
+  _ISR_lock_Release_and_ISR_enable( &lock, &lock_context );
+  _ISR_lock_Destroy( &lock );
+}
+
+/*
+ * Processes the ticks up to and including the specified tick.  Optionally,
+ * the ticks without work on the timing wheel are skipped in the same way as
+ * _Watchdog_Tickless_tick() does it for the tickless idle mode.
+ */
+static void test_advance( test_context *ctx, uint64_t until )
+{
+  while ( ctx->now < until ) {
+    if ( ctx->skip ) {
+      uint64_t next;
+
+      next = _Watchdog_Wheel_next_expire( &ctx->wheel );
+      rtems_test_assert( next >= ctx->wheel.next );
+
+      if ( next > until ) {
+        next = until;
+      }
+
+      ctx->now = next - 1;
+      ctx->wheel.next = next;
+    }
+
+    test_tick( ctx );
+  }
+}
+
+static void test_intervals_fire(
+  test_context *ctx,
+  uint64_t start,
+  bool skip,
+  size_t count
+)
+{
+  size_t i;
+
+  test_init( ctx, start, skip );
+
+  for ( i = 0; i < count; ++i ) {
+    test_watchdog *watchdog;
+
+    watchdog = &test_watchdogs[ i ];
+    test_watchdog_init( watchdog );
+    _Watchdog_Insert(
+      &ctx->header,
+      &watchdog->Base,
+      start + test_intervals[ i ].interval
+    );
+    rtems_test_assert( !test_watchdog_is_inactive( watchdog ) );
+    rtems_test_assert(
+      test_level_of( ctx, watchdog ) == test_intervals[ i ].level
+    );
+  }
+
+  rtems_test_assert(
+    _Watchdog_Wheel_next_expire( &ctx->wheel ) == start + 1
+  );
+
+  for ( i = 0; i < count; ++i ) {
+    test_watchdog *watchdog;
+    uint64_t expire;
+
+    watchdog = &test_watchdogs[ i ];
+    expire = start + test_intervals[ i ].interval;
+
+    test_advance( ctx, expire - 1 );
+    rtems_test_assert( !test_watchdog_is_inactive( watchdog ) );
+    rtems_test_assert( watchdog->counter == 0 );
+
+    test_advance( ctx, expire );
+    rtems_test_assert( test_watchdog_is_inactive( watchdog ) );
+    rtems_test_assert( watchdog->counter == 1 );
+    rtems_test_assert( watchdog->fired == expire );
+  }
+
+  /* Make sure that no watchdog fires twice */
+  if ( skip ) {
+    test_advance( ctx, ctx->now + ( UINT64_C( 1 ) << 25 ) );
+  } else {
+    test_advance( ctx, ctx->now + 4096 );
+  }
+
+  for ( i = 0; i < count; ++i ) {
+    rtems_test_assert( test_watchdogs[ i ].counter == 1 );
+  }
+
+  rtems_test_assert(
+    _Watchdog_Wheel_next_expire( &ctx->wheel ) == WATCHDOG_MAXIMUM_TICKS
+  );
+}
+
+static void test_cancel( test_context *ctx, uint64_t start )
+{
+  test_watchdog *a;
+  test_watchdog *b;
+  test_watchdog *c;
+  uint64_t expire_a;
+  uint64_t expire_b;
+  uint64_t remaining;
+
+  test_init( ctx, start, true );
+  a = &test_watchdogs[ 0 ];
+  b = &test_watchdogs[ 1 ];
+  c = &test_watchdogs[ 2 ];
+  test_watchdog_init( a );
+  test_watchdog_init( b );
+  test_watchdog_init( c );
+
+  /* Cancel after the cascades from level 3 down to level 0 */
+  expire_a = start + ( UINT64_C( 1 ) << 20 ) + 100;
+  _Watchdog_Insert( &ctx->header, &a->Base, expire_a );
+  rtems_test_assert( test_level_of( ctx, a ) == 3 );
+
+  test_advance( ctx, expire_a - 10 );
+  rtems_test_assert( test_level_of( ctx, a ) == 0 );
+  remaining = _Watchdog_Cancel( &ctx->header, &a->Base, ctx->now );
+  rtems_test_assert( remaining == 10 );
+  rtems_test_assert( test_watchdog_is_inactive( a ) );
+  rtems_test_assert( test_level_of( ctx, a ) == LEVEL_NONE );
+
+  /* Cancel on the far future chain */
+  expire_b = ctx->now + ( UINT64_C( 1 ) << 26 );
+  _Watchdog_Insert( &ctx->header, &b->Base, expire_b );
+  rtems_test_assert( test_level_of( ctx, b ) == LEVEL_FAR_FUTURE );
+  remaining = _Watchdog_Cancel( &ctx->header, &b->Base, ctx->now );
+  rtems_test_assert( remaining == UINT64_C( 1 ) << 26 );
+  rtems_test_assert( test_watchdog_is_inactive( b ) );
+
+  /* Cancel after the far future chain was cascaded */
+  _Watchdog_Insert( &ctx->header, &b->Base, expire_b );
+  test_advance( ctx, expire_b - 4096 );
+  rtems_test_assert( test_level_of( ctx, b ) != LEVEL_FAR_FUTURE );
+  remaining = _Watchdog_Cancel( &ctx->header, &b->Base, ctx->now );
+  rtems_test_assert( remaining == 4096 );
+  rtems_test_assert( test_watchdog_is_inactive( b ) );
+
+  /* A canceled watchdog may be scheduled again */
+  _Watchdog_Insert( &ctx->header, &a->Base, ctx->now + 4097 );
+  _Watchdog_Insert( &ctx->header, &c->Base, ctx->now + 4097 );
+  remaining = _Watchdog_Cancel( &ctx->header, &c->Base, ctx->now );
+  rtems_test_assert( remaining == 4097 );
+  expire_a = a->Base.expire;
+
+  test_advance( ctx, expire_b + 1 );
+  rtems_test_assert( a->counter == 1 );
+  rtems_test_assert( a->fired == expire_a );
+  rtems_test_assert( b->counter == 0 );
+  rtems_test_assert( c->counter == 0 );
+
+  /* Nothing remains for an expired watchdog */
+  remaining = _Watchdog_Cancel( &ctx->header, &a->Base, ctx->now );
+  rtems_test_assert( remaining == 0 );
+  rtems_test_assert( test_watchdog_is_inactive( a ) );
+}
+
+static void test_timer_routine( rtems_id timer, void *arg )
+{
+  test_context *ctx;
+  rtems_status_code sc;
+
+  ctx = arg;
+  ctx->timer_fired = rtems_clock_get_ticks_since_boot();
+  sc = rtems_event_transient_send( ctx->task );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void test_system( test_context *ctx )
+{
+  Per_CPU_Control *cpu;
+  rtems_status_code sc;
+  rtems_id timer;
+  rtems_interval start;
+
+  cpu = _Per_CPU_Get_by_index( 0 );
+  rtems_test_assert(
+    cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ].wheel
+      == &_Watchdog_Wheels[ 0 ]
+  );
+
+  ctx->task = rtems_task_self();
+
+  sc = rtems_timer_create( rtems_build_name( 'T', 'I', 'M', 'R' ), &timer );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_wake_after( 1 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  start = rtems_clock_get_ticks_since_boot();
+  sc = rtems_timer_fire_after( timer, 65, test_timer_routine, ctx );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_event_transient_receive( RTEMS_WAIT, RTEMS_NO_TIMEOUT );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( ctx->timer_fired == start + 65 );
+
+  sc = rtems_timer_delete( timer );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  TEST_BEGIN();
+  ctx = &test_instance;
+
+  test_intervals_fire( ctx, 0, false, SHORT_INTERVAL_COUNT );
+  test_intervals_fire( ctx, 0, true, INTERVAL_COUNT );
+  test_intervals_fire( ctx, FAST_FORWARD_START, true, INTERVAL_COUNT );
+  test_cancel( ctx, 0 );
+  test_cancel( ctx, FAST_FORWARD_START );
+  test_system( ctx );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_WATCHDOG_TIMING_WHEEL
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
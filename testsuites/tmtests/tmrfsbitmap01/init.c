@@ -0,0 +1,311 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/rfs/rtems-rfs-bitmaps.h>
+#include <rtems/rfs/rtems-rfs-file-system.h>
+
+const char rtems_test_name[] = "TMRFSBITMAP 1";
+
+#define MAP_BIT_COUNT (4096 * 8)
+
+#define SAMPLE_COUNT 1000
+
+#define RUN_SIZE 64
+
+#define FREE_PERCENT 3
+
+typedef struct {
+  rtems_rfs_file_system fs;
+  rtems_rfs_bitmap_control control;
+  rtems_rfs_buffer_handle handle;
+  rtems_rfs_buffer buffer;
+  uint32_t random_state;
+} test_context;
+
+static test_context test_instance;
+
+static uint32_t next_random(test_context *ctx)
+{
+  ctx->random_state = ctx->random_state * 1664525 + 1013904223;
+
+  return ctx->random_state >> 8;
+}
+
+static rtems_rfs_bitmap_bit random_seed(test_context *ctx)
+{
+  return (rtems_rfs_bitmap_bit) (next_random(ctx) % MAP_BIT_COUNT);
+}
+
+static void open_bitmap(test_context *ctx)
+{
+  size_t bytes;
+  int rc;
+
+  bytes = rtems_rfs_bitmap_elements(MAP_BIT_COUNT)
+    * sizeof(rtems_rfs_bitmap_element);
+
+  memset(&ctx->fs, 0, sizeof(ctx->fs));
+  memset(&ctx->buffer, 0, sizeof(ctx->buffer));
+
+  ctx->buffer.buffer = malloc(bytes);
+  rtems_test_assert(ctx->buffer.buffer != NULL);
+  ctx->buffer.block = 1;
+
+#if RTEMS_RFS_BITMAP_CLEAR_ZERO
+  memset(ctx->buffer.buffer, 0, bytes);
+#else
+  memset(ctx->buffer.buffer, 0xff, bytes);
+#endif
+
+  /* The handle is never closed, so no writes occur */
+  rc = rtems_rfs_buffer_handle_open(&ctx->fs, &ctx->handle);
+  rtems_test_assert(rc == 0);
+
+  ctx->handle.buffer = &ctx->buffer;
+  ctx->handle.bnum = 1;
+
+  rc = rtems_rfs_bitmap_open(&ctx->control, &ctx->fs, &ctx->handle,
+    MAP_BIT_COUNT, 1);
+  rtems_test_assert(rc == 0);
+}
+
+static void close_bitmap(test_context *ctx)
+{
+  int rc;
+
+  rc = rtems_rfs_bitmap_close(&ctx->control);
+  rtems_test_assert(rc == 0);
+
+  free(ctx->buffer.buffer);
+}
+
+static void clear_bits(
+  test_context *ctx,
+  rtems_rfs_bitmap_bit bit,
+  size_t count
+)
+{
+  size_t i;
+
+  for (i = 0; i < count; ++i) {
+    int rc;
+
+    rc = rtems_rfs_bitmap_map_clear(&ctx->control, bit + i);
+    rtems_test_assert(rc == 0);
+  }
+}
+
+static void print_result(const char *name, rtems_counter_ticks d)
+{
+  printf(
+    "  <%s unit=\"ns\">%" PRIu64 "</%s>\n",
+    name,
+    rtems_counter_ticks_to_nanoseconds(d) / SAMPLE_COUNT,
+    name
+  );
+}
+
+static void measure_single_bit(test_context *ctx, const char *name)
+{
+  rtems_counter_ticks d;
+  size_t i;
+
+  d = 0;
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    rtems_rfs_bitmap_bit seed;
+    rtems_rfs_bitmap_bit bit;
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+    bool allocated;
+    int rc;
+
+    seed = random_seed(ctx);
+
+    a = rtems_counter_read();
+    rc = rtems_rfs_bitmap_map_alloc(&ctx->control, seed, &allocated, &bit);
+    b = rtems_counter_read();
+
+    rtems_test_assert(rc == 0);
+    rtems_test_assert(allocated);
+    d += rtems_counter_difference(b, a);
+
+    clear_bits(ctx, bit, 1);
+  }
+
+  print_result(name, d);
+}
+
+static void measure_run(test_context *ctx)
+{
+  rtems_counter_ticks d;
+  size_t i;
+
+  d = 0;
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    rtems_rfs_bitmap_bit seed;
+    rtems_rfs_bitmap_bit bit;
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+    size_t count;
+    int rc;
+
+    seed = random_seed(ctx) % (MAP_BIT_COUNT - RUN_SIZE);
+
+    a = rtems_counter_read();
+    rc = rtems_rfs_bitmap_map_alloc_run(&ctx->control, seed, RUN_SIZE,
+      &count, &bit);
+    b = rtems_counter_read();
+
+    rtems_test_assert(rc == 0);
+    rtems_test_assert(count == RUN_SIZE);
+    d += rtems_counter_difference(b, a);
+
+    clear_bits(ctx, bit, count);
+  }
+
+  print_result("Run", d);
+}
+
+static void measure_single_bits_of_run(test_context *ctx)
+{
+  rtems_counter_ticks d;
+  size_t i;
+
+  d = 0;
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    rtems_rfs_bitmap_bit seed;
+    rtems_rfs_bitmap_bit first;
+    rtems_rfs_bitmap_bit bit;
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+    size_t j;
+
+    seed = random_seed(ctx) % (MAP_BIT_COUNT - RUN_SIZE);
+    first = seed;
+
+    a = rtems_counter_read();
+
+    for (j = 0; j < RUN_SIZE; ++j) {
+      bool allocated;
+      int rc;
+
+      rc = rtems_rfs_bitmap_map_alloc(&ctx->control, seed, &allocated, &bit);
+      rtems_test_assert(rc == 0);
+      rtems_test_assert(allocated);
+      seed = bit;
+    }
+
+    b = rtems_counter_read();
+
+    d += rtems_counter_difference(b, a);
+
+    rtems_test_assert(bit == first + RUN_SIZE - 1);
+    clear_bits(ctx, first, RUN_SIZE);
+  }
+
+  print_result("SingleBitsOfRun", d);
+}
+
+static void fill_bitmap(test_context *ctx)
+{
+  rtems_rfs_bitmap_bit bit;
+  int rc;
+
+  rc = rtems_rfs_bitmap_map_set_all(&ctx->control);
+  rtems_test_assert(rc == 0);
+
+  for (bit = 0; bit < MAP_BIT_COUNT; ++bit) {
+    if (next_random(ctx) % 100 < FREE_PERCENT) {
+      clear_bits(ctx, bit, 1);
+    }
+  }
+
+  rtems_test_assert(ctx->control.free > 0);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+
+  ctx->random_state = 1;
+
+  printf(
+    "<TMRFSBitmap01 bitCount=\"%d\" runSize=\"%d\" samples=\"%d\">\n",
+    MAP_BIT_COUNT,
+    RUN_SIZE,
+    SAMPLE_COUNT
+  );
+
+  open_bitmap(ctx);
+  measure_single_bit(ctx, "SingleBitEmpty");
+  measure_run(ctx);
+  measure_single_bits_of_run(ctx);
+  fill_bitmap(ctx);
+  measure_single_bit(ctx, "SingleBitFull");
+  close_bitmap(ctx);
+
+  printf("</TMRFSBitmap01>\n");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
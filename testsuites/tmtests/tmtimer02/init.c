@@ -0,0 +1,255 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 The RTEMS Project
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/score/watchdogimpl.h>
+
+const char rtems_test_name[] = "TMTIMER 2";
+
+#define WATCHDOG_COUNT_MAX 8192
+
+typedef struct {
+  size_t cache_line_size;
+  size_t data_cache_size;
+  int dummy_value;
+  volatile int *dummy_data;
+  size_t watchdog_count;
+  Watchdog_Header tree;
+  Watchdog_Control *tree_watchdogs;
+  Watchdog_Header wheel;
+  Watchdog_Wheel wheel_storage;
+  Watchdog_Control *wheel_watchdogs;
+} test_context;
+
+static test_context test_instance;
+
+static void prepare_cache(test_context *ctx)
+{
+  volatile int *data = ctx->dummy_data;
+  size_t m = ctx->data_cache_size / sizeof(*data);
+  size_t k = ctx->cache_line_size / sizeof(*data);
+  size_t j = ctx->dummy_value;
+  size_t i;
+
+  for (i = 0; i < m; i += k) {
+    data[i] = i + j;
+  }
+
+  ctx->dummy_value = i + j;
+  rtems_cache_invalidate_entire_instruction();
+}
+
+static void never(Watchdog_Control *watchdog)
+{
+  rtems_test_assert(0);
+}
+
+static uint64_t interval(size_t i)
+{
+  uint64_t d = 1000;
+
+  return i * d + d;
+}
+
+static void test_insert_and_remove(
+  test_context *ctx,
+  Watchdog_Header *header,
+  Watchdog_Control *watchdog,
+  size_t j,
+  const char *name
+)
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  rtems_counter_ticks d;
+  rtems_interrupt_level level;
+
+  prepare_cache(ctx);
+
+  rtems_interrupt_local_disable(level);
+  a = rtems_counter_read();
+  _Watchdog_Insert(header, watchdog, interval(j));
+  _Watchdog_Remove(header, watchdog);
+  b = rtems_counter_read();
+  rtems_interrupt_local_enable(level);
+
+  d = rtems_counter_difference(b, a);
+
+  rtems_test_assert(!_Watchdog_Is_scheduled(watchdog));
+
+  printf(
+    "<%s unit=\"ns\">%" PRIu64 "</%s>",
+    name,
+    rtems_counter_ticks_to_nanoseconds(d),
+    name
+  );
+}
+
+static void test_header(
+  test_context *ctx,
+  Watchdog_Header *header,
+  Watchdog_Control *watchdogs,
+  size_t j,
+  size_t k,
+  const char *name
+)
+{
+  size_t s;
+  size_t t;
+
+  s = j - k;
+
+  for (t = 0; t < s; ++t) {
+    size_t u = k + t;
+
+    _Watchdog_Insert(header, &watchdogs[u], interval(u + 1));
+  }
+
+  printf("\n    <%s>", name);
+  test_insert_and_remove(ctx, header, &watchdogs[j], 0, "First");
+  test_insert_and_remove(ctx, header, &watchdogs[j], j / 2, "Middle");
+  test_insert_and_remove(ctx, header, &watchdogs[j], j + 1, "Last");
+  printf("</%s>", name);
+}
+
+static void test_case(test_context *ctx, size_t j, size_t k)
+{
+  printf("  <Sample>\n    <ActiveTimers>%zu</ActiveTimers>", j);
+  test_header(ctx, &ctx->tree, ctx->tree_watchdogs, j, k, "RBTree");
+  test_header(ctx, &ctx->wheel, ctx->wheel_watchdogs, j, k, "Wheel");
+  printf("\n  </Sample>\n");
+}
+
+static Watchdog_Control *create_watchdogs(size_t count)
+{
+  Watchdog_Control *watchdogs;
+  size_t i;
+
+  watchdogs = calloc(count, sizeof(*watchdogs));
+  if (watchdogs == NULL) {
+    return NULL;
+  }
+
+  for (i = 0; i < count; ++i) {
+    _Watchdog_Preinitialize(&watchdogs[i], _Per_CPU_Get_snapshot());
+    _Watchdog_Initialize(&watchdogs[i], never);
+  }
+
+  return watchdogs;
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  size_t j;
+  size_t k;
+
+  ctx->cache_line_size = rtems_cache_get_data_line_size();
+  if (ctx->cache_line_size == 0) {
+    ctx->cache_line_size = 32;
+  }
+
+  ctx->data_cache_size = rtems_cache_get_data_cache_size(0);
+  if (ctx->data_cache_size == 0) {
+    ctx->data_cache_size = ctx->cache_line_size;
+  }
+
+  ctx->dummy_data = malloc(ctx->data_cache_size);
+  rtems_test_assert(ctx->dummy_data != NULL);
+
+  ctx->watchdog_count = WATCHDOG_COUNT_MAX;
+
+  while (true) {
+    ctx->tree_watchdogs = create_watchdogs(ctx->watchdog_count);
+    ctx->wheel_watchdogs = create_watchdogs(ctx->watchdog_count);
+
+    if (ctx->tree_watchdogs != NULL && ctx->wheel_watchdogs != NULL) {
+      break;
+    }
+
+    free(ctx->tree_watchdogs);
+    free(ctx->wheel_watchdogs);
+    ctx->watchdog_count /= 2;
+    rtems_test_assert(ctx->watchdog_count > 1);
+  }
+
+  _Watchdog_Header_initialize(&ctx->tree);
+  _Watchdog_Header_initialize_wheel(&ctx->wheel, &ctx->wheel_storage, 0);
+
+  printf("<TMTimer02 timerCount=\"%zu\">\n", ctx->watchdog_count);
+
+  k = 0;
+  j = 0;
+
+  while (j < ctx->watchdog_count - 1) {
+    test_case(ctx, j, k);
+    k = j;
+    j = (123 * (j + 1) + 99) / 100;
+  }
+
+  test_case(ctx, ctx->watchdog_count - 1, k);
+
+  printf("</TMTimer02>\n");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_WATCHDOG_TIMING_WHEEL
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>